@@ -0,0 +1,38 @@
+; Test 36: Macro Expansion (.macro, .rept)
+; Tests expansion of macros and repeated blocks, with named and positional
+; parameters, and labels local to each expansion.
+
+; A countdown loop; `loop` becomes `loop.1`, `loop.2`, etc. in each expansion.
+.macro countdown reg, count
+    ld @reg, @count
+loop:
+    dec @reg
+    jpb zc, loop
+.endm
+
+; Parameters by position, and a repeated block within a macro.
+.macro fill_pair first, second
+.rept 2
+    .byte @1, @2
+.endr
+.endm
+
+.org 0x2000
+
+; Macro invocations
+macro_invocations:
+    countdown d0, 10            ; ld d0, 10 / dec d0 / jpb zc, loop.1
+    countdown d0, 10            ; Same arguments; a fresh `loop.2`
+    countdown d1, (2 + 3)       ; Arguments may be expressions
+    fill_pair 0xAA, 0x55        ; .byte 0xAA, 0x55 (twice)
+
+; Repeated block with a local label
+repeated_block:
+.rept 3
+spin:
+    nop
+    jpb nc, spin                ; Each repetition branches to its own `spin`
+.endr
+
+; A label may precede an invocation on the same line
+labelled: countdown d2, 1
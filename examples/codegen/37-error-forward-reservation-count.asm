@@ -0,0 +1,19 @@
+; Test 37: RAM Reservation Sized by a Later Label (Error)
+; Tests that a RAM reservation whose count depends on labels defined after it
+; is rejected, rather than sized one way when laying out the module's labels
+; and another way when emitting it.
+
+; RAM section: the buffer's size depends on the table below
+.org 0x80000000
+ram_buffer:
+    .byte table_end - table     ; Error: 'table_end' is not yet defined
+ram_after:
+    .byte 1
+
+; Code section in ROM
+.org 0x2000
+table:
+    .byte 1, 2, 3
+table_end:
+    ld d0, ram_after
+    ret nc
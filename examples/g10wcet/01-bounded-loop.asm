@@ -0,0 +1,35 @@
+; Test 01: Bounded Loop
+; Tests: A subroutine whose loop is bounded by an annotation
+;
+; The loop at `sum_loop` runs once per table entry, as annotated in
+; `01-bounded-loop.loops`. The subroutine's worst case, in M-cycles:
+;   - 15 to set up its registers;
+;   - 15 for each of the first three passes (10 for the body, plus 5 for the
+;     taken JPB);
+;   - 14 for the final pass (10 for the body, plus 4 for the JPB falling
+;     through);
+;   - 8 to return.
+; That is, 15 + (3 * 15) + 14 + 8 = 82 M-cycles. The entry point adds 12 for
+; the CALL and 8 for its own return, for 102 M-cycles.
+
+.global main
+
+.org 0x00002000
+
+main:
+    call nc, sum_table
+    ret
+
+sum_table:
+    ld d0, 0
+    ld d1, table
+    ld l2, 4
+sum_loop:
+    add d0, [d1]
+    inc d1
+    dec l2
+    jpb zc, sum_loop
+    ret
+
+table:
+    .byte 1, 2, 3, 4
@@ -0,0 +1,29 @@
+; Test 02: Unprefixed Loop Header Address (Error)
+; Tests: An annotation whose header address lacks its '$' or '0x' prefix
+;
+; The program is that of test 01, but `02-error-unprefixed-address.loops`
+; writes the loop's header address as `2017`. Rather than reading it as the
+; decimal address $000007E1 and leaving the loop unbounded, the analyzer must
+; reject the annotation file.
+
+.global main
+
+.org 0x00002000
+
+main:
+    call nc, sum_table
+    ret
+
+sum_table:
+    ld d0, 0
+    ld d1, table
+    ld l2, 4
+sum_loop:
+    add d0, [d1]
+    inc d1
+    dec l2
+    jpb zc, sum_loop
+    ret
+
+table:
+    .byte 1, 2, 3, 4
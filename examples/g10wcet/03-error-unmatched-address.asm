@@ -0,0 +1,29 @@
+; Test 03: Unmatched Loop Header Address (Error)
+; Tests: An annotation whose header address names no loop
+;
+; The program is that of test 01, but `03-error-unmatched-address.loops`
+; bounds a loop at $00002015, which lies within the subroutine's set-up code.
+; The analyzer must report that annotation as an error, rather than silently
+; ignoring it and leaving the real loop unbounded.
+
+.global main
+
+.org 0x00002000
+
+main:
+    call nc, sum_table
+    ret
+
+sum_table:
+    ld d0, 0
+    ld d1, table
+    ld l2, 4
+sum_loop:
+    add d0, [d1]
+    inc d1
+    dec l2
+    jpb zc, sum_loop
+    ret
+
+table:
+    .byte 1, 2, 3, 4
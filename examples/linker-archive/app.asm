@@ -0,0 +1,18 @@
+; Archive Linking: Application Module
+; Tests: Pulling archive members in to define an external symbol
+;
+; Calls the library's checksum routine, which is defined by a member of the
+; library archive rather than by an object file given to the linker.
+
+.org 0x00002000
+
+; Defined by `checksum.asm`, in the library archive
+.extern checksum
+
+.global main
+
+main:
+    ld l0, 0x12             ; First byte
+    ld l1, 0x34             ; Second byte
+    call nc, checksum       ; Result in L0
+    halt
@@ -0,0 +1,19 @@
+; Archive Linking: Library Module - Checksum
+; Tests: An archive member pulled in by an object file, which in turn needs
+;        another member of the same archive
+;
+; Provides the checksum routine, built on the library's fold routine.
+
+.org 0x00002100
+
+; Defined by `fold.asm`, in the same archive
+.extern fold_byte
+
+.global checksum
+
+; Function: checksum
+; Input: L0 = first byte, L1 = second byte
+; Output: L0 = checksum of both bytes
+checksum:
+    call nc, fold_byte
+    ret
@@ -0,0 +1,15 @@
+; Archive Linking: Library Module - Fold
+; Tests: An archive member pulled in only by another archive member
+;
+; Provides the fold routine.
+
+.org 0x00002100
+
+.global fold_byte
+
+; Function: fold_byte
+; Input: L0 = first byte, L1 = second byte
+; Output: L0 = first byte + second byte
+fold_byte:
+    add l0, l1
+    ret
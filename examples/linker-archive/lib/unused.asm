@@ -0,0 +1,15 @@
+; Archive Linking: Library Module - Unused
+; Tests: An archive member which no linked object needs, and which must be
+;        left out of the program
+;
+; Provides a routine the application never calls.
+
+.org 0x00002100
+
+.global unused_routine
+
+; Function: unused_routine
+; Does nothing.
+unused_routine:
+    nop
+    ret
@@ -0,0 +1,22 @@
+; Incremental Linking: Application Module
+; Tests: The module left unchanged while the bias module is edited
+;
+; Calls the bias module's subroutine, and stores its result in RAM.
+
+.org 0x80000000
+
+.global app_result
+app_result:
+.dword 1
+
+.org 0x00002000
+
+.extern bias
+
+.global main
+
+main:
+    ld d0, 21
+    call nc, bias           ; D0 = biased value
+    st [app_result], d0
+    halt
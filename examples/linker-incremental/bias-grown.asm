@@ -0,0 +1,18 @@
+; Incremental Linking: Bias Module, Grown
+; Tests: An edit which outgrows the module's section, forcing a full link
+;
+; Provides a subroutine which adds two to its input, then one more. The extra
+; instruction no longer fits the section's recorded slot.
+
+.org 0x00002100
+
+.global bias
+
+; Function: bias
+; Input: D0 = value
+; Output: D0 = value + 3
+bias:
+    ld d1, 2
+    add d0, d1
+    inc d0
+    ret
@@ -0,0 +1,19 @@
+; Incremental Linking: Bias Module, New Interface
+; Tests: An edit which exports another symbol, forcing a full link
+;
+; Provides a subroutine which adds two to its input, and exports a second
+; name for it.
+
+.org 0x00002100
+
+.global bias
+.global add_two
+
+; Function: bias
+; Input: D0 = value
+; Output: D0 = value + 2
+bias:
+add_two:
+    ld d1, 2
+    add d0, d1
+    ret
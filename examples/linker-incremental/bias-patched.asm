@@ -0,0 +1,17 @@
+; Incremental Linking: Bias Module, Patched
+; Tests: An edit which keeps the module's layout, relinked in place
+;
+; Provides a subroutine which adds three to its input. Only an immediate value
+; changes, so the module's section keeps its size.
+
+.org 0x00002100
+
+.global bias
+
+; Function: bias
+; Input: D0 = value
+; Output: D0 = value + 3
+bias:
+    ld d1, 3
+    add d0, d1
+    ret
@@ -0,0 +1,16 @@
+; Incremental Linking: Bias Module
+; Tests: The module as first linked
+;
+; Provides a subroutine which adds two to its input.
+
+.org 0x00002100
+
+.global bias
+
+; Function: bias
+; Input: D0 = value
+; Output: D0 = value + 2
+bias:
+    ld d1, 2
+    add d0, d1
+    ret
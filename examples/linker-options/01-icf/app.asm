@@ -0,0 +1,18 @@
+; Linker Option --icf: Application Module
+; Tests: Folding identical read-only sections into a single copy
+;
+; Calls two routines from two other modules. Their sections are identical, so
+; `--icf` keeps only the first, and both calls target it.
+
+.org 0x00002000
+
+.extern add_seven_a
+.extern add_seven_b
+
+.global main
+
+main:
+    ld d1, 1
+    call nc, add_seven_a    ; Calls $00002100
+    call nc, add_seven_b    ; Also calls $00002100, once folded
+    halt
@@ -0,0 +1,16 @@
+; Linker Option --icf: First Routine Module
+; Tests: The copy which identical sections are folded into
+;
+; Placed at $00002100.
+
+.org 0x00002100
+
+.global add_seven_a
+
+; Function: add_seven_a
+; Input: D1 = value
+; Output: D0 = value + 7
+add_seven_a:
+    ld d0, 7
+    add d0, d1
+    ret
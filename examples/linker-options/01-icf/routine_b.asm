@@ -0,0 +1,17 @@
+; Linker Option --icf: Second Routine Module
+; Tests: A section identical to another, which is folded into it
+;
+; Without `--icf`, this would be placed after the first routine module's
+; section; with it, it takes no space at all.
+
+.org 0x00002100
+
+.global add_seven_b
+
+; Function: add_seven_b
+; Input: D1 = value
+; Output: D0 = value + 7
+add_seven_b:
+    ld d0, 7
+    add d0, d1
+    ret
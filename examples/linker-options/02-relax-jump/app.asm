@@ -0,0 +1,19 @@
+; Linker Relaxation of JP: Application Module
+; Tests: Rewriting a `jp` to an external label into a `jpb`
+;
+; The near routine lies within reach of a signed 16-bit offset, so its `jp`
+; (`JMP`, six bytes) is rewritten into a `JPB` with its offset, followed by a
+; `NOP`. The remote routine is out of reach, so its `jp` keeps the absolute
+; form.
+
+.org 0x00002000
+
+.extern near_routine
+.extern remote_routine
+
+.global main
+
+main:
+    cmp l0, 0
+    jp zs, remote_routine   ; Stays `JMP ZS, $00012000`
+    jp nc, near_routine     ; Becomes `JPB NC, $00F4`, then `NOP`
@@ -0,0 +1,11 @@
+; Linker Relaxation of JP: Near Module
+; Tests: A jump target within reach of a relative jump
+;
+; Placed at $00002100.
+
+.org 0x00002100
+
+.global near_routine
+
+near_routine:
+    halt
@@ -0,0 +1,11 @@
+; Linker Relaxation of JP: Remote Module
+; Tests: A jump target out of reach of a relative jump
+;
+; Placed at $00012000, more than 32 KiB past the jumps to it.
+
+.org 0x00012000
+
+.global remote_routine
+
+remote_routine:
+    halt
@@ -0,0 +1,26 @@
+; Linker Quick and Port Relocations: Application Module
+; Tests: Relocating `ldq`/`stq` and `ldp`/`stp` of external symbols
+;
+; The counter is placed in quick RAM (at or above $FFFF0000), so its `ldq` and
+; `stq` carry `QUICK16` relocations, resolved to 16-bit offsets. The status
+; port is placed in the port range (at or above $FFFFFF00), so its `ldp` and
+; `stp` carry `PORT8` relocations, resolved to 8-bit offsets. The total lies
+; in ordinary RAM, so its `ld` and `st` carry 32-bit addresses.
+
+.org 0x00002000
+
+.extern counter
+.extern status
+.extern total
+
+.global main
+
+main:
+    ldq l0, [counter]       ; Becomes `LDQ L0, [$0010]`
+    inc l0
+    stq [counter], l0       ; Becomes `STQ [$0010], L0`
+    ldp l1, [status]        ; Becomes `LDP L1, [$20]`
+    stp [status], l1        ; Becomes `STP [$20], L1`
+    st [total], l0          ; Becomes `ST [$80000000], L0`
+    ld l2, [total]          ; Becomes `LD L2, [$80000000]`
+    halt
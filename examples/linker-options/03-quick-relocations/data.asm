@@ -0,0 +1,23 @@
+; Linker Quick and Port Relocations: Data Module
+; Tests: Symbols in quick RAM, in the port range and in ordinary RAM
+;
+; Defines the total at $80000000, the counter at $FFFF0010, in quick RAM, and
+; the status port at $FFFFFF20.
+
+.org 0x80000000
+
+.global total
+total:
+.byte 1
+
+.org 0xFFFF0010
+
+.global counter
+counter:
+.byte 1
+
+.org 0xFFFFFF20
+
+.global status
+status:
+.byte 1
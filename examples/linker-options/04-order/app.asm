@@ -0,0 +1,18 @@
+; Linker Option --order: Application Module
+; Tests: Laying out ROM by a section ordering
+;
+; Calls an initialization routine and a frequently-run routine. The ordering
+; file packs the hot routine's section first in ROM, at $00002000, and marks
+; this module's own section as cold, packing it last.
+
+.org 0x00002000
+
+.extern init_routine
+.extern hot_routine
+
+.global main
+
+main:
+    call nc, init_routine   ; Calls $00002100, where it would be anyway
+    call nc, hot_routine    ; Calls $00002000, instead of $00002200
+    halt
@@ -0,0 +1,9 @@
+; Linker Option --order: Hot Routine Module
+; Tests: A section named by the ordering, packed at the start of ROM
+
+.org 0x00002200
+
+.global hot_routine
+
+hot_routine:
+    ret
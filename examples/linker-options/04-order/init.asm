@@ -0,0 +1,11 @@
+; Linker Option --order: Initialization Routine Module
+; Tests: A section not named by the ordering, which keeps its usual place
+;
+; Placed at $00002100, after the hot section and before the cold ones.
+
+.org 0x00002100
+
+.global init_routine
+
+init_routine:
+    ret
@@ -0,0 +1,34 @@
+; Linker Option --gc-sections: Application Module
+; Tests: Dropping the sections no relocation reaches, section by section
+;
+; Calls a local helper in another of this module's sections, and a routine in
+; another module. The section holding the unused routine is dropped, even
+; though the rest of this module is kept.
+
+.org 0x00002000
+
+.extern checksum
+
+.global main
+
+main:
+    call nc, helper         ; Calls $00002100, reached through a relocation
+    call nc, checksum       ; Calls $00002200, where it would be anyway
+    halt
+
+.org 0x00002100
+
+; Function: helper
+; Output: D0 = 1
+helper:
+    ld d0, 1
+    ret
+
+.org 0x00002200
+
+; Function: unused_routine
+; Never called; its section is dropped, and the next module's section takes
+; its place.
+unused_routine:
+    ld d0, 2
+    ret
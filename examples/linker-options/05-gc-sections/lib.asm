@@ -0,0 +1,27 @@
+; Linker Option --gc-sections: Library Module
+; Tests: A section reached from another module, and a global one which is not
+;
+; Without `--gc-sections`, the checksum routine would be placed after the
+; application module's unused routine, and the unused global routine would be
+; linked as well.
+
+.org 0x00002200
+
+.global checksum
+.global unused_global
+
+; Function: checksum
+; Input: D1 = value
+; Output: D0 = value + 3
+checksum:
+    ld d0, 3
+    add d0, d1
+    ret
+
+.org 0x00002300
+
+; Function: unused_global
+; Exported, but never called; its section is dropped.
+unused_global:
+    ld d0, 4
+    ret
@@ -0,0 +1,19 @@
+; Linker Option --icf: Application Module
+; Tests: Folding sections whose relocations resolve to identical sections
+;
+; Calls two routines from two other modules. Each routine loads the address of
+; a table in another of its module's sections. The tables are identical, so
+; `--icf` folds the second into the first; the routines then refer to the same
+; table, so the second routine is folded into the first as well.
+
+.org 0x00002000
+
+.extern table_address_a
+.extern table_address_b
+
+.global main
+
+main:
+    call nc, table_address_a    ; Calls $00002100
+    call nc, table_address_b    ; Also calls $00002100, once folded
+    halt
@@ -0,0 +1,19 @@
+; Linker Option --icf: First Routine Module
+; Tests: The copies which identical sections are folded into
+;
+; Placed at $00002100, with its table at $00002200.
+
+.org 0x00002100
+
+.global table_address_a
+
+; Function: table_address_a
+; Output: D0 = address of this module's table
+table_address_a:
+    ld d0, table_a
+    ret
+
+.org 0x00002200
+
+table_a:
+.byte 1, 2, 4, 8
@@ -0,0 +1,20 @@
+; Linker Option --icf: Second Routine Module
+; Tests: Sections identical to others once their targets are folded
+;
+; Without `--icf`, these would be placed after the first routine module's
+; sections; with it, they take no space at all.
+
+.org 0x00002100
+
+.global table_address_b
+
+; Function: table_address_b
+; Output: D0 = address of this module's table
+table_address_b:
+    ld d0, table_b
+    ret
+
+.org 0x00002200
+
+table_b:
+.byte 1, 2, 4, 8
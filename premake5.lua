@@ -57,6 +57,7 @@ workspace "2026-G10"
         symbols "Off"
     filter { "system:linux" }
         defines { "G10_LINUX" }
+        links { "pthread" }
     filter { "system:windows" }
         defines { "G10_WINDOWS" }
     filter {}
@@ -104,6 +105,18 @@ project "g10link"
     includedirs { "./projects", "./projects/g10" }
     links { "g10" }
     
+-- Project: `g10ar` - G10 Archiver Tool ----------------------------------------
+
+project "g10ar"
+    kind "ConsoleApp"
+
+    location "./build"
+    targetdir "./build/bin/%{cfg.system}-%{cfg.buildcfg}"
+    objdir "./build/obj/%{cfg.system}-%{cfg.buildcfg}/%{prj.name}"
+    files { "./projects/g10ar/**.hpp", "./projects/g10ar/**.cpp" }
+    includedirs { "./projects", "./projects/g10" }
+    links { "g10" }
+    
 -- Project: `g10tmu` - G10 Testbed Emulator ------------------------------------
 
 project "g10tmu"
@@ -115,4 +128,16 @@ project "g10tmu"
     files { "./projects/g10tmu/**.hpp", "./projects/g10tmu/**.cpp" }
     includedirs { "./projects", "./projects/g10" }
     links { "g10" }
+    
+-- Project: `g10wcet` - G10 Worst-Case Execution Time Analyzer -----------------
+
+project "g10wcet"
+    kind "ConsoleApp"
+
+    location "./build"
+    targetdir "./build/bin/%{cfg.system}-%{cfg.buildcfg}"
+    objdir "./build/obj/%{cfg.system}-%{cfg.buildcfg}/%{prj.name}"
+    files { "./projects/g10wcet/**.hpp", "./projects/g10wcet/**.cpp" }
+    includedirs { "./projects", "./projects/g10" }
+    links { "g10" }
     
\ No newline at end of file
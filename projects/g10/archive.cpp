@@ -0,0 +1,513 @@
+/**
+ * @file    g10/archive.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains implementations for the G10 static archive file, a library
+ *          of G10 object files.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/archive.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10
+{
+    /**
+     * @brief   FNV-1a 32-bit parameters, used to hash symbol names for the
+     *          archive's symbol index.
+     */
+    constexpr std::uint32_t ARCHIVE_FNV_PRIME        = 0x01000193;
+    constexpr std::uint32_t ARCHIVE_FNV_OFFSET_BASIS = 0x811C9DC5;
+}
+
+/* Private Helper Functions ***************************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Hashes a symbol name for the archive's symbol index.
+     *
+     * @param   name    The symbol name.
+     *
+     * @return  The name's 32-bit FNV-1a hash.
+     */
+    auto hash_archive_symbol (std::string_view name) -> std::uint32_t
+    {
+        std::uint32_t hash = ARCHIVE_FNV_OFFSET_BASIS;
+        for (const char c : name)
+        {
+            hash = (hash ^ static_cast<std::uint8_t>(c)) * ARCHIVE_FNV_PRIME;
+        }
+
+        return hash;
+    }
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10
+{
+    auto archive::load_from_file (const fs::path& path) -> result<void>
+    {
+        // Clear any existing data.
+        clear();
+
+        // Open the file and read it entirely into memory. The members' object
+        // files are parsed later, and only if they are needed.
+        std::ifstream file { path, std::ios::binary | std::ios::ate };
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file '{}' for reading.",
+                path.string());
+        }
+
+        const auto file_size = static_cast<std::size_t>(file.tellg());
+        if (file_size < ARCHIVE_HEADER_SIZE)
+        {
+            return error("File '{}' is too small to be a valid archive file"
+                " ({} bytes, minimum {} bytes required).",
+                path.string(), file_size, ARCHIVE_HEADER_SIZE);
+        }
+
+        file.seekg(0, std::ios::beg);
+        m_data.resize(file_size);
+        if (!file.read(reinterpret_cast<char*>(m_data.data()), file_size))
+        {
+            clear();
+            return error("Failed to read file '{}'.", path.string());
+        }
+        file.close();
+
+        // Read and validate the header.
+        std::span<const std::uint8_t> file_data { m_data };
+        const std::uint32_t magic = read_u32_le(file_data, 0x00);
+        if (magic != ARCHIVE_MAGIC)
+        {
+            clear();
+            return error("File '{}' has invalid magic number "
+                "(expected 0x{:08X}, got 0x{:08X}).",
+                path.string(), ARCHIVE_MAGIC, magic);
+        }
+
+        const std::uint32_t version = read_u32_le(file_data, 0x04);
+        const std::uint8_t version_major = (version >> 24) & 0xFF;
+        const std::uint8_t expected_major = (ARCHIVE_VERSION >> 24) & 0xFF;
+        if (version_major != expected_major)
+        {
+            clear();
+            return error("File '{}' has incompatible major version "
+                "(expected {}, got {}).",
+                path.string(), expected_major, version_major);
+        }
+
+        const std::size_t member_count = read_u32_le(file_data, 0x08);
+        const std::size_t member_table_offset = read_u32_le(file_data, 0x0C);
+        const std::size_t index_slot_count = read_u32_le(file_data, 0x10);
+        const std::size_t index_offset = read_u32_le(file_data, 0x14);
+        const std::size_t string_table_offset = read_u32_le(file_data, 0x18);
+        const std::size_t string_table_size = read_u32_le(file_data, 0x1C);
+
+        // Validate table offsets and sizes against file size.
+        if (member_table_offset +
+                (member_count * ARCHIVE_MEMBER_ENTRY_SIZE) > file_size)
+        {
+            clear();
+            return error("Member table extends beyond file size.");
+        }
+        else if (index_offset +
+                (index_slot_count * ARCHIVE_INDEX_SLOT_SIZE) > file_size)
+        {
+            clear();
+            return error("Symbol index extends beyond file size.");
+        }
+        else if (string_table_offset + string_table_size > file_size)
+        {
+            clear();
+            return error("String table extends beyond file size.");
+        }
+        else if (std::has_single_bit(index_slot_count) == false &&
+            index_slot_count != 0)
+        {
+            clear();
+            return error("Symbol index size {} is not a power of two.",
+                index_slot_count);
+        }
+
+        m_strings.assign(
+            m_data.begin() + string_table_offset,
+            m_data.begin() + string_table_offset + string_table_size
+        );
+
+        // Read the member table.
+        m_members.reserve(member_count);
+        for (std::size_t i = 0; i < member_count; ++i)
+        {
+            const std::size_t entry_offset = member_table_offset +
+                (i * ARCHIVE_MEMBER_ENTRY_SIZE);
+            const std::size_t name_offset =
+                read_u32_le(file_data, entry_offset + 0x00);
+            const std::size_t name_length =
+                read_u32_le(file_data, entry_offset + 0x04);
+            const std::size_t data_offset =
+                read_u32_le(file_data, entry_offset + 0x08);
+            const std::size_t data_size =
+                read_u32_le(file_data, entry_offset + 0x0C);
+            if (data_offset + data_size > file_size)
+            {
+                clear();
+                return error("Member {} data extends beyond file size.", i);
+            }
+
+            m_members.push_back({
+                .name           = std::string { read_string(name_offset,
+                                    name_length) },
+                .data_offset    = data_offset,
+                .data_size      = data_size
+            });
+        }
+
+        // Read the symbol index. Lookups probe until they reach an empty slot,
+        // so a non-empty index must have one.
+        bool has_empty_slot = false;
+        m_index.reserve(index_slot_count);
+        for (std::size_t i = 0; i < index_slot_count; ++i)
+        {
+            const std::size_t slot_offset = index_offset +
+                (i * ARCHIVE_INDEX_SLOT_SIZE);
+            archive_index_slot slot {
+                .name_hash      = read_u32_le(file_data, slot_offset + 0x00),
+                .name_offset    = read_u32_le(file_data, slot_offset + 0x04),
+                .name_length    = read_u32_le(file_data, slot_offset + 0x08),
+                .member         = read_u32_le(file_data, slot_offset + 0x0C)
+            };
+
+            if (slot.member == ARCHIVE_EMPTY_SLOT)
+            {
+                has_empty_slot = true;
+            }
+            else if (slot.member >= member_count ||
+                std::size_t { slot.name_offset } + slot.name_length >
+                    m_strings.size())
+            {
+                clear();
+                return error("Symbol index slot {} is invalid.", i);
+            }
+
+            m_index.push_back(slot);
+        }
+
+        if (index_slot_count > 0 && has_empty_slot == false)
+        {
+            clear();
+            return error("Symbol index has no empty slots.");
+        }
+
+        return {};
+    }
+
+    auto archive::save_to_file (const fs::path& path) -> result<void>
+    {
+        // Build the symbol index, which also checks that every member is a
+        // valid object file.
+        auto index_result = build_index();
+        if (index_result.has_value() == false)
+        {
+            return error(index_result.error());
+        }
+
+        // Lay out the file: the header, member table, symbol index and string
+        // table, followed by each member's object file, aligned to 4 bytes.
+        // The member names follow the symbol names in the string table.
+        std::vector<std::uint8_t> strings = m_strings;
+        std::vector<std::uint32_t> name_offsets;
+        name_offsets.reserve(m_members.size());
+        for (const auto& member : m_members)
+        {
+            name_offsets.push_back(static_cast<std::uint32_t>(strings.size()));
+            strings.insert(strings.end(), member.name.begin(),
+                member.name.end());
+        }
+
+        const std::size_t member_table_offset = ARCHIVE_HEADER_SIZE;
+        const std::size_t index_offset = member_table_offset +
+            (m_members.size() * ARCHIVE_MEMBER_ENTRY_SIZE);
+        const std::size_t string_table_offset = index_offset +
+            (m_index.size() * ARCHIVE_INDEX_SLOT_SIZE);
+        std::size_t data_offset = (string_table_offset + strings.size() + 3) &
+            ~std::size_t { 3 };
+
+        std::vector<std::uint8_t> buffer(data_offset, 0);
+
+        // Write the header.
+        write_u32_le(buffer, 0x00, ARCHIVE_MAGIC);
+        write_u32_le(buffer, 0x04, ARCHIVE_VERSION);
+        write_u32_le(buffer, 0x08, static_cast<std::uint32_t>(m_members.size()));
+        write_u32_le(buffer, 0x0C, static_cast<std::uint32_t>(member_table_offset));
+        write_u32_le(buffer, 0x10, static_cast<std::uint32_t>(m_index.size()));
+        write_u32_le(buffer, 0x14, static_cast<std::uint32_t>(index_offset));
+        write_u32_le(buffer, 0x18, static_cast<std::uint32_t>(string_table_offset));
+        write_u32_le(buffer, 0x1C, static_cast<std::uint32_t>(strings.size()));
+
+        // Write the member table and the members' object files.
+        for (std::size_t i = 0; i < m_members.size(); ++i)
+        {
+            const auto& member = m_members[i];
+            const std::size_t entry_offset = member_table_offset +
+                (i * ARCHIVE_MEMBER_ENTRY_SIZE);
+            write_u32_le(buffer, entry_offset + 0x00, name_offsets[i]);
+            write_u32_le(buffer, entry_offset + 0x04,
+                static_cast<std::uint32_t>(member.name.size()));
+            write_u32_le(buffer, entry_offset + 0x08,
+                static_cast<std::uint32_t>(data_offset));
+            write_u32_le(buffer, entry_offset + 0x0C,
+                static_cast<std::uint32_t>(member.data_size));
+
+            const auto first = m_data.begin() +
+                static_cast<std::ptrdiff_t>(member.data_offset);
+            buffer.insert(buffer.end(), first,
+                first + static_cast<std::ptrdiff_t>(member.data_size));
+            data_offset += member.data_size;
+            while ((data_offset & 3) != 0)
+            {
+                buffer.push_back(0);
+                ++data_offset;
+            }
+        }
+
+        // Write the symbol index and string table.
+        for (std::size_t i = 0; i < m_index.size(); ++i)
+        {
+            const auto& slot = m_index[i];
+            const std::size_t slot_offset = index_offset +
+                (i * ARCHIVE_INDEX_SLOT_SIZE);
+            write_u32_le(buffer, slot_offset + 0x00, slot.name_hash);
+            write_u32_le(buffer, slot_offset + 0x04, slot.name_offset);
+            write_u32_le(buffer, slot_offset + 0x08, slot.name_length);
+            write_u32_le(buffer, slot_offset + 0x0C, slot.member);
+        }
+
+        std::copy(strings.begin(), strings.end(),
+            buffer.begin() + static_cast<std::ptrdiff_t>(string_table_offset));
+
+        // Write the buffer to the file.
+        std::ofstream file { path, std::ios::binary };
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file '{}' for writing.",
+                path.string());
+        }
+
+        file.write(reinterpret_cast<const char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size()));
+        if (file.good() == false)
+        {
+            return error("Failed to write file '{}'.", path.string());
+        }
+
+        return {};
+    }
+
+    auto archive::clear () -> void
+    {
+        m_data.clear();
+        m_members.clear();
+        m_index.clear();
+        m_strings.clear();
+    }
+
+    auto archive::add_member (
+        std::string_view name,
+        std::span<const std::uint8_t> data
+    ) -> result<void>
+    {
+        // Check that the data holds a valid object file.
+        object obj;
+        auto load_result = obj.load_from_buffer(data, name);
+        if (load_result.has_value() == false)
+        {
+            return error(load_result.error());
+        }
+
+        // Append the object file to the archive's data. A replaced member's
+        // old data is left unreferenced, and is not saved.
+        archive_member member {
+            .name           = std::string { name },
+            .data_offset    = m_data.size(),
+            .data_size      = data.size()
+        };
+        m_data.insert(m_data.end(), data.begin(), data.end());
+
+        auto it = std::ranges::find(m_members, member.name,
+            &archive_member::name);
+        if (it != m_members.end())
+        {
+            *it = std::move(member);
+        }
+        else
+        {
+            m_members.push_back(std::move(member));
+        }
+
+        return {};
+    }
+
+    auto archive::load_member (std::size_t index, object& obj) const
+        -> result<void>
+    {
+        if (index >= m_members.size())
+        {
+            return error("Archive member index {} is out of range.", index);
+        }
+
+        const auto& member = m_members[index];
+        return obj.load_from_buffer(
+            std::span<const std::uint8_t> { m_data }.subspan(
+                member.data_offset, member.data_size),
+            member.name
+        );
+    }
+
+    auto archive::find_symbol (std::string_view name) const
+        -> std::optional<std::size_t>
+    {
+        if (m_index.empty() == true)
+        {
+            return std::nullopt;
+        }
+
+        // Probe linearly from the name's home slot until the name, or an
+        // empty slot, is found.
+        const std::uint32_t hash = hash_archive_symbol(name);
+        const std::size_t mask = m_index.size() - 1;
+        for (std::size_t i = hash & mask; ; i = (i + 1) & mask)
+        {
+            const auto& slot = m_index[i];
+            if (slot.member == ARCHIVE_EMPTY_SLOT)
+            {
+                return std::nullopt;
+            }
+            else if (slot.name_hash == hash &&
+                read_string(slot.name_offset, slot.name_length) == name)
+            {
+                return slot.member;
+            }
+        }
+    }
+
+    auto archive::get_symbols () const
+        -> std::vector<std::pair<std::string_view, std::size_t>>
+    {
+        std::vector<std::pair<std::string_view, std::size_t>> symbols;
+        for (const auto& slot : m_index)
+        {
+            if (slot.member != ARCHIVE_EMPTY_SLOT)
+            {
+                symbols.emplace_back(
+                    read_string(slot.name_offset, slot.name_length),
+                    slot.member);
+            }
+        }
+
+        return symbols;
+    }
+
+    auto archive::is_archive (const fs::path& path) -> bool
+    {
+        std::ifstream file { path, std::ios::binary };
+        std::array<std::uint8_t, 4> magic {};
+        if (!file.read(reinterpret_cast<char*>(magic.data()), magic.size()))
+        {
+            return false;
+        }
+
+        return read_u32_le(magic, 0) == ARCHIVE_MAGIC;
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10
+{
+    auto archive::build_index () -> result<void>
+    {
+        m_index.clear();
+        m_strings.clear();
+
+        // Collect the global and weak symbols each member defines, keeping the
+        // first member to define each name.
+        std::vector<std::pair<std::string, std::uint32_t>> symbols;
+        std::unordered_set<std::string> seen;
+        for (std::size_t i = 0; i < m_members.size(); ++i)
+        {
+            object obj;
+            auto load_result = load_member(i, obj);
+            if (load_result.has_value() == false)
+            {
+                return error(load_result.error());
+            }
+
+            for (const auto& sym : obj.get_symbols())
+            {
+                if ((sym.binding == symbol_binding::global ||
+                     sym.binding == symbol_binding::weak) &&
+                    seen.insert(sym.name).second == true)
+                {
+                    symbols.emplace_back(sym.name,
+                        static_cast<std::uint32_t>(i));
+                }
+            }
+        }
+
+        if (symbols.empty() == true)
+        {
+            return {};
+        }
+
+        // Size the index to at most half full, so that probe sequences stay
+        // short and always end at an empty slot.
+        m_index.assign(std::bit_ceil(symbols.size() * 2), archive_index_slot {
+            .name_hash      = 0,
+            .name_offset    = 0,
+            .name_length    = 0,
+            .member         = ARCHIVE_EMPTY_SLOT
+        });
+
+        const std::size_t mask = m_index.size() - 1;
+        for (const auto& [name, member] : symbols)
+        {
+            const std::uint32_t hash = hash_archive_symbol(name);
+            std::size_t i = hash & mask;
+            while (m_index[i].member != ARCHIVE_EMPTY_SLOT)
+            {
+                i = (i + 1) & mask;
+            }
+
+            m_index[i] = {
+                .name_hash      = hash,
+                .name_offset    = static_cast<std::uint32_t>(m_strings.size()),
+                .name_length    = static_cast<std::uint32_t>(name.size()),
+                .member         = member
+            };
+            m_strings.insert(m_strings.end(), name.begin(), name.end());
+        }
+
+        return {};
+    }
+
+    auto archive::read_string (std::size_t offset, std::size_t length) const
+        -> std::string_view
+    {
+        if (offset + length > m_strings.size())
+        {
+            return "";
+        }
+
+        return std::string_view {
+            reinterpret_cast<const char*>(m_strings.data() + offset),
+            length
+        };
+    }
+}
@@ -0,0 +1,291 @@
+/**
+ * @file    g10/archive.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 static archive file, a library of
+ *          G10 object files.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/object.hpp>
+
+/* Public Constants and Enumerations ******************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Magic number identifying a valid G10 archive file.
+     *          Corresponds to ASCII string "G10A" in little-endian.
+     */
+    constexpr std::uint32_t ARCHIVE_MAGIC = 0x41303147;
+
+    /**
+     * @brief   Current version of the G10 archive file format.
+     *          Format: 0xMMmmPPPP (Major.Minor.Patch)
+     */
+    constexpr std::uint32_t ARCHIVE_VERSION = 0x01000000;
+
+    /**
+     * @brief   Size of the archive file header in bytes.
+     */
+    constexpr std::size_t ARCHIVE_HEADER_SIZE = 0x20;
+
+    /**
+     * @brief   Size of a member table entry in bytes.
+     */
+    constexpr std::size_t ARCHIVE_MEMBER_ENTRY_SIZE = 16;
+
+    /**
+     * @brief   Size of a symbol index slot in bytes.
+     */
+    constexpr std::size_t ARCHIVE_INDEX_SLOT_SIZE = 16;
+
+    /**
+     * @brief   Marks an unused slot in an archive's symbol index.
+     */
+    constexpr std::uint32_t ARCHIVE_EMPTY_SLOT = 0xFFFFFFFF;
+}
+
+/* Public Unions and Structures ***********************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Represents the file header of a G10 archive file.
+     *
+     * This structure matches the binary layout of the header (32 bytes).
+     */
+    struct archive_header final
+    {
+        std::uint32_t   magic;              /** @brief Magic number (0x41303147) */
+        std::uint32_t   version;            /** @brief Format version */
+        std::uint32_t   member_count;       /** @brief Number of member entries */
+        std::uint32_t   member_table_offset;/** @brief Offset to member table */
+        std::uint32_t   index_slot_count;   /** @brief Number of symbol index slots (a power of two, or zero) */
+        std::uint32_t   index_offset;       /** @brief Offset to symbol index */
+        std::uint32_t   string_table_offset;/** @brief Offset to string table */
+        std::uint32_t   string_table_size;  /** @brief Size of string table (bytes) */
+    };
+
+    static_assert(sizeof(archive_header) == ARCHIVE_HEADER_SIZE,
+        "archive_header size mismatch");
+
+    /**
+     * @brief   Represents a member table entry in a G10 archive file.
+     *
+     * This structure matches the binary layout of a member entry (16 bytes).
+     */
+    struct archive_member_entry final
+    {
+        std::uint32_t   name_offset;        /** @brief Offset into string table */
+        std::uint32_t   name_length;        /** @brief Length of member name */
+        std::uint32_t   data_offset;        /** @brief Offset to member's object file */
+        std::uint32_t   data_size;          /** @brief Size of member's object file */
+    };
+
+    static_assert(sizeof(archive_member_entry) == ARCHIVE_MEMBER_ENTRY_SIZE,
+        "archive_member_entry size mismatch");
+
+    /**
+     * @brief   Represents a slot in a G10 archive file's symbol index, an
+     *          open-addressed hash table keyed by global symbol name.
+     *
+     * This structure matches the binary layout of an index slot (16 bytes).
+     */
+    struct archive_index_slot final
+    {
+        std::uint32_t   name_hash;          /** @brief FNV-1a hash of the symbol name */
+        std::uint32_t   name_offset;        /** @brief Offset into string table */
+        std::uint32_t   name_length;        /** @brief Length of symbol name */
+        std::uint32_t   member;             /** @brief Index of defining member, or `ARCHIVE_EMPTY_SLOT` */
+    };
+
+    static_assert(sizeof(archive_index_slot) == ARCHIVE_INDEX_SLOT_SIZE,
+        "archive_index_slot size mismatch");
+
+    /**
+     * @brief   Represents a member of an archive (in-memory representation).
+     */
+    struct archive_member final
+    {
+        std::string     name;               /** @brief Member name */
+        std::size_t     data_offset;        /** @brief Offset of the object file within the archive's data */
+        std::size_t     data_size;          /** @brief Size of the object file */
+    };
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Defines a class representing a static archive file, created by
+     *          the G10 archiver tool (`g10ar`) from a set of object files, and
+     *          searched by the G10 linker tool (`g10link`).
+     *
+     * An archive bundles its members' object files unchanged, along with a
+     * prebuilt index from each global symbol defined by a member to that
+     * member. The linker consults the index to find the members which define
+     * its undefined symbols, and only parses and links those members.
+     */
+    class g10api archive final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   The default constructor constructs a blank G10 archive file.
+         */
+        archive () = default;
+
+        /**
+         * @brief   The default destructor.
+         */
+        ~archive () = default;
+
+        /**
+         * @brief   Loads the G10 archive file from a file located at the given
+         *          path. The members are not parsed until they are loaded.
+         *
+         * @param   path    The path to the G10 archive file to load.
+         *
+         * @return  If loaded successfully and is valid, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto load_from_file (const fs::path& path) -> result<void>;
+
+        /**
+         * @brief   Saves the G10 archive file, building its symbol index, to a
+         *          file located at the given path.
+         *
+         * Where several members define the same global symbol, the index
+         * refers to the first of them.
+         *
+         * @param   path    The path to save the G10 archive file to.
+         *
+         * @return  If saved successfully, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto save_to_file (const fs::path& path) -> result<void>;
+
+        /**
+         * @brief   Clears the archive, resetting it to an empty state.
+         */
+        auto clear () -> void;
+
+        /**
+         * @brief   Adds an object file to the archive as a new member. If a
+         *          member with the same name exists, it is replaced.
+         *
+         * @param   name    The member's name.
+         * @param   data    The contents of the object file.
+         *
+         * @return  If the data holds a valid object file, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto add_member (
+            std::string_view name,
+            std::span<const std::uint8_t> data
+        ) -> result<void>;
+
+        /**
+         * @brief   Loads one of the archive's members into an object.
+         *
+         * @param   index   The index of the member.
+         * @param   obj     Output: the member's object file.
+         *
+         * @return  If loaded successfully and is valid, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto load_member (std::size_t index, object& obj) const
+            -> result<void>;
+
+        /**
+         * @brief   Looks up a global symbol in the archive's symbol index.
+         *
+         * @param   name    The name of the symbol.
+         *
+         * @return  If a member defines the symbol, returns that member's index;
+         *          Otherwise, returns `std::nullopt`.
+         */
+        auto find_symbol (std::string_view name) const
+            -> std::optional<std::size_t>;
+
+        /**
+         * @brief   Retrieves the archive's members.
+         *
+         * @return  A constant reference to the vector of members.
+         */
+        inline auto get_members () const -> const std::vector<archive_member>&
+            { return m_members; }
+
+        /**
+         * @brief   Retrieves the global symbols in the archive's symbol index,
+         *          with the index of the member defining each, in index order.
+         *
+         * @return  The indexed symbols.
+         */
+        auto get_symbols () const
+            -> std::vector<std::pair<std::string_view, std::size_t>>;
+
+        /**
+         * @brief   Checks whether the file at the given path begins with the
+         *          archive magic number.
+         *
+         * @param   path    The path to the file.
+         *
+         * @return  `true` if the file looks like an archive; `false` otherwise.
+         */
+        static auto is_archive (const fs::path& path) -> bool;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Builds the symbol index from the members' global and weak
+         *          symbols.
+         *
+         * @return  If every member could be parsed, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto build_index () -> result<void>;
+
+        /**
+         * @brief   Retrieves a string from the archive's string table.
+         *
+         * @param   offset  The offset of the string within the table.
+         * @param   length  The length of the string.
+         *
+         * @return  The string, or an empty string if it lies outside the
+         *          table.
+         */
+        auto read_string (std::size_t offset, std::size_t length) const
+            -> std::string_view;
+
+    private: /* Private Members ***********************************************/
+
+        /**
+         * @brief   The archive's data: as loaded from a file, or the contents
+         *          of the object files added to it.
+         */
+        std::vector<std::uint8_t> m_data;
+
+        /**
+         * @brief   The archive's members, in the order they were added.
+         */
+        std::vector<archive_member> m_members;
+
+        /**
+         * @brief   The symbol index's slots.
+         */
+        std::vector<archive_index_slot> m_index;
+
+        /**
+         * @brief   The string table holding the names of the indexed symbols.
+         */
+        std::vector<std::uint8_t> m_strings;
+
+    };
+}
@@ -12,15 +12,29 @@
 /* Public Includes ************************************************************/
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <deque>
 #include <expected>
 #include <filesystem>
 #include <fstream>
 #include <format>
+#include <functional>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <print>
+#include <random>
+#include <set>
 #include <span>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -29,6 +43,7 @@
 #include <cctype>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 /* Public Macros - Library Import/Export **************************************/
@@ -31,6 +31,158 @@ namespace g10
      *          register.
      */
     static constexpr std::uint32_t DEFAULT_SP = 0xFFFFFFFF;
+
+    /**
+     * @brief   The execution time, in M-cycles, of an unconditional `RET`
+     *          instruction. Unlike other branches, this is shorter than the
+     *          time taken by a conditional `RET` whose condition is met.
+     */
+    static constexpr std::uint8_t RET_UNCONDITIONAL_CYCLES = 8;
+
+    /**
+     * @brief   The length and timing of each instruction, indexed by the upper
+     *          byte of its opcode, as listed in the instruction tables of the
+     *          G10 CPU specification (`docs/g10cpu.spec.md`).
+     */
+    static constexpr auto INSTRUCTION_TIMINGS = []
+    {
+        std::array<instruction_timing, 256> timings {};
+        timings[0x00] = { 2,  2,  2 };  // `NOP`
+        timings[0x01] = { 2,  2,  2 };  // `STOP`
+        timings[0x02] = { 2,  2,  2 };  // `HALT`
+        timings[0x03] = { 2,  2,  2 };  // `DI`
+        timings[0x04] = { 2,  2,  2 };  // `EI`
+        timings[0x05] = { 2,  2,  2 };  // `EII`
+        timings[0x06] = { 2,  2,  2 };  // `DAA`
+        timings[0x07] = { 2,  2,  2 };  // `SCF`
+        timings[0x08] = { 2,  2,  2 };  // `CCF`
+        timings[0x09] = { 2,  2,  2 };  // `CLV`
+        timings[0x0A] = { 2,  2,  2 };  // `SEV`
+        timings[0x10] = { 3,  3,  3 };  // `LD LX, IMM8`
+        timings[0x11] = { 6,  7,  7 };  // `LD LX, [ADDR32]`
+        timings[0x12] = { 2,  3,  3 };  // `LD LX, [DY]`
+        timings[0x13] = { 4,  5,  5 };  // `LDQ LX, [ADDR16]`
+        timings[0x14] = { 2,  3,  3 };  // `LDQ LX, [WY]`
+        timings[0x15] = { 3,  4,  4 };  // `LDP LX, [ADDR8]`
+        timings[0x16] = { 2,  3,  3 };  // `LDP LX, [LY]`
+        timings[0x17] = { 6,  7,  7 };  // `ST [ADDR32], LY`
+        timings[0x18] = { 2,  3,  3 };  // `ST [DX], LY`
+        timings[0x19] = { 4,  5,  5 };  // `STQ [ADDR16], LY`
+        timings[0x1A] = { 2,  3,  3 };  // `STQ [WX], LY`
+        timings[0x1B] = { 3,  4,  4 };  // `STP [ADDR8], LY`
+        timings[0x1C] = { 2,  3,  3 };  // `STP [LX], LY`
+        timings[0x1D] = { 2,  2,  2 };  // `MV LX, LY`
+        timings[0x1E] = { 2,  2,  2 };  // `MV HX, LY`
+        timings[0x1F] = { 2,  2,  2 };  // `MV LX, HY`
+        timings[0x20] = { 4,  4,  4 };  // `LD WX, IMM16`
+        timings[0x21] = { 6,  8,  8 };  // `LD WX, [ADDR32]`
+        timings[0x22] = { 2,  4,  4 };  // `LD WX, [DY]`
+        timings[0x23] = { 4,  6,  6 };  // `LDQ WX, [ADDR16]`
+        timings[0x24] = { 2,  4,  4 };  // `LDQ WX, [WY]`
+        timings[0x27] = { 6,  8,  8 };  // `ST [ADDR32], WY`
+        timings[0x28] = { 2,  4,  4 };  // `ST [DX], WY`
+        timings[0x29] = { 4,  6,  6 };  // `STQ [ADDR16], WY`
+        timings[0x2A] = { 2,  4,  4 };  // `STQ [WX], WY`
+        timings[0x2D] = { 2,  2,  2 };  // `MV WX, WY`
+        timings[0x2E] = { 2,  2,  2 };  // `MWH DX, WY`
+        timings[0x2F] = { 2,  2,  2 };  // `MWL WX, DY`
+        timings[0x30] = { 6,  6,  6 };  // `LD DX, IMM32`
+        timings[0x31] = { 6, 10, 10 };  // `LD DX, [ADDR32]`
+        timings[0x32] = { 2,  6,  6 };  // `LD DX, [DY]`
+        timings[0x33] = { 4,  8,  8 };  // `LDQ DX, [ADDR16]`
+        timings[0x34] = { 2,  6,  6 };  // `LDQ DX, [WY]`
+        timings[0x35] = { 6,  7,  7 };  // `LSP IMM32`
+        timings[0x36] = { 2,  7,  7 };  // `POP DX`
+        timings[0x37] = { 6, 10, 10 };  // `ST [ADDR32], DY`
+        timings[0x38] = { 2,  6,  6 };  // `ST [DX], DY`
+        timings[0x39] = { 4,  8,  8 };  // `STQ [ADDR16], DY`
+        timings[0x3A] = { 2,  6,  6 };  // `STQ [WX], DY`
+        timings[0x3B] = { 6,  7,  7 };  // `SSP [ADDR32]`
+        timings[0x3C] = { 2,  7,  7 };  // `PUSH DY`
+        timings[0x3D] = { 2,  2,  2 };  // `MV DX, DY`
+        timings[0x3E] = { 2,  2,  2 };  // `SPO DX`
+        timings[0x3F] = { 2,  3,  3 };  // `SPI DY`
+        timings[0x40] = { 6,  6,  7 };  // `JMP X, IMM32`
+        timings[0x41] = { 2,  2,  3 };  // `JMP X, DY`
+        timings[0x42] = { 4,  4,  5 };  // `JPB X, SIMM16`
+        timings[0x43] = { 6,  6, 12 };  // `CALL X, IMM32`
+        timings[0x44] = { 2,  8,  8 };  // `INT XX`
+        timings[0x45] = { 2,  3,  9 };  // `RET X`
+        timings[0x46] = { 2,  8,  8 };  // `RETI`
+        timings[0x50] = { 3,  3,  3 };  // `ADD L0, IMM8`
+        timings[0x51] = { 2,  2,  2 };  // `ADD L0, LY`
+        timings[0x52] = { 2,  3,  3 };  // `ADD L0, [DY]`
+        timings[0x53] = { 3,  3,  3 };  // `ADC L0, IMM8`
+        timings[0x54] = { 2,  2,  2 };  // `ADC L0, LY`
+        timings[0x55] = { 2,  3,  3 };  // `ADC L0, [DY]`
+        timings[0x56] = { 3,  3,  3 };  // `SUB L0, IMM8`
+        timings[0x57] = { 2,  2,  2 };  // `SUB L0, LY`
+        timings[0x58] = { 2,  3,  3 };  // `SUB L0, [DY]`
+        timings[0x59] = { 3,  3,  3 };  // `SBC L0, IMM8`
+        timings[0x5A] = { 2,  2,  2 };  // `SBC L0, LY`
+        timings[0x5B] = { 2,  3,  3 };  // `SBC L0, [DY]`
+        timings[0x5C] = { 2,  2,  2 };  // `INC LX`
+        timings[0x5D] = { 2,  4,  4 };  // `INC [DX]`
+        timings[0x5E] = { 2,  2,  2 };  // `DEC LX`
+        timings[0x5F] = { 2,  4,  4 };  // `DEC [DX]`
+        timings[0x60] = { 4,  5,  5 };  // `ADD W0, IMM16`
+        timings[0x61] = { 2,  3,  3 };  // `ADD W0, WY`
+        timings[0x62] = { 6,  9,  9 };  // `ADD D0, IMM32`
+        timings[0x63] = { 2,  5,  5 };  // `ADD D0, DY`
+        timings[0x64] = { 4,  5,  5 };  // `SUB W0, IMM16`
+        timings[0x65] = { 2,  3,  3 };  // `SUB W0, WY`
+        timings[0x66] = { 6,  9,  9 };  // `SUB D0, IMM32`
+        timings[0x67] = { 2,  5,  5 };  // `SUB D0, DY`
+        timings[0x6C] = { 2,  3,  3 };  // `INC WX`
+        timings[0x6D] = { 2,  5,  5 };  // `INC DX`
+        timings[0x6E] = { 2,  3,  3 };  // `DEC WX`
+        timings[0x6F] = { 2,  5,  5 };  // `DEC DX`
+        timings[0x70] = { 3,  3,  3 };  // `AND L0, IMM8`
+        timings[0x71] = { 2,  2,  2 };  // `AND L0, LY`
+        timings[0x72] = { 2,  3,  3 };  // `AND L0, [DY]`
+        timings[0x73] = { 3,  3,  3 };  // `OR L0, IMM8`
+        timings[0x74] = { 2,  2,  2 };  // `OR L0, LY`
+        timings[0x75] = { 2,  3,  3 };  // `OR L0, [DY]`
+        timings[0x76] = { 3,  3,  3 };  // `XOR L0, IMM8`
+        timings[0x77] = { 2,  2,  2 };  // `XOR L0, LY`
+        timings[0x78] = { 2,  3,  3 };  // `XOR L0, [DY]`
+        timings[0x79] = { 2,  2,  2 };  // `NOT LX`
+        timings[0x7A] = { 2,  4,  4 };  // `NOT [DX]`
+        timings[0x7D] = { 3,  3,  3 };  // `CMP L0, IMM8`
+        timings[0x7E] = { 2,  2,  2 };  // `CMP L0, LY`
+        timings[0x7F] = { 2,  3,  3 };  // `CMP L0, [DY]`
+        timings[0x80] = { 2,  2,  2 };  // `SLA LX`
+        timings[0x81] = { 2,  4,  4 };  // `SLA [DX]`
+        timings[0x82] = { 2,  2,  2 };  // `SRA LX`
+        timings[0x83] = { 2,  4,  4 };  // `SRA [DX]`
+        timings[0x84] = { 2,  2,  2 };  // `SRL LX`
+        timings[0x85] = { 2,  4,  4 };  // `SRL [DX]`
+        timings[0x86] = { 2,  2,  2 };  // `SWAP LX`
+        timings[0x87] = { 2,  4,  4 };  // `SWAP [DX]`
+        timings[0x88] = { 2,  2,  2 };  // `SWAP WX`
+        timings[0x89] = { 2,  2,  2 };  // `SWAP DX`
+        timings[0x90] = { 2,  2,  2 };  // `RLA`
+        timings[0x91] = { 2,  2,  2 };  // `RL LX`
+        timings[0x92] = { 2,  4,  4 };  // `RL [DX]`
+        timings[0x93] = { 2,  2,  2 };  // `RLCA`
+        timings[0x94] = { 2,  2,  2 };  // `RLC LX`
+        timings[0x95] = { 2,  4,  4 };  // `RLC [DX]`
+        timings[0x96] = { 2,  2,  2 };  // `RRA`
+        timings[0x97] = { 2,  2,  2 };  // `RR LX`
+        timings[0x98] = { 2,  4,  4 };  // `RR [DX]`
+        timings[0x99] = { 2,  2,  2 };  // `RRCA`
+        timings[0x9A] = { 2,  2,  2 };  // `RRC LX`
+        timings[0x9B] = { 2,  4,  4 };  // `RRC [DX]`
+        timings[0xA0] = { 2,  2,  2 };  // `BIT Y, LX`
+        timings[0xA1] = { 2,  3,  3 };  // `BIT Y, [DX]`
+        timings[0xA2] = { 2,  2,  2 };  // `SET Y, LX`
+        timings[0xA3] = { 2,  4,  4 };  // `SET Y, [DX]`
+        timings[0xA4] = { 2,  2,  2 };  // `RES Y, LX`
+        timings[0xA5] = { 2,  4,  4 };  // `RES Y, [DX]`
+        timings[0xA6] = { 2,  2,  2 };  // `TOG Y, LX`
+        timings[0xA7] = { 2,  4,  4 };  // `TOG Y, [DX]`
+        return timings;
+    }();
 }
 
 /* Public Functions ***********************************************************/
@@ -421,6 +573,23 @@ namespace g10
             m_regs.irq |= (1 << vector);
         }
     }
+
+    auto cpu::timing_of (std::uint16_t opcode) -> instruction_timing
+    {
+        auto timing = INSTRUCTION_TIMINGS[opcode >> 8];
+
+        // - Branches without a condition are always taken. Their condition
+        //   code sits in the same bits for every branch instruction.
+        if (timing.cycles != timing.taken_cycles &&
+            cond(opcode) == CC_NO_CONDITION)
+        {
+            timing.cycles = ((opcode >> 8) == 0x45) ?
+                RET_UNCONDITIONAL_CYCLES : timing.taken_cycles;
+            timing.taken_cycles = timing.cycles;
+        }
+
+        return timing;
+    }
 }
 
 /* Public Methods - Hardware Registers ****************************************/
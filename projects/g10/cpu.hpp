@@ -321,6 +321,22 @@ namespace g10
         flags_register      flags;          /** @brief Flags register */
         std::uint8_t        ec;             /** @brief Exception Code (`EC`) register */
     };
+
+    /**
+     * @brief   Defines a structure describing the length and execution time of
+     *          an instruction, as documented in the G10 CPU specification.
+     * 
+     * For instructions which do not branch, `cycles` and `taken_cycles` are
+     * equal. For conditional branch instructions, `cycles` is the execution
+     * time if the branch is not taken. Unconditional branches are always
+     * taken, so both fields hold the taken execution time.
+     */
+    struct instruction_timing final
+    {
+        std::uint8_t        length;         /** @brief Length of the instruction in bytes, or `0` if the opcode is invalid */
+        std::uint8_t        cycles;         /** @brief Execution time in M-cycles, if the instruction does not branch */
+        std::uint8_t        taken_cycles;   /** @brief Execution time in M-cycles, if the instruction branches */
+    };
 }
 
 /* Public Classes *************************************************************/
@@ -435,6 +451,17 @@ namespace g10
          */
         auto request_interrupt (std::uint8_t vector) -> void;
 
+        /**
+         * @brief   Looks up the length and execution time of the instruction
+         *          with the given opcode, without executing it.
+         * 
+         * @param   opcode      The instruction's 16-bit opcode.
+         * 
+         * @return  The instruction's length and timing. If the opcode does not
+         *          encode a valid instruction, its length is `0`.
+         */
+        static auto timing_of (std::uint16_t opcode) -> instruction_timing;
+
         /**
          * @brief   Retrieves a constant reference to the CPU's register file,
          *          containing all general-purpose and special-purpose registers.
@@ -0,0 +1,330 @@
+/**
+ * @file    g10/link_state.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains implementations for the state recorded by the G10 linker
+ *          for incremental relinking.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/link_state.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10
+{
+    /**
+     * @brief   FNV-1a 64-bit parameters, used for content hashes.
+     */
+    constexpr std::uint64_t LINK_STATE_FNV_PRIME        = 0x00000100000001B3ull;
+    constexpr std::uint64_t LINK_STATE_FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+}
+
+/* Private Unions and Structures **********************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Serializes link state fields, in little-endian order, into a
+     *          growing byte buffer.
+     */
+    struct link_state_writer final
+    {
+        std::vector<std::uint8_t> buffer;
+
+        auto put_u32 (std::uint32_t value) -> void
+        {
+            const std::size_t offset = buffer.size();
+            buffer.resize(offset + 4);
+            write_u32_le(buffer, offset, value);
+        }
+
+        auto put_u64 (std::uint64_t value) -> void
+        {
+            put_u32(static_cast<std::uint32_t>(value & 0xFFFFFFFF));
+            put_u32(static_cast<std::uint32_t>(value >> 32));
+        }
+
+        auto put_string (std::string_view str) -> void
+        {
+            put_u32(static_cast<std::uint32_t>(str.size()));
+            buffer.insert(buffer.end(), str.begin(), str.end());
+        }
+    };
+
+    /**
+     * @brief   Deserializes link state fields from a byte buffer. A read past
+     *          the end of the buffer leaves the reader failed, and yields
+     *          zeroes from then on.
+     */
+    struct link_state_reader final
+    {
+        std::span<const std::uint8_t> buffer;
+        std::size_t offset = 0;
+        bool failed = false;
+
+        auto get_u32 () -> std::uint32_t
+        {
+            if (failed == true || buffer.size() - offset < 4)
+            {
+                failed = true;
+                return 0;
+            }
+
+            const std::uint32_t value = read_u32_le(buffer, offset);
+            offset += 4;
+            return value;
+        }
+
+        auto get_u64 () -> std::uint64_t
+        {
+            const std::uint64_t lo = get_u32();
+            const std::uint64_t hi = get_u32();
+            return lo | (hi << 32);
+        }
+
+        auto get_string () -> std::string
+        {
+            const std::size_t length = get_u32();
+            if (failed == true || buffer.size() - offset < length)
+            {
+                failed = true;
+                return "";
+            }
+
+            std::string str(
+                reinterpret_cast<const char*>(buffer.data() + offset),
+                length
+            );
+            offset += length;
+            return str;
+        }
+
+        // - Reads an element count, failing if the rest of the buffer could
+        //   not possibly hold that many elements of the given minimum size.
+        auto get_count (std::size_t min_element_size) -> std::size_t
+        {
+            const std::size_t count = get_u32();
+            if (failed == true ||
+                count > (buffer.size() - offset) / min_element_size)
+            {
+                failed = true;
+                return 0;
+            }
+
+            return count;
+        }
+    };
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10
+{
+    auto link_state::load_from_file (const fs::path& path) -> result<void>
+    {
+        clear();
+
+        // Read the entire file into a buffer.
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file for reading: '{}'",
+                path.string());
+        }
+
+        const auto file_size = static_cast<std::size_t>(file.tellg());
+        std::vector<std::uint8_t> buffer(file_size);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), file_size);
+        if (file.good() == false)
+        {
+            return error("Failed to read file contents: '{}'", path.string());
+        }
+        file.close();
+
+        // Check the header.
+        link_state_reader reader { .buffer = buffer };
+        if (reader.get_u32() != LINK_STATE_MAGIC)
+        {
+            return error("Invalid link state magic number in '{}'",
+                path.string());
+        }
+        else if (reader.get_u32() != LINK_STATE_VERSION)
+        {
+            return error("Unsupported link state version in '{}'",
+                path.string());
+        }
+
+        output_hash = reader.get_u64();
+        options_hash = reader.get_u64();
+        entry_object = reader.get_u32();
+        entry_symbol = reader.get_string();
+
+        // Read the input objects.
+        objects.resize(reader.get_count(28));
+        for (auto& obj : objects)
+        {
+            obj.path = reader.get_string();
+            obj.content_hash = reader.get_u64();
+            obj.interface_hash = reader.get_u64();
+
+            obj.sections.resize(reader.get_count(24));
+            for (auto& sec : obj.sections)
+            {
+                sec.section_index = reader.get_u32();
+                sec.original_address = reader.get_u32();
+                sec.address = reader.get_u32();
+                sec.size = reader.get_u32();
+                sec.file_offset = reader.get_u32();
+                const std::uint32_t type_and_flags = reader.get_u32();
+                sec.type = static_cast<section_type>(type_and_flags & 0xFFFF);
+                sec.flags = static_cast<section_flags>(type_and_flags >> 16);
+            }
+
+            obj.relocations.resize(reader.get_count(20));
+            for (auto& reloc : obj.relocations)
+            {
+                reloc.section = reader.get_u32();
+                reloc.offset = reader.get_u32();
+                reloc.type = static_cast<relocation_type>(reader.get_u32());
+                reloc.addend = static_cast<std::int32_t>(reader.get_u32());
+                reloc.symbol = reader.get_string();
+            }
+        }
+
+        // Read the global symbol table.
+        symbols.resize(reader.get_count(12));
+        for (auto& sym : symbols)
+        {
+            sym.name = reader.get_string();
+            sym.address = reader.get_u32();
+            sym.object_index = reader.get_u32();
+        }
+
+        if (reader.failed == true || reader.offset != buffer.size())
+        {
+            clear();
+            return error("Link state file '{}' is truncated or corrupt",
+                path.string());
+        }
+
+        return {};
+    }
+
+    auto link_state::save_to_file (const fs::path& path) const -> result<void>
+    {
+        link_state_writer writer;
+
+        // Write the header.
+        writer.put_u32(LINK_STATE_MAGIC);
+        writer.put_u32(LINK_STATE_VERSION);
+        writer.put_u64(output_hash);
+        writer.put_u64(options_hash);
+        writer.put_u32(entry_object);
+        writer.put_string(entry_symbol);
+
+        // Write the input objects.
+        writer.put_u32(static_cast<std::uint32_t>(objects.size()));
+        for (const auto& obj : objects)
+        {
+            writer.put_string(obj.path);
+            writer.put_u64(obj.content_hash);
+            writer.put_u64(obj.interface_hash);
+
+            writer.put_u32(static_cast<std::uint32_t>(obj.sections.size()));
+            for (const auto& sec : obj.sections)
+            {
+                writer.put_u32(sec.section_index);
+                writer.put_u32(sec.original_address);
+                writer.put_u32(sec.address);
+                writer.put_u32(sec.size);
+                writer.put_u32(sec.file_offset);
+                writer.put_u32(
+                    static_cast<std::uint32_t>(sec.type) |
+                    (static_cast<std::uint32_t>(sec.flags) << 16));
+            }
+
+            writer.put_u32(static_cast<std::uint32_t>(obj.relocations.size()));
+            for (const auto& reloc : obj.relocations)
+            {
+                writer.put_u32(reloc.section);
+                writer.put_u32(reloc.offset);
+                writer.put_u32(static_cast<std::uint32_t>(reloc.type));
+                writer.put_u32(static_cast<std::uint32_t>(reloc.addend));
+                writer.put_string(reloc.symbol);
+            }
+        }
+
+        // Write the global symbol table.
+        writer.put_u32(static_cast<std::uint32_t>(symbols.size()));
+        for (const auto& sym : symbols)
+        {
+            writer.put_string(sym.name);
+            writer.put_u32(sym.address);
+            writer.put_u32(sym.object_index);
+        }
+
+        // Write the buffer to the file.
+        std::ofstream file(path, std::ios::binary);
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file for writing: '{}'",
+                path.string());
+        }
+
+        file.write(reinterpret_cast<const char*>(writer.buffer.data()),
+            writer.buffer.size());
+        if (file.good() == false)
+        {
+            return error("Failed to write file contents: '{}'", path.string());
+        }
+
+        return {};
+    }
+
+    auto link_state::clear () -> void
+    {
+        objects.clear();
+        symbols.clear();
+        entry_symbol.clear();
+        entry_object = 0;
+        output_hash = 0;
+        options_hash = 0;
+    }
+
+    auto link_state::hash_bytes (std::span<const std::uint8_t> buffer)
+        -> std::uint64_t
+    {
+        std::uint64_t hash = LINK_STATE_FNV_OFFSET_BASIS;
+        for (const std::uint8_t byte : buffer)
+        {
+            hash = (hash ^ byte) * LINK_STATE_FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    auto link_state::hash_file (const fs::path& path) -> result<std::uint64_t>
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file for reading: '{}'",
+                path.string());
+        }
+
+        const auto file_size = static_cast<std::size_t>(file.tellg());
+        std::vector<std::uint8_t> buffer(file_size);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), file_size);
+        if (file.good() == false)
+        {
+            return error("Failed to read file contents: '{}'", path.string());
+        }
+
+        return hash_bytes(buffer);
+    }
+}
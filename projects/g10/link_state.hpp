@@ -0,0 +1,201 @@
+/**
+ * @file    g10/link_state.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the state recorded by the G10 linker for
+ *          incremental relinking.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/object.hpp>
+
+/* Public Constants and Enumerations ******************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Magic number identifying a valid G10 link state file.
+     *          Corresponds to ASCII string "G10L" in little-endian.
+     */
+    constexpr std::uint32_t LINK_STATE_MAGIC = 0x4C303147;
+
+    /**
+     * @brief   Current version of the G10 link state file format.
+     *          Format: 0xMMmmPPPP (Major.Minor.Patch)
+     */
+    constexpr std::uint32_t LINK_STATE_VERSION = 0x01010000;
+
+    /**
+     * @brief   The extension appended to a program file's path to form the path
+     *          of its link state file.
+     */
+    constexpr std::string_view LINK_STATE_EXTENSION = ".g10inc";
+
+    /**
+     * @brief   Indicates that a linked section's data cannot be located in, or
+     *          patched within, the program file.
+     */
+    constexpr std::uint32_t LINK_STATE_NO_OFFSET = 0xFFFFFFFF;
+}
+
+/* Public Unions and Structures ***********************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Records the placement of one of an object's sections in a linked
+     *          program.
+     */
+    struct link_state_section final
+    {
+        std::uint32_t   section_index;      /** @brief Index within the object */
+        std::uint32_t   original_address;   /** @brief Address before relocation */
+        std::uint32_t   address;            /** @brief Final (relocated) address */
+        std::uint32_t   size;               /** @brief Size of the section's slot (bytes) */
+        std::uint32_t   file_offset;        /** @brief Offset of the slot in the program file, or `LINK_STATE_NO_OFFSET` */
+        section_type    type;               /** @brief Section type */
+        section_flags   flags;              /** @brief Section flags */
+    };
+
+    /**
+     * @brief   Records a relocation which references a global symbol, and so
+     *          must be applied again if that symbol moves.
+     */
+    struct link_state_relocation final
+    {
+        std::uint32_t       section;        /** @brief Index into the object's recorded sections */
+        std::uint32_t       offset;         /** @brief Byte offset within the section */
+        relocation_type     type;           /** @brief Relocation type */
+        std::int32_t        addend;         /** @brief Full addend value */
+        std::string         symbol;         /** @brief Name of the referenced symbol */
+    };
+
+    /**
+     * @brief   Records a global symbol, as resolved for relocations.
+     */
+    struct link_state_symbol final
+    {
+        std::string     name;               /** @brief Symbol name */
+        std::uint32_t   address;            /** @brief Final resolved address */
+        std::uint32_t   object_index;       /** @brief Index of the defining object */
+    };
+
+    /**
+     * @brief   Records one of the input objects of a linked program.
+     */
+    struct link_state_object final
+    {
+        std::string     path;               /** @brief Path, as given to the linker */
+        std::uint64_t   content_hash;       /** @brief Hash of the object file's contents */
+        std::uint64_t   interface_hash;     /** @brief Hash of the object's global, extern and entry symbols */
+        std::vector<link_state_section>     sections;       /** @brief The object's linked sections */
+        std::vector<link_state_relocation>  relocations;    /** @brief The object's relocations against global symbols */
+    };
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Defines a class representing the state the G10 linker records,
+     *          next to a program file it links, so that the program can later
+     *          be relinked incrementally.
+     *
+     * The state records the layout of every linked section, the resolved
+     * global symbol table, the entry point symbol and a content hash of each
+     * input object and of the program file itself. When only some objects have
+     * changed, and their sections still fit within the slots recorded for
+     * them, the program file can be patched in place: only the changed
+     * objects' sections are copied and relocated again, along with those
+     * relocations in other objects which reference a symbol that has moved.
+     */
+    class g10api link_state final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Loads the link state from a file located at the given path.
+         *
+         * @param   path    The path to the link state file to load.
+         *
+         * @return  If loaded successfully, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto load_from_file (const fs::path& path) -> result<void>;
+
+        /**
+         * @brief   Saves the link state to a file located at the given path.
+         *
+         * @param   path    The path to save the link state file to.
+         *
+         * @return  If saved successfully, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto save_to_file (const fs::path& path) const -> result<void>;
+
+        /**
+         * @brief   Clears the link state.
+         */
+        auto clear () -> void;
+
+        /**
+         * @brief   Computes the content hash of a buffer.
+         *
+         * @param   buffer  The buffer to hash.
+         *
+         * @return  The buffer's 64-bit FNV-1a hash.
+         */
+        static auto hash_bytes (std::span<const std::uint8_t> buffer)
+            -> std::uint64_t;
+
+        /**
+         * @brief   Computes the content hash of a file.
+         *
+         * @param   path    The path to the file to hash.
+         *
+         * @return  If the file could be read, returns its content hash;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto hash_file (const fs::path& path) -> result<std::uint64_t>;
+
+    public: /* Public Members *************************************************/
+
+        /**
+         * @brief   The input objects, in the order they were linked.
+         */
+        std::vector<link_state_object> objects;
+
+        /**
+         * @brief   The global symbol table, holding the definition each global
+         *          symbol name resolves to.
+         */
+        std::vector<link_state_symbol> symbols;
+
+        /**
+         * @brief   The name of the program's entry point symbol.
+         */
+        std::string entry_symbol;
+
+        /**
+         * @brief   The index of the object defining the entry point symbol.
+         */
+        std::uint32_t entry_object { 0 };
+
+        /**
+         * @brief   The content hash of the linked program file.
+         */
+        std::uint64_t output_hash { 0 };
+
+        /**
+         * @brief   A hash of the link options which shaped the program's
+         *          layout, including its section ordering.
+         */
+        std::uint64_t options_hash { 0 };
+
+    };
+}
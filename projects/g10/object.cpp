@@ -61,6 +61,7 @@ namespace g10
         m_flags = object_flags::none;
         m_sections.clear();
         m_symbols.clear();
+        m_symbol_index.clear();
         m_relocations.clear();
     }
 
@@ -79,13 +80,6 @@ namespace g10
 
         // Get file size and read entire file into memory.
         const auto file_size = static_cast<std::size_t>(file.tellg());
-        if (file_size < OBJECT_HEADER_SIZE)
-        {
-            return error("File '{}' is too small to be a valid object file"
-                " ({} bytes, minimum {} bytes required).",
-                path.string(), file_size, OBJECT_HEADER_SIZE);
-        }
-
         file.seekg(0, std::ios::beg);
         std::vector<std::uint8_t> buffer(file_size);
         if (!file.read(reinterpret_cast<char*>(buffer.data()), file_size))
@@ -94,6 +88,25 @@ namespace g10
         }
         file.close();
 
+        return load_from_buffer(buffer, path.string());
+    }
+
+    auto object::load_from_buffer (
+        std::span<const std::uint8_t> buffer,
+        std::string_view name
+    ) -> result<void>
+    {
+        // Clear any existing data.
+        clear();
+
+        const std::size_t file_size = buffer.size();
+        if (file_size < OBJECT_HEADER_SIZE)
+        {
+            return error("File '{}' is too small to be a valid object file"
+                " ({} bytes, minimum {} bytes required).",
+                name, file_size, OBJECT_HEADER_SIZE);
+        }
+
         // Create a span for safe, bounds-checked access.
         std::span<const std::uint8_t> file_data { buffer };
 
@@ -103,7 +116,7 @@ namespace g10
         {
             return error("File '{}' has invalid magic number "
                 "(expected 0x{:08X}, got 0x{:08X}).",
-                path.string(), OBJECT_MAGIC, magic);
+                name, OBJECT_MAGIC, magic);
         }
 
         const std::uint32_t version = read_u32_le(file_data, 0x04);
@@ -113,7 +126,7 @@ namespace g10
         {
             return error("File '{}' has incompatible major version "
                 "(expected {}, got {}).",
-                path.string(), expected_major, version_major);
+                name, expected_major, version_major);
         }
 
         m_flags = static_cast<object_flags>(read_u32_le(file_data, 0x08));
@@ -229,6 +242,7 @@ namespace g10
                 symbol.flags = static_cast<symbol_flags>(
                     read_u16_le(file_data, entry_offset + 0x0E));
 
+                m_symbol_index[symbol.name].push_back(m_symbols.size());
                 m_symbols.push_back(std::move(symbol));
             }
         }
@@ -430,48 +444,60 @@ namespace g10
         return m_sections.size() - 1;
     }
 
+    auto object::get_section_data (std::size_t index)
+        -> result_ref<std::vector<std::uint8_t>>
+    {
+        if (index >= m_sections.size())
+        {
+            return error("Section index {} out of range (section count: {}).",
+                index, m_sections.size());
+        }
+
+        return std::ref(m_sections[index].data);
+    }
+
     auto object::add_symbol (const object_symbol& symbol) -> result<std::size_t>
     {
-        // Check for symbol scoping rule violations.
-        for (std::size_t i = 0; i < m_symbols.size(); ++i)
+        // Check for symbol scoping rule violations against each existing
+        // symbol of the same name.
+        auto& indices = m_symbol_index[symbol.name];
+        for (const std::size_t i : indices)
         {
             const auto& existing = m_symbols[i];
-            if (existing.name == symbol.name)
+
+            // Check if existing symbol is global - cannot redefine.
+            if (existing.binding == symbol_binding::global)
             {
-                // Check if existing symbol is global - cannot redefine.
-                if (existing.binding == symbol_binding::global)
-                {
-                    return error("Cannot redefine global symbol '{}'.",
-                        symbol.name);
-                }
+                return error("Cannot redefine global symbol '{}'.",
+                    symbol.name);
+            }
 
-                // Check if new symbol is trying to define an extern.
-                if (existing.binding == symbol_binding::extern_)
+            // Check if new symbol is trying to define an extern.
+            if (existing.binding == symbol_binding::extern_)
+            {
+                if (symbol.binding != symbol_binding::extern_)
                 {
-                    if (symbol.binding != symbol_binding::extern_)
-                    {
-                        return error("Cannot define extern symbol '{}' "
-                            "within the same object file.", symbol.name);
-                    }
+                    return error("Cannot define extern symbol '{}' "
+                        "within the same object file.", symbol.name);
                 }
+            }
 
-                // Check for global/extern mutual exclusivity.
-                if ((existing.binding == symbol_binding::global &&
-                     symbol.binding == symbol_binding::extern_) ||
-                    (existing.binding == symbol_binding::extern_ &&
-                     symbol.binding == symbol_binding::global))
-                {
-                    return error("Symbol '{}' cannot be both global and "
-                        "extern.", symbol.name);
-                }
+            // Check for global/extern mutual exclusivity.
+            if ((existing.binding == symbol_binding::global &&
+                 symbol.binding == symbol_binding::extern_) ||
+                (existing.binding == symbol_binding::extern_ &&
+                 symbol.binding == symbol_binding::global))
+            {
+                return error("Symbol '{}' cannot be both global and "
+                    "extern.", symbol.name);
+            }
 
-                // Local symbols can be redefined - update existing.
-                if (existing.binding == symbol_binding::local_ &&
-                    symbol.binding == symbol_binding::local_)
-                {
-                    m_symbols[i] = symbol;
-                    return i;
-                }
+            // Local symbols can be redefined - update existing.
+            if (existing.binding == symbol_binding::local_ &&
+                symbol.binding == symbol_binding::local_)
+            {
+                m_symbols[i] = symbol;
+                return i;
             }
         }
 
@@ -485,6 +511,7 @@ namespace g10
         }
 
         // Add the new symbol.
+        indices.push_back(m_symbols.size());
         m_symbols.push_back(symbol);
         return m_symbols.size() - 1;
     }
@@ -518,15 +545,27 @@ namespace g10
         return m_relocations.size() - 1;
     }
 
+    auto object::sort_relocations () -> void
+    {
+        std::ranges::stable_sort(m_relocations,
+            [] (const object_relocation& lhs, const object_relocation& rhs)
+            {
+                if (lhs.section_index != rhs.section_index)
+                {
+                    return lhs.section_index < rhs.section_index;
+                }
+
+                return lhs.offset < rhs.offset;
+            });
+    }
+
     auto object::find_symbol (const std::string& name) const
         -> std::optional<std::size_t>
     {
-        for (std::size_t i = 0; i < m_symbols.size(); ++i)
+        if (auto it = m_symbol_index.find(name);
+            it != m_symbol_index.end() && it->second.empty() == false)
         {
-            if (m_symbols[i].name == name)
-            {
-                return i;
-            }
+            return it->second.front();
         }
         return std::nullopt;
     }
@@ -745,7 +784,8 @@ namespace g10
                 reloc.type != relocation_type::rel16 &&
                 reloc.type != relocation_type::rel8 &&
                 reloc.type != relocation_type::quick16 &&
-                reloc.type != relocation_type::port8)
+                reloc.type != relocation_type::port8 &&
+                reloc.type != relocation_type::jump32)
             {
                 return error("Relocation {} has invalid type 0x{:04X}.",
                     i, static_cast<std::uint16_t>(reloc.type));
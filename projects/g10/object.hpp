@@ -138,7 +138,8 @@ namespace g10
         rel16   = 0x0005,   /** @brief 16-bit PC-relative offset */
         rel8    = 0x0006,   /** @brief 8-bit PC-relative offset */
         quick16 = 0x0007,   /** @brief 16-bit offset relative to $FFFF0000 */
-        port8   = 0x0008    /** @brief 8-bit offset relative to $FFFFFF00 */
+        port8   = 0x0008,   /** @brief 8-bit offset relative to $FFFFFF00 */
+        jump32  = 0x0009    /** @brief 32-bit absolute target of a `JMP X, IMM32` the linker may relax to `JPB X, SIMM16` and a `NOP` */
     };
 
     G10_BIT_ENUM(object_flags)
@@ -310,6 +311,22 @@ namespace g10
          */
         auto load_from_file (const fs::path& path) -> result<void>;
 
+        /**
+         * @brief   Loads the G10 object file from the contents of an object
+         *          file held in memory, such as a member of an archive.
+         * 
+         * @param   buffer  The contents of the object file.
+         * @param   name    The name of the object file, as reported in error
+         *                  messages.
+         * 
+         * @return  If loaded successfully and is valid, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto load_from_buffer (
+            std::span<const std::uint8_t> buffer,
+            std::string_view name
+        ) -> result<void>;
+
         /**
          * @brief   Saves the G10 object file to a file located at the given
          *          path.
@@ -396,6 +413,22 @@ namespace g10
          */
         auto add_section (const object_section& section) -> std::size_t;
 
+        /**
+         * @brief   Retrieves a mutable reference to the data buffer of the
+         *          section at the given index.
+         * 
+         * This allows a section's contents to be emitted and patched in place
+         * while the object is being built.
+         * 
+         * @param   index   The index of the section.
+         * 
+         * @return  If the index is valid, returns a reference to the section's
+         *          data buffer;
+         *          Otherwise, returns an error message.
+         */
+        auto get_section_data (std::size_t index)
+            -> result_ref<std::vector<std::uint8_t>>;
+
         /**
          * @brief   Adds a new symbol to the object file.
          * 
@@ -417,6 +450,16 @@ namespace g10
         auto add_relocation (const object_relocation& reloc)
             -> result<std::size_t>;
 
+        /**
+         * @brief   Sorts the relocations by section index, then by offset
+         *          within their section, keeping the relative order of
+         *          relocations which share both.
+         * 
+         * This gives the relocation table a canonical order which does not
+         * depend on the order in which its producer resolved references.
+         */
+        auto sort_relocations () -> void;
+
         /**
          * @brief   Finds a symbol by name.
          * 
@@ -484,6 +527,12 @@ namespace g10
          */
         std::vector<object_symbol> m_symbols;
 
+        /**
+         * @brief   The indices of the symbols in this object file, keyed by
+         *          name, in the order they were added.
+         */
+        std::unordered_map<std::string, std::vector<std::size_t>> m_symbol_index;
+
         /**
          * @brief   The list of relocations in this object file.
          */
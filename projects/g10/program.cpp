@@ -9,12 +9,22 @@
 /* Private Includes ***********************************************************/
 
 #include <g10/program.hpp>
+#include <g10/time_report.hpp>
 
 /* Private Constants and Enumerations *****************************************/
 
 namespace g10
 {
+    /**
+     * @brief   Indicates that no collected section was found during linking.
+     */
+    constexpr std::size_t NO_LINK_SECTION = static_cast<std::size_t>(-1);
 
+    /**
+     * @brief   The fewest work items for which a linking stage is spread
+     *          across worker threads; smaller stages run on the calling thread.
+     */
+    constexpr std::size_t PARALLEL_LINK_MIN_ITEMS = 64;
 }
 
 /* Private Helper Functions ***************************************************/
@@ -46,6 +56,427 @@ namespace g10
             length
         );
     }
+
+    /**
+     * @brief   Retrieves the name of a relocation type, as used in linker
+     *          error messages.
+     *
+     * @param   type    The relocation type.
+     *
+     * @return  The relocation type's name.
+     */
+    auto relocation_type_name (relocation_type type) -> std::string_view
+    {
+        switch (type)
+        {
+        case relocation_type::abs32:    return "ABS32";
+        case relocation_type::abs16:    return "ABS16";
+        case relocation_type::abs8:     return "ABS8";
+        case relocation_type::rel32:    return "REL32";
+        case relocation_type::rel16:    return "REL16";
+        case relocation_type::rel8:     return "REL8";
+        case relocation_type::quick16:  return "QUICK16";
+        case relocation_type::port8:    return "PORT8";
+        case relocation_type::jump32:   return "JUMP32";
+        default:                        return "NONE";
+        }
+    }
+
+    /**
+     * @brief   Encodes the little-endian field a relocation patches into its
+     *          section's data.
+     *
+     * @param   type            The relocation type.
+     * @param   final_value     The referenced symbol's address plus the
+     *                          relocation's addend.
+     * @param   reloc_address   The final address of the field being patched.
+     * @param   field           Output: the encoded field.
+     *
+     * @return  The size of the field, in bytes; zero if the relocation patches
+     *          nothing.
+     */
+    auto encode_relocation (
+        relocation_type type,
+        std::int32_t final_value,
+        std::uint32_t reloc_address,
+        std::array<std::uint8_t, 4>& field
+    ) -> std::size_t
+    {
+        switch (type)
+        {
+        case relocation_type::abs32:
+        case relocation_type::jump32:
+            // 32-bit absolute address. The instruction of a `JUMP32`
+            // relocation is encoded as a whole by `encode_jump`.
+            write_u32_le(field, 0, static_cast<std::uint32_t>(final_value));
+            return 4;
+
+        case relocation_type::abs16:
+            // 16-bit absolute address (truncated).
+            write_u16_le(field, 0,
+                static_cast<std::uint16_t>(final_value & 0xFFFF));
+            return 2;
+
+        case relocation_type::abs8:
+            // 8-bit absolute address (truncated).
+            field[0] = static_cast<std::uint8_t>(final_value & 0xFF);
+            return 1;
+
+        case relocation_type::rel32:
+        {
+            // 32-bit PC-relative offset.
+            // Offset is calculated from the end of the relocation field.
+            const std::int32_t pc_offset =
+                final_value - static_cast<std::int32_t>(reloc_address + 4);
+            write_u32_le(field, 0, static_cast<std::uint32_t>(pc_offset));
+            return 4;
+        }
+
+        case relocation_type::rel16:
+        {
+            // 16-bit PC-relative offset.
+            const std::int32_t pc_offset =
+                final_value - static_cast<std::int32_t>(reloc_address + 2);
+            write_u16_le(field, 0,
+                static_cast<std::uint16_t>(pc_offset & 0xFFFF));
+            return 2;
+        }
+
+        case relocation_type::rel8:
+        {
+            // 8-bit PC-relative offset.
+            const std::int32_t pc_offset =
+                final_value - static_cast<std::int32_t>(reloc_address + 1);
+            field[0] = static_cast<std::uint8_t>(pc_offset & 0xFF);
+            return 1;
+        }
+
+        case relocation_type::quick16:
+        {
+            // 16-bit offset relative to $FFFF0000.
+            const std::int32_t quick_offset =
+                final_value - static_cast<std::int32_t>(0xFFFF0000);
+            write_u16_le(field, 0,
+                static_cast<std::uint16_t>(quick_offset & 0xFFFF));
+            return 2;
+        }
+
+        case relocation_type::port8:
+        {
+            // 8-bit offset relative to $FFFFFF00.
+            const std::int32_t port_offset =
+                final_value - static_cast<std::int32_t>(0xFFFFFF00);
+            field[0] = static_cast<std::uint8_t>(port_offset & 0xFF);
+            return 1;
+        }
+
+        case relocation_type::none:
+        default:
+            // No relocation needed.
+            return 0;
+        }
+    }
+
+    /**
+     * @brief   Encodes the `JMP X, IMM32` instruction patched by a `JUMP32`
+     *          relocation. If its target is within reach of a signed 16-bit
+     *          offset, the jump is relaxed to a `JPB X, SIMM16`, padded with a
+     *          `NOP` to the original length; otherwise, it is encoded as the
+     *          `JMP X, IMM32` it was. Either form may already be present, from
+     *          an earlier link.
+     *
+     * The relaxed form saves no space, and only saves time when the jump is
+     * taken: a taken `JPB` takes 5 M-cycles rather than 7, while one not
+     * taken takes 4, plus 2 for the `NOP`, as does the `JMP`.
+     *
+     * @param   instruction The instruction's 6 bytes, starting at its opcode.
+     * @param   target      The jump's target address.
+     * @param   address     The address of the instruction.
+     *
+     * @return  `true` if the instruction was encoded; `false` if the bytes do
+     *          not hold a `JMP X, IMM32` or `JPB X, SIMM16` instruction.
+     */
+    auto encode_jump (
+        std::span<std::uint8_t> instruction,
+        std::uint32_t target,
+        std::uint32_t address
+    ) -> bool
+    {
+        const std::uint16_t opcode = read_u16_le(instruction, 0);
+        const std::uint8_t kind = static_cast<std::uint8_t>(opcode >> 8);
+        if ((kind != 0x40 && kind != 0x42) || (opcode & 0x000F) != 0)
+        {
+            return false;
+        }
+
+        // The `JPB` offset is relative to the address following it.
+        const std::uint16_t condition = opcode & 0x00F0;
+        const std::int64_t offset = static_cast<std::int64_t>(target) -
+            (static_cast<std::int64_t>(address) + 4);
+        if (offset >= -32768 && offset <= 32767)
+        {
+            write_u16_le(instruction, 0, 0x4200 | condition);
+            write_u16_le(instruction, 2,
+                static_cast<std::uint16_t>(static_cast<std::int16_t>(offset)));
+            write_u16_le(instruction, 4, 0x0000);
+        }
+        else
+        {
+            write_u16_le(instruction, 0, 0x4000 | condition);
+            write_u32_le(instruction, 2, target);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief   Checks whether the address a `QUICK16` or `PORT8` relocation
+     *          refers to can be reached by its instruction's offset.
+     *
+     * @param   type        The relocation type.
+     * @param   final_value The referenced symbol's address plus the
+     *                      relocation's addend.
+     *
+     * @return  `false` if the address lies outside quick RAM or the port
+     *          range, respectively; `true` otherwise.
+     */
+    auto is_reachable_offset (relocation_type type, std::int32_t final_value)
+        -> bool
+    {
+        const std::uint32_t address = static_cast<std::uint32_t>(final_value);
+        switch (type)
+        {
+        case relocation_type::quick16:  return address >= 0xFFFF0000;
+        case relocation_type::port8:    return address >= 0xFFFFFF00;
+        default:                        return true;
+        }
+    }
+
+    /**
+     * @brief   Checks whether an object's section takes part in linking: null
+     *          sections, and sections without data or reservation, do not.
+     *
+     * @param   sec     The object's section.
+     *
+     * @return  `true` if the section is linked; `false` otherwise.
+     */
+    auto is_linked_section (const object_section& sec) -> bool
+    {
+        // Skip null sections.
+        if (sec.type == section_type::null_)
+        {
+            return false;
+        }
+
+        // Skip empty sections. For BSS sections, the data size represents the
+        // reservation size.
+        return sec.data.empty() == false;
+    }
+
+    /**
+     * @brief   Finds the linked section of an object which holds one of its
+     *          symbols: the symbol's own section, if it is linked, or else the
+     *          first linked section whose address range contains the symbol.
+     *
+     * @param   obj     The object.
+     * @param   sym     The object's symbol.
+     *
+     * @return  The index of the section within the object, or
+     *          `NO_LINK_SECTION` if the symbol is extern, or lies in no
+     *          linked section.
+     */
+    auto find_symbol_section (const object& obj, const object_symbol& sym)
+        -> std::size_t
+    {
+        if (sym.binding == symbol_binding::extern_)
+        {
+            return NO_LINK_SECTION;
+        }
+
+        const auto& obj_sections = obj.get_sections();
+        if (sym.section_index < obj_sections.size() &&
+            is_linked_section(obj_sections[sym.section_index]) == true)
+        {
+            return sym.section_index;
+        }
+
+        for (std::size_t sec_idx = 0; sec_idx < obj_sections.size(); ++sec_idx)
+        {
+            const auto& sec = obj_sections[sec_idx];
+            if (is_linked_section(sec) == true &&
+                sym.value >= sec.virtual_address &&
+                sym.value - sec.virtual_address < sec.data.size())
+            {
+                return sec_idx;
+            }
+        }
+
+        return NO_LINK_SECTION;
+    }
+
+    /**
+     * @brief   Checks whether an object's section is linked, given the live
+     *          sections found for `link_options::gc_sections`.
+     *
+     * @param   live            Whether each section of each object is linked,
+     *                          or empty if every section is linked.
+     * @param   object_index    The index of the object.
+     * @param   section_index   The index of the section within the object.
+     *
+     * @return  `true` if the section is live; `false` otherwise.
+     */
+    auto is_live_section (
+        const std::vector<std::vector<bool>>& live,
+        std::size_t object_index,
+        std::size_t section_index
+    ) -> bool
+    {
+        return live.empty() == true ||
+            (section_index < live[object_index].size() &&
+                live[object_index][section_index] == true);
+    }
+
+    /**
+     * @brief   Computes a hash of the symbols an object exposes to the rest of
+     *          a link: its global, weak and extern symbols, and any symbol
+     *          marked as the entry point. The order in which the symbols are
+     *          declared does not affect the hash.
+     *
+     * @param   obj     The object.
+     *
+     * @return  The object's interface hash.
+     */
+    auto compute_interface_hash (const object& obj) -> std::uint64_t
+    {
+        std::vector<const object_symbol*> exposed;
+        for (const auto& sym : obj.get_symbols())
+        {
+            if (sym.binding != symbol_binding::local_ ||
+                (sym.flags & symbol_flags::entry) != symbol_flags::none)
+            {
+                exposed.push_back(&sym);
+            }
+        }
+
+        std::sort(exposed.begin(), exposed.end(),
+            [] (const object_symbol* a, const object_symbol* b)
+            {
+                return std::tie(a->name, a->binding, a->flags, a->type) <
+                    std::tie(b->name, b->binding, b->flags, b->type);
+            }
+        );
+
+        std::vector<std::uint8_t> buffer;
+        for (const auto* sym : exposed)
+        {
+            const std::size_t offset = buffer.size();
+            buffer.resize(offset + 8);
+            write_u32_le(buffer, offset, static_cast<std::uint32_t>(
+                sym->name.size()));
+            write_u16_le(buffer, offset + 4, static_cast<std::uint16_t>(
+                sym->flags));
+            buffer[offset + 6] = static_cast<std::uint8_t>(sym->binding);
+            buffer[offset + 7] = static_cast<std::uint8_t>(sym->type);
+            buffer.insert(buffer.end(), sym->name.begin(), sym->name.end());
+        }
+
+        return link_state::hash_bytes(buffer);
+    }
+
+    /**
+     * @brief   Records an object's relocations which reference a global, weak
+     *          or extern symbol, for a link state.
+     *
+     * @param   obj         The object.
+     * @param   sections    The object's recorded sections.
+     *
+     * @return  The recorded relocations.
+     */
+    auto record_relocations (
+        const object& obj,
+        const std::vector<link_state_section>& sections
+    ) -> std::vector<link_state_relocation>
+    {
+        // Map each of the object's linked sections to its recorded position.
+        std::vector<std::uint32_t> positions(obj.get_sections().size(),
+            LINK_STATE_NO_OFFSET);
+        for (std::size_t i = 0; i < sections.size(); ++i)
+        {
+            positions[sections[i].section_index] =
+                static_cast<std::uint32_t>(i);
+        }
+
+        std::vector<link_state_relocation> relocations;
+        const auto& obj_symbols = obj.get_symbols();
+        for (const auto& reloc : obj.get_relocations())
+        {
+            if (reloc.section_index >= positions.size() ||
+                positions[reloc.section_index] == LINK_STATE_NO_OFFSET ||
+                reloc.symbol_index >= obj_symbols.size())
+            {
+                continue;
+            }
+
+            const auto& ref_sym = obj_symbols[reloc.symbol_index];
+            if (ref_sym.binding == symbol_binding::local_)
+            {
+                continue;
+            }
+
+            relocations.push_back({
+                .section    = positions[reloc.section_index],
+                .offset     = reloc.offset,
+                .type       = reloc.type,
+                .addend     = reloc.addend,
+                .symbol     = ref_sym.name
+            });
+        }
+
+        return relocations;
+    }
+
+    /**
+     * @brief   Invokes a function once for each index in `[0, count)`, spread
+     *          across as many worker threads as the hardware supports.
+     *
+     * The order in which indices are visited is unspecified; the function must
+     * only write to state owned by the index it is given.
+     *
+     * @param   count   The number of indices to visit.
+     * @param   body    The function to invoke with each index.
+     */
+    auto parallel_for (
+        std::size_t count,
+        const std::function<void(std::size_t)>& body
+    ) -> void
+    {
+        const std::size_t worker_count = (count < PARALLEL_LINK_MIN_ITEMS) ?
+            1 : std::min<std::size_t>(count,
+                std::max(1u, std::thread::hardware_concurrency()));
+        if (worker_count <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                body(i);
+            }
+
+            return;
+        }
+
+        std::atomic<std::size_t> next { 0 };
+        std::vector<std::jthread> workers;
+        workers.reserve(worker_count);
+        for (std::size_t w = 0; w < worker_count; ++w)
+        {
+            workers.emplace_back([&]
+            {
+                for (std::size_t i = next++; i < count; i = next++)
+                {
+                    body(i);
+                }
+            });
+        }
+    }
 }
 
 /* Public Methods *************************************************************/
@@ -75,7 +506,9 @@ namespace g10
     }
 
     auto program::link_from_objects (
-        const std::vector<object>& objects
+        const std::vector<object>& objects,
+        link_state* state,
+        const link_options& options
     ) -> result<void>
     {
         // Clear any existing data.
@@ -96,36 +529,90 @@ namespace g10
             }
         }
 
+        // If requested, find the sections reachable from the program's roots.
+        // All other sections are dropped before they are laid out, so that
+        // the sections kept are packed together.
+        std::vector<std::vector<bool>> live;
+        if (options.gc_sections == true)
+        {
+            time_report::phase timer { "Find live sections" };
+            auto live_result = find_live_sections(objects, options);
+            if (live_result.has_value() == false)
+            {
+                return error(live_result.error());
+            }
+
+            live = std::move(live_result.value());
+        }
+
+        // If requested, find the identical read-only sections to fold into a
+        // single copy.
+        std::map<std::pair<std::size_t, std::size_t>,
+            std::pair<std::size_t, std::size_t>> folds;
+        if (options.fold_identical == true)
+        {
+            time_report::phase timer { "Fold identical sections" };
+            folds = find_identical_sections(objects, live);
+        }
+
+        // If given a section ordering, rank the ROM sections it names, so
+        // that hot code is packed together and cold code is moved out of its
+        // way.
+        std::map<std::pair<std::size_t, std::size_t>, section_rank> ranks;
+        if (options.section_order.empty() == false)
+        {
+            time_report::phase timer { "Rank sections" };
+            ranks = rank_sections(objects, live, options);
+        }
+
         // Step 1: Collect all sections (with relocation).
         // This must come first so we know the section address adjustments.
         std::vector<link_section> sections;
-        auto sections_result = collect_sections(objects, sections);
-        if (sections_result.has_value() == false)
         {
-            return error(sections_result.error());
+            time_report::phase timer { "Collect sections" };
+            auto sections_result = collect_sections(objects, live, folds,
+                ranks, sections);
+            if (sections_result.has_value() == false)
+            {
+                return error(sections_result.error());
+            }
         }
 
+        // Index the collected sections for the symbol and relocation lookups.
+        const link_section_index index = index_sections(objects, sections);
+
         // Step 2: Collect and resolve all symbols.
         // Symbols are adjusted based on section relocation.
         std::vector<resolved_symbol> symbols;
-        auto collect_result = collect_symbols(objects, symbols, sections);
-        if (collect_result.has_value() == false)
         {
-            return error(collect_result.error());
+            time_report::phase timer { "Collect symbols" };
+            auto collect_result = collect_symbols(objects, symbols, sections,
+                index);
+            if (collect_result.has_value() == false)
+            {
+                return error(collect_result.error());
+            }
         }
 
         // Step 3: Apply relocations to patch section data.
-        auto reloc_result = apply_relocations(objects, symbols, sections);
-        if (reloc_result.has_value() == false)
         {
-            return error(reloc_result.error());
+            time_report::phase timer { "Apply relocations" };
+            auto reloc_result = apply_relocations(objects, live, symbols,
+                sections, index);
+            if (reloc_result.has_value() == false)
+            {
+                return error(reloc_result.error());
+            }
         }
 
         // Step 4: Generate program segments from linked sections.
-        auto segments_result = generate_segments(sections);
-        if (segments_result.has_value() == false)
         {
-            return error(segments_result.error());
+            time_report::phase timer { "Generate segments" };
+            auto segments_result = generate_segments(sections);
+            if (segments_result.has_value() == false)
+            {
+                return error(segments_result.error());
+            }
         }
 
         // Handle BSS segment sizes (need to get from original sections).
@@ -172,48 +659,34 @@ namespace g10
             return error(validate_result.error());
         }
 
+        // Record the link state for a later incremental relink, if requested.
+        if (state != nullptr)
+        {
+            record_link_state(objects, symbols, sections, index, *state);
+        }
+
         m_good = true;
         return {};
     }
 
-    auto program::load_from_file (const fs::path& path) -> result<void>
+    auto program::relink_in_place (
+        const fs::path& path,
+        link_state& state,
+        std::span<const std::size_t> changed,
+        const std::vector<object>& changed_objects
+    ) -> result<bool>
     {
-        // Clear any existing data first.
-        clear();
-
-        // Check that the path points to a valid file.
-        if (fs::exists(path) == false)
-        {
-            return error("File not found: '{}'", path.string());
-        }
-
-        if (fs::is_regular_file(path) == false)
-        {
-            return error("Not a regular file: '{}'", path.string());
-        }
-
-        // Determine the file size and check that it is large enough for the
-        // header.
-        const auto file_size = fs::file_size(path);
-        if (file_size < PROGRAM_HEADER_SIZE)
-        {
-            return error(
-                "File too small for program header: {} bytes (need at "
-                "least {} bytes)",
-                file_size, PROGRAM_HEADER_SIZE
-            );
-        }
-
-        // Open the file for reading in binary mode.
-        std::ifstream file(path, std::ios::binary);
-        if (file.is_open() == false)
+        // Read the program file, and check that it is the one the link state
+        // describes.
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (file.is_open() == false || changed.size() != changed_objects.size())
         {
-            return error("Failed to open file for reading: '{}'",
-                path.string());
+            return false;
         }
 
-        // Read the entire file into a buffer.
+        const auto file_size = static_cast<std::size_t>(file.tellg());
         std::vector<std::uint8_t> buffer(file_size);
+        file.seekg(0);
         file.read(reinterpret_cast<char*>(buffer.data()), file_size);
         if (file.good() == false)
         {
@@ -221,39 +694,411 @@ namespace g10
         }
         file.close();
 
-        // Parse and validate the header.
-        auto header_result = parse_header(buffer);
-        if (header_result.has_value() == false)
+        if (link_state::hash_bytes(buffer) != state.output_hash)
         {
-            return error(header_result.error());
+            return false;
         }
 
-        // Parse the segment headers and data.
-        auto segments_result = parse_segments(buffer);
-        if (segments_result.has_value() == false)
+        // Check that each changed object still fits the layout recorded for
+        // it, and place its sections in their recorded slots.
+        std::vector<link_section> sections;
+        std::vector<const link_state_section*> slots;
+        for (std::size_t k = 0; k < changed.size(); ++k)
         {
-            return error(segments_result.error());
-        }
+            const auto& obj = changed_objects[k];
+            if (changed[k] >= state.objects.size() || obj.is_good() == false)
+            {
+                return false;
+            }
 
-        // Parse the program info section if present.
-        if (has_info())
-        {
-            auto info_result = parse_info(buffer);
-            if (info_result.has_value() == false)
+            const auto& record = state.objects[changed[k]];
+            if (compute_interface_hash(obj) != record.interface_hash)
             {
-                return error(info_result.error());
+                return false;
+            }
+
+            const auto& obj_sections = obj.get_sections();
+            std::size_t position = 0;
+            for (std::size_t sec_idx = 0; sec_idx < obj_sections.size();
+                ++sec_idx)
+            {
+                const auto& sec = obj_sections[sec_idx];
+                if (is_linked_section(sec) == false)
+                {
+                    continue;
+                }
+
+                if (position >= record.sections.size())
+                {
+                    return false;
+                }
+
+                const auto& slot = record.sections[position++];
+                if (slot.section_index != sec_idx ||
+                    slot.type != sec.type ||
+                    slot.flags != sec.flags ||
+                    slot.original_address != sec.virtual_address ||
+                    sec.data.size() > slot.size ||
+                    (sec.type != section_type::bss &&
+                        slot.file_offset == LINK_STATE_NO_OFFSET))
+                {
+                    return false;
+                }
+
+                link_section link_sec;
+                link_sec.object_index = k;
+                link_sec.section_index = sec_idx;
+                link_sec.address = slot.address;
+                link_sec.original_address = slot.original_address;
+                link_sec.type = sec.type;
+                link_sec.flags = sec.flags;
+                if (sec.type != section_type::bss)
+                {
+                    link_sec.data = sec.data;
+                }
+
+                sections.push_back(std::move(link_sec));
+                slots.push_back(&slot);
+            }
+
+            if (position != record.sections.size())
+            {
+                return false;
             }
         }
 
-        // Validate the loaded program structure.
-        auto validate_result = validate();
-        if (validate_result.has_value() == false)
+        const link_section_index index = index_sections(changed_objects,
+            sections);
+
+        // Resolve the changed objects' symbols at their new addresses, and
+        // update the global symbols they define.
+        std::vector<resolved_symbol> symbols;
+        std::unordered_map<std::string_view, std::size_t> symbol_map;
+        symbols.reserve(state.symbols.size());
+        for (const auto& sym : state.symbols)
         {
-            return error(validate_result.error());
+            symbols.push_back({
+                .name           = sym.name,
+                .address        = sym.address,
+                .type           = symbol_type::none,
+                .binding        = symbol_binding::global,
+                .flags          = symbol_flags::none,
+                .object_index   = sym.object_index,
+                .section_index  = 0
+            });
+            symbol_map[symbols.back().name] = symbols.size() - 1;
         }
 
-        m_good = true;
-        return {};
+        std::unordered_set<std::string_view> moved_symbols;
+        std::optional<std::uint32_t> entry_point;
+        for (std::size_t k = 0; k < changed.size(); ++k)
+        {
+            std::vector<resolved_symbol> obj_symbols;
+            for (const auto& sym : changed_objects[k].get_symbols())
+            {
+                if (sym.binding == symbol_binding::extern_)
+                {
+                    continue;
+                }
+
+                // Adjust the symbol by its section's relocation.
+                std::uint32_t address = sym.value;
+                const std::size_t link_idx = find_link_section(index, k,
+                    sym.section_index, sym.value);
+                if (link_idx != NO_LINK_SECTION)
+                {
+                    address = static_cast<std::uint32_t>(
+                        static_cast<std::int32_t>(sym.value) +
+                        static_cast<std::int32_t>(sections[link_idx].address) -
+                        static_cast<std::int32_t>(
+                            sections[link_idx].original_address));
+                }
+
+                obj_symbols.push_back({
+                    .name           = sym.name,
+                    .address        = address,
+                    .type           = sym.type,
+                    .binding        = sym.binding,
+                    .flags          = sym.flags,
+                    .object_index   = changed[k],
+                    .section_index  = sym.section_index
+                });
+
+                if (sym.binding != symbol_binding::global &&
+                    sym.binding != symbol_binding::weak)
+                {
+                    continue;
+                }
+
+                const auto it = symbol_map.find(sym.name);
+                if (it != symbol_map.end() &&
+                    symbols[it->second].object_index == changed[k] &&
+                    symbols[it->second].address != address)
+                {
+                    symbols[it->second].address = address;
+                    moved_symbols.insert(symbols[it->second].name);
+                }
+            }
+
+            // The entry point symbol is the one its object would select.
+            if (changed[k] == state.entry_object)
+            {
+                const auto* entry = select_entry_symbol(obj_symbols);
+                if (entry == nullptr || entry->name != state.entry_symbol)
+                {
+                    return false;
+                }
+
+                entry_point = entry->address;
+            }
+        }
+
+        // Relocate the changed objects' sections. Should this fail, a full
+        // link reports the failure.
+        if (apply_relocations(changed_objects, {}, symbols, sections, index)
+            .has_value() == false)
+        {
+            return false;
+        }
+
+        // Patch the changed sections into their slots, zeroing whatever is
+        // left of each slot.
+        std::vector<std::pair<std::size_t, std::size_t>> patches;
+        for (std::size_t i = 0; i < sections.size(); ++i)
+        {
+            const auto& sec = sections[i];
+            const auto& slot = *slots[i];
+            if (sec.type == section_type::bss)
+            {
+                continue;
+            }
+            else if (slot.file_offset + std::size_t { slot.size } >
+                buffer.size())
+            {
+                return false;
+            }
+
+            const auto first = buffer.begin() + slot.file_offset;
+            std::copy(sec.data.begin(), sec.data.end(), first);
+            std::fill(first + sec.data.size(), first + slot.size, 0x00);
+            patches.emplace_back(slot.file_offset, slot.size);
+        }
+
+        // Apply the unchanged objects' relocations against moved symbols
+        // again.
+        if (moved_symbols.empty() == false)
+        {
+            std::vector<bool> is_changed(state.objects.size(), false);
+            for (const std::size_t obj_idx : changed)
+            {
+                is_changed[obj_idx] = true;
+            }
+
+            for (std::size_t obj_idx = 0; obj_idx < state.objects.size();
+                ++obj_idx)
+            {
+                if (is_changed[obj_idx] == true)
+                {
+                    continue;
+                }
+
+                const auto& record = state.objects[obj_idx];
+                for (const auto& reloc : record.relocations)
+                {
+                    if (moved_symbols.contains(reloc.symbol) == false)
+                    {
+                        continue;
+                    }
+                    else if (reloc.section >= record.sections.size())
+                    {
+                        return false;
+                    }
+
+                    const auto& slot = record.sections[reloc.section];
+                    const std::int32_t final_value = static_cast<std::int32_t>(
+                        symbols[symbol_map.find(reloc.symbol)->second]
+                            .address) + reloc.addend;
+
+                    // The jump of a `JUMP32` relocation may change form,
+                    // relaxed or not, as its target moves.
+                    if (reloc.type == relocation_type::jump32)
+                    {
+                        const std::size_t offset =
+                            std::size_t { slot.file_offset } + reloc.offset;
+                        if (slot.file_offset == LINK_STATE_NO_OFFSET ||
+                            reloc.offset < 2 || offset + 4 > buffer.size() ||
+                            encode_jump(
+                                std::span { buffer }.subspan(offset - 2, 6),
+                                static_cast<std::uint32_t>(final_value),
+                                slot.address + reloc.offset - 2) == false)
+                        {
+                            return false;
+                        }
+
+                        patches.emplace_back(offset - 2, 6);
+                        continue;
+                    }
+                    else if (is_reachable_offset(reloc.type, final_value) ==
+                        false)
+                    {
+                        return false;
+                    }
+
+                    std::array<std::uint8_t, 4> field {};
+                    const std::size_t field_size = encode_relocation(
+                        reloc.type, final_value, slot.address + reloc.offset,
+                        field);
+                    const std::size_t offset =
+                        std::size_t { slot.file_offset } + reloc.offset;
+                    if (slot.file_offset == LINK_STATE_NO_OFFSET ||
+                        offset + field_size > buffer.size())
+                    {
+                        return false;
+                    }
+
+                    std::copy_n(field.begin(), field_size,
+                        buffer.begin() + offset);
+                    patches.emplace_back(offset, field_size);
+                }
+            }
+        }
+
+        // Move the entry point, if its symbol has moved.
+        if (entry_point.has_value() == true &&
+            entry_point.value() != read_u32_le(buffer, 0x0C))
+        {
+            write_u32_le(buffer, 0x0C, entry_point.value());
+            patches.emplace_back(0x0C, 4);
+        }
+
+        // Check the patched program, by loading it, before writing it back.
+        clear();
+        if (parse_header(buffer).has_value() == false ||
+            parse_segments(buffer).has_value() == false ||
+            (has_info() == true && parse_info(buffer).has_value() == false) ||
+            validate().has_value() == false)
+        {
+            clear();
+            return false;
+        }
+
+        std::fstream output(path,
+            std::ios::binary | std::ios::in | std::ios::out);
+        if (output.is_open() == false)
+        {
+            return error("Failed to open file for writing: '{}'",
+                path.string());
+        }
+
+        for (const auto& [offset, size] : patches)
+        {
+            output.seekp(static_cast<std::streamoff>(offset));
+            output.write(reinterpret_cast<const char*>(buffer.data() + offset),
+                static_cast<std::streamsize>(size));
+        }
+
+        if (output.good() == false)
+        {
+            return error("Failed to write file contents: '{}'", path.string());
+        }
+        output.close();
+
+        // Update the link state to describe the patched program.
+        for (std::size_t k = 0; k < changed.size(); ++k)
+        {
+            auto& record = state.objects[changed[k]];
+            record.relocations = record_relocations(changed_objects[k],
+                record.sections);
+        }
+
+        for (std::size_t i = 0; i < state.symbols.size(); ++i)
+        {
+            state.symbols[i].address = symbols[i].address;
+        }
+
+        state.output_hash = link_state::hash_bytes(buffer);
+        m_good = true;
+        return true;
+    }
+
+    auto program::load_from_file (const fs::path& path) -> result<void>
+    {
+        // Clear any existing data first.
+        clear();
+
+        // Check that the path points to a valid file.
+        if (fs::exists(path) == false)
+        {
+            return error("File not found: '{}'", path.string());
+        }
+
+        if (fs::is_regular_file(path) == false)
+        {
+            return error("Not a regular file: '{}'", path.string());
+        }
+
+        // Determine the file size and check that it is large enough for the
+        // header.
+        const auto file_size = fs::file_size(path);
+        if (file_size < PROGRAM_HEADER_SIZE)
+        {
+            return error(
+                "File too small for program header: {} bytes (need at "
+                "least {} bytes)",
+                file_size, PROGRAM_HEADER_SIZE
+            );
+        }
+
+        // Open the file for reading in binary mode.
+        std::ifstream file(path, std::ios::binary);
+        if (file.is_open() == false)
+        {
+            return error("Failed to open file for reading: '{}'",
+                path.string());
+        }
+
+        // Read the entire file into a buffer.
+        std::vector<std::uint8_t> buffer(file_size);
+        file.read(reinterpret_cast<char*>(buffer.data()), file_size);
+        if (file.good() == false)
+        {
+            return error("Failed to read file contents: '{}'", path.string());
+        }
+        file.close();
+
+        // Parse and validate the header.
+        auto header_result = parse_header(buffer);
+        if (header_result.has_value() == false)
+        {
+            return error(header_result.error());
+        }
+
+        // Parse the segment headers and data.
+        auto segments_result = parse_segments(buffer);
+        if (segments_result.has_value() == false)
+        {
+            return error(segments_result.error());
+        }
+
+        // Parse the program info section if present.
+        if (has_info())
+        {
+            auto info_result = parse_info(buffer);
+            if (info_result.has_value() == false)
+            {
+                return error(info_result.error());
+            }
+        }
+
+        // Validate the loaded program structure.
+        auto validate_result = validate();
+        if (validate_result.has_value() == false)
+        {
+            return error(validate_result.error());
+        }
+
+        m_good = true;
+        return {};
     }
 
     auto program::save_to_file (const fs::path& path) -> result<bool>
@@ -522,29 +1367,54 @@ namespace g10
             }
         }
 
-        // Check for segment overlaps.
-        for (std::size_t i = 0; i < m_segments.size(); ++i)
+        // Check for segment overlaps, sweeping the segments in order of load
+        // address while tracking the one which reaches furthest so far.
+        std::vector<std::size_t> order(m_segments.size());
+        std::iota(order.begin(), order.end(), std::size_t { 0 });
+        std::stable_sort(order.begin(), order.end(),
+            [this] (std::size_t a, std::size_t b)
+            {
+                return m_segments[a].load_address < m_segments[b].load_address;
+            }
+        );
+
+        std::optional<std::size_t> furthest;
+        std::uint64_t furthest_end = 0;
+        for (const std::size_t j : order)
         {
-            const auto& seg_a = m_segments[i];
-            const auto a_start = seg_a.load_address;
-            const auto a_end = a_start + seg_a.memory_size;
+            const auto& seg_b = m_segments[j];
+            const auto b_start = seg_b.load_address;
+            const auto b_end = b_start + seg_b.memory_size;
 
-            for (std::size_t j = i + 1; j < m_segments.size(); ++j)
+            if (furthest.has_value() && b_start < furthest_end)
             {
-                const auto& seg_b = m_segments[j];
-                const auto b_start = seg_b.load_address;
-                const auto b_end = b_start + seg_b.memory_size;
+                const std::size_t i = furthest.value();
+                const auto& seg_a = m_segments[i];
+                const auto a_start = seg_a.load_address;
+                const auto a_end = a_start + seg_a.memory_size;
 
                 // Check if ranges overlap.
                 if (a_start < b_end && b_start < a_end)
                 {
+                    // Report the pair in segment order.
+                    const bool swap = (j < i);
                     return error(
                         "Segments {} and {} overlap: 0x{:08X}-0x{:08X} "
                         "and 0x{:08X}-0x{:08X}",
-                        i, j, a_start, a_end - 1, b_start, b_end - 1
+                        swap ? j : i, swap ? i : j,
+                        swap ? b_start : a_start, (swap ? b_end : a_end) - 1,
+                        swap ? a_start : b_start, (swap ? a_end : b_end) - 1
                     );
                 }
             }
+
+            const std::uint64_t end =
+                static_cast<std::uint64_t>(b_start) + seg_b.memory_size;
+            if (furthest.has_value() == false || end > furthest_end)
+            {
+                furthest = j;
+                furthest_end = end;
+            }
         }
 
         return {};
@@ -827,10 +1697,132 @@ namespace g10
 
 namespace g10
 {
+    auto program::index_sections (
+        const std::vector<object>& objects,
+        const std::vector<link_section>& sections
+    ) -> link_section_index
+    {
+        link_section_index index;
+
+        // Give each object one slot per section, so that a section can be
+        // looked up directly by its (object, section) pair.
+        index.slot_offsets.reserve(objects.size() + 1);
+        index.slot_offsets.push_back(0);
+        for (const auto& obj : objects)
+        {
+            index.slot_offsets.push_back(
+                index.slot_offsets.back() + obj.get_sections().size());
+        }
+
+        index.slots.assign(index.slot_offsets.back(), NO_LINK_SECTION);
+
+        // Group the sections' original address ranges by object. A range
+        // whose end wraps around the address space contains no address.
+        index.range_offsets.assign(objects.size() + 1, 0);
+        for (std::size_t i = 0; i < sections.size(); ++i)
+        {
+            const auto& sec = sections[i];
+            index.slots[index.slot_offsets[sec.object_index] +
+                sec.section_index] = i;
+            ++index.range_offsets[sec.object_index + 1];
+        }
+
+        for (std::size_t i = 1; i < index.range_offsets.size(); ++i)
+        {
+            index.range_offsets[i] += index.range_offsets[i - 1];
+        }
+
+        index.ranges.resize(sections.size());
+        std::vector<std::size_t> next_range {
+            index.range_offsets.begin(), index.range_offsets.end() - 1 };
+        for (std::size_t i = 0; i < sections.size(); ++i)
+        {
+            const auto& sec = sections[i];
+            const std::uint32_t start = sec.original_address;
+            const std::uint32_t end = start +
+                static_cast<std::uint32_t>(sec.data.size());
+            index.ranges[next_range[sec.object_index]++] = {
+                .start      = start,
+                .end        = std::max(start, end),
+                .max_end    = 0,
+                .section    = i
+            };
+        }
+
+        // Sort each object's ranges by start address, and record the greatest
+        // end seen so far, which lets a lookup stop scanning backwards as soon
+        // as no earlier range can reach the address.
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto first = index.ranges.begin() +
+                static_cast<std::ptrdiff_t>(index.range_offsets[obj_idx]);
+            const auto last = index.ranges.begin() +
+                static_cast<std::ptrdiff_t>(index.range_offsets[obj_idx + 1]);
+            std::sort(first, last,
+                [] (const link_section_range& a, const link_section_range& b)
+                {
+                    return a.start < b.start;
+                }
+            );
+
+            std::uint32_t max_end = 0;
+            for (auto it = first; it != last; ++it)
+            {
+                max_end = std::max(max_end, it->end);
+                it->max_end = max_end;
+            }
+        }
+
+        return index;
+    }
+
+    auto program::find_link_section (
+        const link_section_index& index,
+        std::size_t object_index,
+        std::size_t section_index,
+        std::uint32_t address
+    ) -> std::size_t
+    {
+        // First, try to find the exact section.
+        const std::size_t first_slot = index.slot_offsets[object_index];
+        if (section_index < index.slot_offsets[object_index + 1] - first_slot &&
+            index.slots[first_slot + section_index] != NO_LINK_SECTION)
+        {
+            return index.slots[first_slot + section_index];
+        }
+
+        // If the exact section was not collected (eg. it was empty), fall back
+        // to the first section of the same object, in link order, whose
+        // original address range contains the address.
+        const auto first = index.ranges.begin() +
+            static_cast<std::ptrdiff_t>(index.range_offsets[object_index]);
+        const auto last = index.ranges.begin() +
+            static_cast<std::ptrdiff_t>(index.range_offsets[object_index + 1]);
+        auto it = std::upper_bound(first, last, address,
+            [] (std::uint32_t value, const link_section_range& range)
+            {
+                return value < range.start;
+            }
+        );
+
+        std::size_t found = NO_LINK_SECTION;
+        while (it != first && std::prev(it)->max_end > address)
+        {
+            --it;
+            if (address < it->end)
+            {
+                found = std::min(found, it->section);
+            }
+        }
+
+        return found;
+    }
+
     auto program::collect_symbols (
         const std::vector<object>& objects,
         std::vector<resolved_symbol>& symbols,
-        const std::vector<link_section>& sections
+        const std::vector<link_section>& sections,
+        const link_section_index& index
     ) -> result<void>
     {
         // Map to track global symbols by name for duplicate detection and
@@ -840,63 +1832,39 @@ namespace g10
         // Helper lambda to find the address adjustment for a symbol.
         // The symbol's address needs to be adjusted based on the section
         // relocation (difference between original and final section address).
-        // 
-        // If the exact section wasn't collected (e.g., it was empty and skipped),
-        // we fall back to finding a section in the same object that contains
-        // the symbol's address.
         auto get_address_adjustment = [&](
             std::size_t obj_idx,
             std::size_t sec_idx,
             std::uint32_t symbol_addr
         ) -> std::int32_t
         {
-            // First, try to find the exact section.
-            for (const auto& link_sec : sections)
-            {
-                if (link_sec.object_index == obj_idx &&
-                    link_sec.section_index == sec_idx)
-                {
-                    // Return the difference between final and original address.
-                    return static_cast<std::int32_t>(link_sec.address) -
-                           static_cast<std::int32_t>(link_sec.original_address);
-                }
-            }
-
-            // If exact section not found (was skipped as empty), find a section
-            // in the same object whose original address range contains the symbol.
-            for (const auto& link_sec : sections)
+            const std::size_t link_idx = find_link_section(index, obj_idx,
+                sec_idx, symbol_addr);
+            if (link_idx == NO_LINK_SECTION)
             {
-                if (link_sec.object_index == obj_idx)
-                {
-                    const std::uint32_t sec_start = link_sec.original_address;
-                    const std::uint32_t sec_end = sec_start + 
-                        static_cast<std::uint32_t>(link_sec.data.size());
-                    
-                    if (symbol_addr >= sec_start && symbol_addr < sec_end)
-                    {
-                        // Found a section containing the symbol.
-                        return static_cast<std::int32_t>(link_sec.address) -
-                               static_cast<std::int32_t>(link_sec.original_address);
-                    }
-                }
+                // No adjustment needed if no matching section found.
+                return 0;
             }
 
-            // No adjustment needed if no matching section found.
-            return 0;
+            // Return the difference between final and original address.
+            const auto& link_sec = sections[link_idx];
+            return static_cast<std::int32_t>(link_sec.address) -
+                   static_cast<std::int32_t>(link_sec.original_address);
         };
 
-        // First pass: Collect all global and local symbols from each object.
-        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        // First pass: Resolve the final addresses of each object's global and
+        // local symbols. Objects are independent here, so they are resolved
+        // concurrently, each into its own partial symbol table.
+        std::vector<std::vector<resolved_symbol>> object_symbols(objects.size());
+        parallel_for(objects.size(), [&] (std::size_t obj_idx)
         {
-            const auto& obj = objects[obj_idx];
-            const auto& obj_symbols = obj.get_symbols();
-            const auto& obj_sections = obj.get_sections();
+            const auto& obj_symbols = objects[obj_idx].get_symbols();
+            auto& partial = object_symbols[obj_idx];
+            partial.reserve(obj_symbols.size());
 
-            for (std::size_t sym_idx = 0; sym_idx < obj_symbols.size(); ++sym_idx)
+            for (const auto& sym : obj_symbols)
             {
-                const auto& sym = obj_symbols[sym_idx];
-
-                // Skip extern symbols for now - they'll be resolved in pass 2.
+                // Skip extern symbols for now - they'll be resolved in pass 3.
                 if (sym.binding == symbol_binding::extern_)
                 {
                     continue;
@@ -910,12 +1878,34 @@ namespace g10
                 std::uint32_t final_address = static_cast<std::uint32_t>(
                     static_cast<std::int32_t>(sym.value) + adjustment);
 
-                // Check for duplicate global symbols.
-                if (sym.binding == symbol_binding::global)
-                {
-                    auto it = global_symbol_map.find(sym.name);
-                    if (it != global_symbol_map.end())
-                    {
+                // Create the resolved symbol.
+                resolved_symbol resolved;
+                resolved.name = sym.name;
+                resolved.address = final_address;
+                resolved.type = sym.type;
+                resolved.binding = sym.binding;
+                resolved.flags = sym.flags;
+                resolved.object_index = obj_idx;
+                resolved.section_index = sym.section_index;
+                partial.push_back(std::move(resolved));
+            }
+        });
+
+        // Second pass: Merge the partial symbol tables in object order, so
+        // that duplicate globals are detected and reported deterministically.
+        symbols.reserve(std::transform_reduce(object_symbols.begin(),
+            object_symbols.end(), std::size_t { 0 }, std::plus<> {},
+            [] (const auto& partial) { return partial.size(); }));
+        for (auto& partial : object_symbols)
+        {
+            for (auto& resolved : partial)
+            {
+                // Check for duplicate global symbols.
+                if (resolved.binding == symbol_binding::global)
+                {
+                    auto it = global_symbol_map.find(resolved.name);
+                    if (it != global_symbol_map.end())
+                    {
                         // Allow weak symbols to be overridden.
                         const auto& existing = symbols[it->second];
                         if (existing.binding != symbol_binding::weak)
@@ -923,34 +1913,25 @@ namespace g10
                             return error(
                                 "Duplicate global symbol '{}' defined in "
                                 "object {} and object {}",
-                                sym.name, existing.object_index, obj_idx
+                                resolved.name, existing.object_index,
+                                resolved.object_index
                             );
                         }
                     }
                 }
 
-                // Create the resolved symbol.
-                resolved_symbol resolved;
-                resolved.name = sym.name;
-                resolved.address = final_address;
-                resolved.type = sym.type;
-                resolved.binding = sym.binding;
-                resolved.flags = sym.flags;
-                resolved.object_index = obj_idx;
-                resolved.section_index = sym.section_index;
-
                 // Track global symbols for extern resolution.
-                if (sym.binding == symbol_binding::global ||
-                    sym.binding == symbol_binding::weak)
+                if (resolved.binding == symbol_binding::global ||
+                    resolved.binding == symbol_binding::weak)
                 {
-                    global_symbol_map[sym.name] = symbols.size();
+                    global_symbol_map[resolved.name] = symbols.size();
                 }
 
                 symbols.push_back(std::move(resolved));
             }
         }
 
-        // Second pass: Resolve extern symbols.
+        // Third pass: Resolve extern symbols.
         for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
         {
             const auto& obj = objects[obj_idx];
@@ -981,8 +1962,550 @@ namespace g10
         return {};
     }
 
+    auto program::find_live_sections (
+        const std::vector<object>& objects,
+        const link_options& options
+    ) -> result<std::vector<std::vector<bool>>>
+    {
+        // Map each global and weak symbol name to the sections defining it.
+        // Every definition of a name is kept, whichever one it resolves to.
+        std::unordered_map<std::string_view,
+            std::vector<std::pair<std::size_t, std::size_t>>> definitions;
+        std::vector<resolved_symbol> entry_candidates;
+        std::vector<std::size_t> entry_sections;
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj = objects[obj_idx];
+            for (const auto& sym : obj.get_symbols())
+            {
+                if (sym.binding == symbol_binding::global ||
+                    sym.binding == symbol_binding::weak)
+                {
+                    if (const std::size_t sec_idx = find_symbol_section(obj, sym);
+                        sec_idx != NO_LINK_SECTION)
+                    {
+                        definitions[sym.name].emplace_back(obj_idx, sec_idx);
+                    }
+                    else
+                    {
+                        definitions.try_emplace(sym.name);
+                    }
+                }
+
+                // Gather the symbols which could be selected as the entry
+                // point, in link order.
+                if (sym.binding != symbol_binding::extern_ &&
+                    ((sym.flags & symbol_flags::entry) != symbol_flags::none ||
+                     sym.name == "main" || sym.name == "_start"))
+                {
+                    entry_candidates.push_back({
+                        .name           = sym.name,
+                        .address        = sym.value,
+                        .type           = sym.type,
+                        .binding        = sym.binding,
+                        .flags          = sym.flags,
+                        .object_index   = obj_idx,
+                        .section_index  = sym.section_index
+                    });
+                    entry_sections.push_back(find_symbol_section(obj, sym));
+                }
+            }
+        }
+
+        std::vector<std::vector<bool>> live(objects.size());
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            live[obj_idx].resize(objects[obj_idx].get_sections().size(), false);
+        }
+
+        std::deque<std::pair<std::size_t, std::size_t>> pending;
+        auto mark = [&] (std::size_t obj_idx, std::size_t sec_idx)
+        {
+            if (sec_idx != NO_LINK_SECTION && live[obj_idx][sec_idx] == false)
+            {
+                live[obj_idx][sec_idx] = true;
+                pending.emplace_back(obj_idx, sec_idx);
+            }
+        };
+
+        auto mark_definitions = [&] (std::string_view name)
+        {
+            if (const auto it = definitions.find(name); it != definitions.end())
+            {
+                for (const auto& [def_obj, def_sec] : it->second)
+                {
+                    mark(def_obj, def_sec);
+                }
+            }
+        };
+
+        // Mark the roots: the entry point's section, the sections placed in
+        // the metadata or interrupt vector regions, and the sections defining
+        // the symbols to keep. A missing entry point is left for
+        // `find_entry_point` to report.
+        if (const auto* entry = select_entry_symbol(entry_candidates);
+            entry != nullptr)
+        {
+            mark(entry->object_index,
+                entry_sections[entry - entry_candidates.data()]);
+        }
+
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj_sections = objects[obj_idx].get_sections();
+            for (std::size_t sec_idx = 0; sec_idx < obj_sections.size();
+                ++sec_idx)
+            {
+                const auto& sec = obj_sections[sec_idx];
+                if (is_linked_section(sec) == true &&
+                    sec.virtual_address < PROGRAM_CODE_START)
+                {
+                    mark(obj_idx, sec_idx);
+                }
+            }
+        }
+
+        for (const auto& name : options.keep_symbols)
+        {
+            if (definitions.contains(name) == false)
+            {
+                return error("Symbol '{}' to keep is not defined", name);
+            }
+
+            mark_definitions(name);
+        }
+
+        // Find each section's relocations, and each object's extern symbols
+        // which no relocation references. A reference the assembler resolved
+        // without a relocation cannot be traced to its section, so such a
+        // symbol is reached from every live section of its object.
+        std::vector<std::vector<std::vector<std::size_t>>> relocations(
+            objects.size());
+        std::vector<std::vector<std::string_view>> untraced(objects.size());
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj = objects[obj_idx];
+            const auto& obj_symbols = obj.get_symbols();
+            const auto& obj_relocs = obj.get_relocations();
+            std::vector<bool> traced(obj_symbols.size(), false);
+            relocations[obj_idx].resize(obj.get_sections().size());
+            for (std::size_t i = 0; i < obj_relocs.size(); ++i)
+            {
+                const auto& reloc = obj_relocs[i];
+                if (reloc.section_index < relocations[obj_idx].size() &&
+                    reloc.symbol_index < obj_symbols.size())
+                {
+                    relocations[obj_idx][reloc.section_index].push_back(i);
+                    traced[reloc.symbol_index] = true;
+                }
+            }
+
+            for (std::size_t sym_idx = 0; sym_idx < obj_symbols.size();
+                ++sym_idx)
+            {
+                if (obj_symbols[sym_idx].binding == symbol_binding::extern_ &&
+                    traced[sym_idx] == false)
+                {
+                    untraced[obj_idx].push_back(obj_symbols[sym_idx].name);
+                }
+            }
+        }
+
+        // Follow each live section's relocations to the sections holding
+        // their symbols: a local symbol's own section, or every section
+        // defining a global, weak or extern symbol's name. Unresolved externs
+        // are left for `collect_symbols`.
+        std::vector<bool> untraced_followed(objects.size(), false);
+        while (pending.empty() == false)
+        {
+            const auto [obj_idx, sec_idx] = pending.front();
+            pending.pop_front();
+
+            const auto& obj = objects[obj_idx];
+            const auto& obj_symbols = obj.get_symbols();
+            for (const std::size_t i : relocations[obj_idx][sec_idx])
+            {
+                const auto& sym =
+                    obj_symbols[obj.get_relocations()[i].symbol_index];
+                if (sym.binding == symbol_binding::local_)
+                {
+                    mark(obj_idx, find_symbol_section(obj, sym));
+                }
+                else
+                {
+                    mark_definitions(sym.name);
+                }
+            }
+
+            if (untraced_followed[obj_idx] == false)
+            {
+                untraced_followed[obj_idx] = true;
+                for (const auto name : untraced[obj_idx])
+                {
+                    mark_definitions(name);
+                }
+            }
+        }
+
+        return live;
+    }
+
+    auto program::find_identical_sections (
+        const std::vector<object>& objects,
+        const std::vector<std::vector<bool>>& live
+    ) -> std::map<std::pair<std::size_t, std::size_t>,
+        std::pair<std::size_t, std::size_t>>
+    {
+        // Find the sections which may be folded, in link order.
+        struct fold_candidate final
+        {
+            std::size_t                 object_index;
+            std::size_t                 section_index;
+            std::uint64_t               contents_hash;
+            std::vector<std::array<std::uint32_t, 7>> relocations;
+            std::uint64_t               hash;
+            bool                        foldable;
+        };
+
+        std::vector<fold_candidate> candidates;
+        std::vector<std::vector<std::size_t>> candidate_of(objects.size());
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj_sections = objects[obj_idx].get_sections();
+            candidate_of[obj_idx].resize(obj_sections.size(), NO_LINK_SECTION);
+            for (std::size_t sec_idx = 0; sec_idx < obj_sections.size();
+                ++sec_idx)
+            {
+                const auto& sec = obj_sections[sec_idx];
+                if (is_live_section(live, obj_idx, sec_idx) == true &&
+                    is_linked_section(sec) == true &&
+                    sec.type != section_type::bss &&
+                    (sec.flags & section_flags::write) == section_flags::none &&
+                    sec.virtual_address >= PROGRAM_CODE_START)
+                {
+                    candidate_of[obj_idx][sec_idx] = candidates.size();
+                    candidates.push_back({
+                        .object_index   = obj_idx,
+                        .section_index  = sec_idx,
+                        .contents_hash  = 0,
+                        .relocations    = {},
+                        .hash           = 0,
+                        .foldable       = true
+                    });
+                }
+            }
+        }
+
+        // Resolve each global and weak name as the linker does, to its last
+        // definition in link order, as a section and an offset within it. A
+        // symbol in no linked section is resolved to its address, with no
+        // section.
+        struct symbol_target final
+        {
+            std::size_t     object_index;
+            std::size_t     section_index;
+            std::uint32_t   offset;
+        };
+
+        auto locate = [&] (std::size_t obj_idx, const object_symbol& sym)
+            -> symbol_target
+        {
+            const auto& obj = objects[obj_idx];
+            const std::size_t sec_idx = find_symbol_section(obj, sym);
+            if (sec_idx == NO_LINK_SECTION)
+            {
+                return { 0, NO_LINK_SECTION, sym.value };
+            }
+
+            return { obj_idx, sec_idx,
+                sym.value - obj.get_sections()[sec_idx].virtual_address };
+        };
+
+        std::unordered_map<std::string_view, symbol_target> definitions;
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            for (const auto& sym : objects[obj_idx].get_symbols())
+            {
+                if (sym.binding == symbol_binding::global ||
+                    sym.binding == symbol_binding::weak)
+                {
+                    definitions.insert_or_assign(sym.name,
+                        locate(obj_idx, sym));
+                }
+            }
+        }
+
+        // Hash each candidate's type, flags and contents, which do not change
+        // from one round to the next.
+        parallel_for(candidates.size(), [&] (std::size_t i)
+        {
+            auto& candidate = candidates[i];
+            const auto& sec = objects[candidate.object_index].get_sections()
+                [candidate.section_index];
+
+            std::vector<std::uint8_t> contents(8);
+            write_u32_le(contents, 0, static_cast<std::uint32_t>(sec.type) |
+                (static_cast<std::uint32_t>(sec.flags) << 16));
+            write_u32_le(contents, 4, static_cast<std::uint32_t>(
+                sec.data.size()));
+            contents.insert(contents.end(), sec.data.begin(), sec.data.end());
+            candidate.contents_hash = link_state::hash_bytes(contents);
+        });
+
+        // Two candidates are identical if their contents are, and if their
+        // relocations, in offset order, have the same types and addends, and
+        // resolve to the same targets: the same offset within the same
+        // section, or within the candidate itself for a reference to its own
+        // contents. A target section which is folded is replaced by the
+        // section it is folded into, so folding may let more sections fold;
+        // the candidates are compared again until no more do.
+        std::vector<std::size_t> representative(candidates.size());
+        std::iota(representative.begin(), representative.end(),
+            std::size_t { 0 });
+
+        auto identical = [&] (std::size_t i, std::size_t j)
+        {
+            const auto& a = candidates[i];
+            const auto& b = candidates[j];
+            const auto& sec_a = objects[a.object_index].get_sections()
+                [a.section_index];
+            const auto& sec_b = objects[b.object_index].get_sections()
+                [b.section_index];
+            return a.contents_hash == b.contents_hash &&
+                sec_a.type == sec_b.type && sec_a.flags == sec_b.flags &&
+                sec_a.data == sec_b.data && a.relocations == b.relocations;
+        };
+
+        while (true)
+        {
+            parallel_for(candidates.size(), [&] (std::size_t i)
+            {
+                auto& candidate = candidates[i];
+                const auto& obj = objects[candidate.object_index];
+                const auto& obj_symbols = obj.get_symbols();
+
+                candidate.relocations.clear();
+                for (const auto& reloc : obj.get_relocations())
+                {
+                    if (reloc.section_index != candidate.section_index)
+                    {
+                        continue;
+                    }
+                    else if (reloc.symbol_index >= obj_symbols.size())
+                    {
+                        candidate.foldable = false;
+                        return;
+                    }
+
+                    const auto& sym = obj_symbols[reloc.symbol_index];
+                    symbol_target target;
+                    if (sym.binding == symbol_binding::local_)
+                    {
+                        target = locate(candidate.object_index, sym);
+                    }
+                    else if (const auto it = definitions.find(sym.name);
+                        it != definitions.end())
+                    {
+                        target = it->second;
+                    }
+                    else
+                    {
+                        // - An unresolved extern is left for the linker to
+                        //   report.
+                        candidate.foldable = false;
+                        return;
+                    }
+
+                    // - Describe the target as a fixed address, as the
+                    //   candidate itself, or as its section, replaced by the
+                    //   section that one is folded into.
+                    std::uint32_t kind = 2;
+                    if (target.section_index == NO_LINK_SECTION)
+                    {
+                        kind = 0;
+                        target.object_index = 0;
+                        target.section_index = 0;
+                    }
+                    else if (const std::size_t k = candidate_of
+                        [target.object_index][target.section_index];
+                        k == i)
+                    {
+                        kind = 1;
+                        target.object_index = 0;
+                        target.section_index = 0;
+                    }
+                    else if (k != NO_LINK_SECTION)
+                    {
+                        target.object_index =
+                            candidates[representative[k]].object_index;
+                        target.section_index =
+                            candidates[representative[k]].section_index;
+                    }
+
+                    candidate.relocations.push_back({
+                        reloc.offset,
+                        static_cast<std::uint32_t>(reloc.type),
+                        static_cast<std::uint32_t>(reloc.addend),
+                        kind,
+                        static_cast<std::uint32_t>(target.object_index),
+                        static_cast<std::uint32_t>(target.section_index),
+                        target.offset
+                    });
+                }
+
+                std::sort(candidate.relocations.begin(),
+                    candidate.relocations.end());
+
+                std::vector<std::uint8_t> buffer(8 +
+                    candidate.relocations.size() * 7 * 4);
+                write_u32_le(buffer, 0, static_cast<std::uint32_t>(
+                    candidate.contents_hash));
+                write_u32_le(buffer, 4, static_cast<std::uint32_t>(
+                    candidate.contents_hash >> 32));
+                std::size_t offset = 8;
+                for (const auto& entry : candidate.relocations)
+                {
+                    for (const std::uint32_t value : entry)
+                    {
+                        write_u32_le(buffer, offset, value);
+                        offset += 4;
+                    }
+                }
+
+                candidate.hash = link_state::hash_bytes(buffer);
+            });
+
+            // - Group the candidates by hash, and fold each into the first
+            //   earlier candidate identical to it.
+            std::vector<std::size_t> next(candidates.size());
+            std::unordered_map<std::uint64_t, std::vector<std::size_t>> buckets;
+            for (std::size_t i = 0; i < candidates.size(); ++i)
+            {
+                next[i] = i;
+                if (candidates[i].foldable == false)
+                {
+                    continue;
+                }
+
+                auto& bucket = buckets[candidates[i].hash];
+                const auto it = std::find_if(bucket.begin(), bucket.end(),
+                    [&] (std::size_t j) { return identical(i, j); });
+                if (it == bucket.end())
+                {
+                    bucket.push_back(i);
+                }
+                else
+                {
+                    next[i] = *it;
+                }
+            }
+
+            if (next == representative)
+            {
+                break;
+            }
+
+            representative = std::move(next);
+        }
+
+        std::map<std::pair<std::size_t, std::size_t>,
+            std::pair<std::size_t, std::size_t>> folds;
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (representative[i] != i)
+            {
+                const auto& target = candidates[representative[i]];
+                folds.emplace(
+                    std::pair { candidates[i].object_index,
+                        candidates[i].section_index },
+                    std::pair { target.object_index, target.section_index }
+                );
+            }
+        }
+
+        return folds;
+    }
+
+    auto program::rank_sections (
+        const std::vector<object>& objects,
+        const std::vector<std::vector<bool>>& live,
+        const link_options& options
+    ) -> std::map<std::pair<std::size_t, std::size_t>, section_rank>
+    {
+        std::map<std::pair<std::size_t, std::size_t>, section_rank> ranks;
+        if (options.section_order.empty() == true)
+        {
+            return ranks;
+        }
+
+        // Rank the entries by descending count, with uncounted entries first,
+        // keeping the given order among equals. Where a symbol is named more
+        // than once, its entry of highest rank is used.
+        const auto& entries = options.section_order;
+        std::vector<std::size_t> order(entries.size());
+        std::iota(order.begin(), order.end(), std::size_t { 0 });
+        std::ranges::stable_sort(order,
+            [&] (std::size_t a, std::size_t b)
+            {
+                return entries[b].count.has_value() == true &&
+                    (entries[a].count.has_value() == false ||
+                        entries[a].count.value() > entries[b].count.value());
+            }
+        );
+
+        std::unordered_map<std::string_view, std::size_t> entry_ranks;
+        for (std::size_t rank = 0; rank < order.size(); ++rank)
+        {
+            entry_ranks.try_emplace(entries[order[rank]].symbol, rank);
+        }
+
+        // Rank each ROM section defining a named symbol, global or local.
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj_sections = objects[obj_idx].get_sections();
+            for (const auto& sym : objects[obj_idx].get_symbols())
+            {
+                const auto entry = entry_ranks.find(sym.name);
+                if (entry == entry_ranks.end() ||
+                    sym.binding == symbol_binding::extern_ ||
+                    sym.section_index >= obj_sections.size() ||
+                    is_live_section(live, obj_idx, sym.section_index) == false)
+                {
+                    continue;
+                }
+
+                const auto& sec = obj_sections[sym.section_index];
+                if (is_linked_section(sec) == false ||
+                    sec.virtual_address < PROGRAM_CODE_START ||
+                    sec.virtual_address > 0x7FFFFFFF)
+                {
+                    continue;
+                }
+
+                const section_rank rank {
+                    .rank = entry->second,
+                    .cold = entries[order[entry->second]].count == 0
+                };
+                const auto [it, inserted] = ranks.try_emplace(
+                    std::pair { obj_idx, std::size_t { sym.section_index } },
+                    rank);
+                if (inserted == false && rank.rank < it->second.rank)
+                {
+                    it->second = rank;
+                }
+            }
+        }
+
+        return ranks;
+    }
+
     auto program::collect_sections (
         const std::vector<object>& objects,
+        const std::vector<std::vector<bool>>& live,
+        const std::map<std::pair<std::size_t, std::size_t>,
+            std::pair<std::size_t, std::size_t>>& folds,
+        const std::map<std::pair<std::size_t, std::size_t>,
+            section_rank>& ranks,
         std::vector<link_section>& sections
     ) -> result<void>
     {
@@ -1018,80 +2541,129 @@ namespace g10
                 return &ram_region;
         };
 
-        // Collect all non-null sections from each object file.
-        // For each section, we need to determine if it should be relocated.
-        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        // The addresses of the sections which others are folded into. Such a
+        // section precedes the sections folded into it in placement order, so
+        // it is always placed first.
+        std::map<std::pair<std::size_t, std::size_t>, std::uint32_t>
+            fold_addresses;
+        for (const auto& [folded, target] : folds)
         {
-            const auto& obj = objects[obj_idx];
-            const auto& obj_sections = obj.get_sections();
+            fold_addresses.emplace(target, 0);
+        }
 
+        // Gather all non-null sections from each linked object file, in link
+        // order. Without a section ordering, they are placed in that order.
+        // Otherwise, the hot sections are placed first, hottest first, and
+        // the cold sections after all others; the folded sections, which take
+        // no space, are placed last, after the sections they are folded into.
+        std::vector<std::pair<std::size_t, std::size_t>> placement_order;
+        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
+        {
+            const auto& obj_sections = objects[obj_idx].get_sections();
             for (std::size_t sec_idx = 0; sec_idx < obj_sections.size(); ++sec_idx)
             {
-                const auto& sec = obj_sections[sec_idx];
-
-                // Skip null sections.
-                if (sec.type == section_type::null_)
+                // Skip null and empty sections, and those not live.
+                if (is_linked_section(obj_sections[sec_idx]) == true &&
+                    is_live_section(live, obj_idx, sec_idx) == true)
                 {
-                    continue;
+                    placement_order.emplace_back(obj_idx, sec_idx);
                 }
+            }
+        }
 
-                // Skip empty non-BSS sections.
-                if (sec.type != section_type::bss && sec.data.empty())
+        if (ranks.empty() == false)
+        {
+            const auto placement_key = [&] (
+                const std::pair<std::size_t, std::size_t>& key
+            ) -> std::pair<int, std::size_t>
+            {
+                if (folds.contains(key) == true)
                 {
-                    continue;
+                    return { 3, 0 };
                 }
-
-                // Get the section's original address and size.
-                // For BSS sections, the data size represents the reservation size.
-                std::uint32_t orig_addr = sec.virtual_address;
-                std::uint32_t sec_size = static_cast<std::uint32_t>(sec.data.size());
-                
-                // BSS sections with zero data size should be skipped.
-                if (sec.type == section_type::bss && sec_size == 0)
+                else if (const auto it = ranks.find(key); it != ranks.end())
                 {
-                    continue;
+                    return { (it->second.cold == true) ? 2 : 0, it->second.rank };
                 }
 
-                // Get the region for this section.
-                region_tracker* region = get_region(orig_addr);
+                return { 1, 0 };
+            };
 
-                // Determine the new address for this section.
-                // If the section's address is at or after the region's next
-                // available address, use the original address.
-                // Otherwise, relocate to the next available address.
-                std::uint32_t new_addr = orig_addr;
-                
-                if (orig_addr < region->next_addr)
+            std::ranges::stable_sort(placement_order,
+                [&] (const auto& a, const auto& b)
                 {
-                    // Section would overlap with already-placed content.
-                    // Relocate to the next available address.
-                    new_addr = region->next_addr;
+                    return placement_key(a) < placement_key(b);
                 }
+            );
+        }
 
-                // Update the region's next available address.
-                region->next_addr = new_addr + sec_size;
-
-                // Create a link section with the potentially relocated address.
-                link_section link_sec;
-                link_sec.object_index = obj_idx;
-                link_sec.section_index = sec_idx;
-                link_sec.address = new_addr;
-                link_sec.original_address = orig_addr;  // Track for relocation adjustments.
-                link_sec.type = sec.type;
-                link_sec.flags = sec.flags;
-
-                // Copy section data (BSS sections have no data).
-                if (sec.type != section_type::bss)
+        // For each section, we need to determine if it should be relocated.
+        for (const auto& key : placement_order)
+        {
+            const auto& [obj_idx, sec_idx] = key;
+            const auto& sec = objects[obj_idx].get_sections()[sec_idx];
+
+            // Get the section's original address and size.
+            // For BSS sections, the data size represents the reservation size.
+            std::uint32_t orig_addr = sec.virtual_address;
+            std::uint32_t sec_size = static_cast<std::uint32_t>(sec.data.size());
+
+            // Get the region for this section.
+            region_tracker* region = get_region(orig_addr);
+
+            // Determine the new address for this section.
+            // A folded section shares the address of the section it is
+            // folded into, and takes no space of its own.
+            // A ranked section is packed at the region's next available
+            // address.
+            // If the section's address is at or after the region's next
+            // available address, use the original address.
+            // Otherwise, relocate to the next available address.
+            std::uint32_t new_addr = orig_addr;
+
+            if (const auto fold = folds.find(key); fold != folds.end())
+            {
+                new_addr = fold_addresses.at(fold->second);
+            }
+            else
+            {
+                if (orig_addr < region->next_addr || ranks.contains(key) == true)
                 {
-                    link_sec.data = sec.data;
+                    // Section would overlap with already-placed content, or
+                    // is packed. Relocate to the next available address.
+                    new_addr = region->next_addr;
                 }
-                else
+
+                // Update the region's next available address.
+                region->next_addr = new_addr + sec_size;
+
+                if (const auto target = fold_addresses.find(key);
+                    target != fold_addresses.end())
                 {
-                    link_sec.data.resize(0);
+                    target->second = new_addr;
                 }
+            }
 
-                sections.push_back(std::move(link_sec));
+            // Create a link section with the potentially relocated address.
+            link_section link_sec;
+            link_sec.object_index = obj_idx;
+            link_sec.section_index = sec_idx;
+            link_sec.address = new_addr;
+            link_sec.original_address = orig_addr;  // Track for relocation adjustments.
+            link_sec.type = sec.type;
+            link_sec.flags = sec.flags;
+
+            // Copy section data (BSS sections have no data).
+            if (sec.type != section_type::bss)
+            {
+                link_sec.data = sec.data;
+            }
+            else
+            {
+                link_sec.data.resize(0);
             }
+
+            sections.push_back(std::move(link_sec));
         }
 
         // Sort sections by address for segment generation.
@@ -1107,8 +2679,10 @@ namespace g10
 
     auto program::apply_relocations (
         const std::vector<object>& objects,
+        const std::vector<std::vector<bool>>& live,
         const std::vector<resolved_symbol>& symbols,
-        std::vector<link_section>& sections
+        std::vector<link_section>& sections,
+        const link_section_index& index
     ) -> result<void>
     {
         // Build a map to quickly find resolved symbols by name.
@@ -1124,281 +2698,267 @@ namespace g10
             }
         }
 
-        // Build a map to find link_section index from (obj_idx, sec_idx).
-        std::unordered_map<std::uint64_t, std::size_t> section_map;
-        for (std::size_t i = 0; i < sections.size(); ++i)
+        // Applies a single relocation from the given object to its target
+        // section's data.
+        auto apply_relocation = [&] (
+            std::size_t obj_idx,
+            const object_relocation& reloc,
+            link_section& target_section
+        ) -> result<void>
         {
-            const auto& sec = sections[i];
-            const std::uint64_t key =
-                (static_cast<std::uint64_t>(sec.object_index) << 32) |
-                sec.section_index;
-            section_map[key] = i;
-        }
+            const auto& obj_symbols = objects[obj_idx].get_symbols();
 
-        // Process relocations from each object file.
-        for (std::size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx)
-        {
-            const auto& obj = objects[obj_idx];
-            const auto& obj_relocs = obj.get_relocations();
-            const auto& obj_symbols = obj.get_symbols();
+            // Get the symbol this relocation references.
+            if (reloc.symbol_index >= obj_symbols.size())
+            {
+                return error(
+                    "Relocation references invalid symbol index {} in "
+                    "object {}",
+                    reloc.symbol_index, obj_idx
+                );
+            }
+
+            const auto& ref_sym = obj_symbols[reloc.symbol_index];
 
-            for (const auto& reloc : obj_relocs)
+            // Resolve the symbol's final address.
+            std::uint32_t symbol_address = 0;
+
+            // Helper to get the adjusted address for a local symbol.
+            // The symbol value is relative to the original section address,
+            // but the section may have been relocated.
+            // If the exact section wasn't collected, find a section that
+            // contains the symbol's address.
+            auto get_local_symbol_address = [&](
+                std::size_t sym_section_index,
+                std::uint32_t sym_value
+            ) -> std::uint32_t
             {
-                // Find the target section in our link sections.
-                const std::uint64_t sec_key =
-                    (static_cast<std::uint64_t>(obj_idx) << 32) |
-                    reloc.section_index;
-                auto sec_it = section_map.find(sec_key);
-                if (sec_it == section_map.end())
+                const std::size_t link_idx = find_link_section(index,
+                    obj_idx, sym_section_index, sym_value);
+                if (link_idx == NO_LINK_SECTION)
                 {
-                    return error(
-                        "Relocation references unknown section {} in object {}",
-                        reloc.section_index, obj_idx
-                    );
+                    // No adjustment found.
+                    return sym_value;
                 }
 
-                auto& target_section = sections[sec_it->second];
+                // Calculate adjustment: final - original address.
+                const auto& link_sec = sections[link_idx];
+                std::int32_t adjustment =
+                    static_cast<std::int32_t>(link_sec.address) -
+                    static_cast<std::int32_t>(link_sec.original_address);
+                return static_cast<std::uint32_t>(
+                    static_cast<std::int32_t>(sym_value) + adjustment);
+            };
 
-                // Get the symbol this relocation references.
-                if (reloc.symbol_index >= obj_symbols.size())
+            if (ref_sym.binding == symbol_binding::extern_)
+            {
+                // Look up the global definition.
+                auto it = symbol_map.find(ref_sym.name);
+                if (it == symbol_map.end())
                 {
                     return error(
-                        "Relocation references invalid symbol index {} in "
+                        "Unresolved external '{}' for relocation in "
                         "object {}",
-                        reloc.symbol_index, obj_idx
+                        ref_sym.name, obj_idx
                     );
                 }
-
-                const auto& ref_sym = obj_symbols[reloc.symbol_index];
-
-                // Resolve the symbol's final address.
-                std::uint32_t symbol_address = 0;
-
-                // Helper to get the adjusted address for a local symbol.
-                // The symbol value is relative to the original section address,
-                // but the section may have been relocated.
-                // If the exact section wasn't collected, find a section that
-                // contains the symbol's address.
-                auto get_local_symbol_address = [&](
-                    std::size_t sym_section_index,
-                    std::uint32_t sym_value
-                ) -> std::uint32_t
-                {
-                    // First, try to find the exact section.
-                    const std::uint64_t local_sec_key =
-                        (static_cast<std::uint64_t>(obj_idx) << 32) |
-                        sym_section_index;
-                    auto local_sec_it = section_map.find(local_sec_key);
-                    if (local_sec_it != section_map.end())
-                    {
-                        const auto& link_sec = sections[local_sec_it->second];
-                        // Calculate adjustment: final - original address.
-                        std::int32_t adjustment = 
-                            static_cast<std::int32_t>(link_sec.address) -
-                            static_cast<std::int32_t>(link_sec.original_address);
-                        return static_cast<std::uint32_t>(
-                            static_cast<std::int32_t>(sym_value) + adjustment);
-                    }
-
-                    // Fallback: find a section containing the symbol address.
-                    for (const auto& link_sec : sections)
-                    {
-                        if (link_sec.object_index == obj_idx)
-                        {
-                            const std::uint32_t sec_start = link_sec.original_address;
-                            const std::uint32_t sec_end = sec_start + 
-                                static_cast<std::uint32_t>(link_sec.data.size());
-                            
-                            if (sym_value >= sec_start && sym_value < sec_end)
-                            {
-                                std::int32_t adjustment = 
-                                    static_cast<std::int32_t>(link_sec.address) -
-                                    static_cast<std::int32_t>(link_sec.original_address);
-                                return static_cast<std::uint32_t>(
-                                    static_cast<std::int32_t>(sym_value) + adjustment);
-                            }
-                        }
-                    }
-
-                    // No adjustment found.
-                    return sym_value;
-                };
-
-                if (ref_sym.binding == symbol_binding::extern_)
+                symbol_address = symbols[it->second].address;
+            }
+            else if (ref_sym.binding == symbol_binding::global ||
+                     ref_sym.binding == symbol_binding::weak)
+            {
+                // Use the global symbol map.
+                auto it = symbol_map.find(ref_sym.name);
+                if (it != symbol_map.end())
                 {
-                    // Look up the global definition.
-                    auto it = symbol_map.find(ref_sym.name);
-                    if (it == symbol_map.end())
-                    {
-                        return error(
-                            "Unresolved external '{}' for relocation in "
-                            "object {}",
-                            ref_sym.name, obj_idx
-                        );
-                    }
                     symbol_address = symbols[it->second].address;
                 }
-                else if (ref_sym.binding == symbol_binding::global ||
-                         ref_sym.binding == symbol_binding::weak)
-                {
-                    // Use the global symbol map.
-                    auto it = symbol_map.find(ref_sym.name);
-                    if (it != symbol_map.end())
-                    {
-                        symbol_address = symbols[it->second].address;
-                    }
-                    else
-                    {
-                        // Calculate from local object data with adjustment.
-                        symbol_address = get_local_symbol_address(
-                            ref_sym.section_index, ref_sym.value);
-                    }
-                }
                 else
                 {
-                    // Local symbol - calculate address with adjustment.
+                    // Calculate from local object data with adjustment.
                     symbol_address = get_local_symbol_address(
                         ref_sym.section_index, ref_sym.value);
                 }
+            }
+            else
+            {
+                // Local symbol - calculate address with adjustment.
+                symbol_address = get_local_symbol_address(
+                    ref_sym.section_index, ref_sym.value);
+            }
+
+            // Add the relocation addend.
+            const std::int32_t final_value =
+                static_cast<std::int32_t>(symbol_address) + reloc.addend;
 
-                // Add the relocation addend.
-                const std::int32_t final_value =
-                    static_cast<std::int32_t>(symbol_address) + reloc.addend;
+            // Calculate PC-relative offset if needed.
+            const std::uint32_t reloc_address =
+                target_section.address + reloc.offset;
 
-                // Calculate PC-relative offset if needed.
-                const std::uint32_t reloc_address =
-                    target_section.address + reloc.offset;
+            // Validate relocation offset is within section data.
+            if (reloc.offset >= target_section.data.size())
+            {
+                return error(
+                    "Relocation offset {} exceeds section size {} in "
+                    "object {}",
+                    reloc.offset, target_section.data.size(), obj_idx
+                );
+            }
 
-                // Validate relocation offset is within section data.
-                if (reloc.offset >= target_section.data.size())
+            // A `JUMP32` relocation patches its whole jump, which starts at
+            // the opcode preceding the relocated field.
+            if (reloc.type == relocation_type::jump32)
+            {
+                if (reloc.offset < 2 ||
+                    reloc.offset + 4 > target_section.data.size() ||
+                    encode_jump(
+                        std::span { target_section.data }.subspan(
+                            reloc.offset - 2, 6),
+                        static_cast<std::uint32_t>(final_value),
+                        reloc_address - 2) == false)
                 {
                     return error(
-                        "Relocation offset {} exceeds section size {} in "
-                        "object {}",
-                        reloc.offset, target_section.data.size(), obj_idx
+                        "JUMP32 relocation at offset {} does not patch a "
+                        "jump instruction in object {}",
+                        reloc.offset, obj_idx
                     );
                 }
 
-                // Apply the relocation based on type.
-                switch (reloc.type)
-                {
-                case relocation_type::abs32:
-                    // 32-bit absolute address.
-                    if (reloc.offset + 4 > target_section.data.size())
-                    {
-                        return error(
-                            "ABS32 relocation at offset {} exceeds section "
-                            "bounds in object {}",
-                            reloc.offset, obj_idx
-                        );
-                    }
-                    write_u32_le(target_section.data, reloc.offset,
-                        static_cast<std::uint32_t>(final_value));
-                    break;
+                return {};
+            }
+            else if (is_reachable_offset(reloc.type, final_value) == false)
+            {
+                return error(
+                    "{} relocation at offset {} refers to address ${:08X}, "
+                    "which its instruction cannot reach, in object {}",
+                    relocation_type_name(reloc.type), reloc.offset,
+                    static_cast<std::uint32_t>(final_value), obj_idx
+                );
+            }
 
-                case relocation_type::abs16:
-                    // 16-bit absolute address (truncated).
-                    if (reloc.offset + 2 > target_section.data.size())
-                    {
-                        return error(
-                            "ABS16 relocation at offset {} exceeds section "
-                            "bounds in object {}",
-                            reloc.offset, obj_idx
-                        );
-                    }
-                    write_u16_le(target_section.data, reloc.offset,
-                        static_cast<std::uint16_t>(final_value & 0xFFFF));
-                    break;
+            // Encode the relocated field, then check that it fits within the
+            // section before patching it in.
+            std::array<std::uint8_t, 4> field {};
+            const std::size_t field_size = encode_relocation(reloc.type,
+                final_value, reloc_address, field);
+            if (reloc.offset + field_size > target_section.data.size())
+            {
+                return error(
+                    "{} relocation at offset {} exceeds section bounds in "
+                    "object {}",
+                    relocation_type_name(reloc.type), reloc.offset, obj_idx
+                );
+            }
 
-                case relocation_type::abs8:
-                    // 8-bit absolute address (truncated).
-                    target_section.data[reloc.offset] =
-                        static_cast<std::uint8_t>(final_value & 0xFF);
-                    break;
+            std::copy_n(field.begin(), field_size,
+                target_section.data.begin() + reloc.offset);
 
-                case relocation_type::rel32:
-                {
-                    // 32-bit PC-relative offset.
-                    // Offset is calculated from the end of the relocation field.
-                    const std::int32_t pc_offset =
-                        final_value - static_cast<std::int32_t>(reloc_address + 4);
-                    if (reloc.offset + 4 > target_section.data.size())
-                    {
-                        return error(
-                            "REL32 relocation at offset {} exceeds section "
-                            "bounds in object {}",
-                            reloc.offset, obj_idx
-                        );
-                    }
-                    write_u32_le(target_section.data, reloc.offset,
-                        static_cast<std::uint32_t>(pc_offset));
-                    break;
-                }
+            return {};
+        };
 
-                case relocation_type::rel16:
-                {
-                    // 16-bit PC-relative offset.
-                    const std::int32_t pc_offset =
-                        final_value - static_cast<std::int32_t>(reloc_address + 2);
-                    if (reloc.offset + 2 > target_section.data.size())
-                    {
-                        return error(
-                            "REL16 relocation at offset {} exceeds section "
-                            "bounds in object {}",
-                            reloc.offset, obj_idx
-                        );
-                    }
-                    write_u16_le(target_section.data, reloc.offset,
-                        static_cast<std::uint16_t>(pc_offset & 0xFFFF));
-                    break;
-                }
+        // Group the relocations by the link section they patch, keeping each
+        // group in object and relocation order. Each relocation only writes to
+        // its own section's data, and symbol addresses are final by now, so
+        // the groups can then be applied concurrently.
+        struct relocation_ref final
+        {
+            std::size_t                 object_index;
+            std::size_t                 relocation_index;
+        };
+
+        struct relocation_failure final
+        {
+            std::size_t                 object_index;
+            std::size_t                 relocation_index;
+            std::string                 message;
+        };
+
+        std::vector<std::vector<relocation_ref>> groups(sections.size());
+        std::optional<relocation_failure> failure;
+        for (std::size_t obj_idx = 0;
+            obj_idx < objects.size() && failure.has_value() == false;
+            ++obj_idx)
+        {
+            const auto& obj_relocs = objects[obj_idx].get_relocations();
+            const std::size_t first_slot = index.slot_offsets[obj_idx];
+            const std::size_t slot_count =
+                index.slot_offsets[obj_idx + 1] - first_slot;
 
-                case relocation_type::rel8:
+            for (std::size_t i = 0; i < obj_relocs.size(); ++i)
+            {
+                // Find the target section in our link sections. The
+                // relocations of a section which was dropped are skipped.
+                const auto& reloc = obj_relocs[i];
+                if (is_live_section(live, obj_idx, reloc.section_index) == false)
                 {
-                    // 8-bit PC-relative offset.
-                    const std::int32_t pc_offset =
-                        final_value - static_cast<std::int32_t>(reloc_address + 1);
-                    target_section.data[reloc.offset] =
-                        static_cast<std::uint8_t>(pc_offset & 0xFF);
-                    break;
+                    continue;
                 }
 
-                case relocation_type::quick16:
+                const std::size_t target_idx =
+                    (reloc.section_index < slot_count) ?
+                    index.slots[first_slot + reloc.section_index] :
+                    NO_LINK_SECTION;
+                if (target_idx == NO_LINK_SECTION)
                 {
-                    // 16-bit offset relative to $FFFF0000.
-                    const std::int32_t quick_offset =
-                        final_value - static_cast<std::int32_t>(0xFFFF0000);
-                    if (reloc.offset + 2 > target_section.data.size())
-                    {
-                        return error(
-                            "QUICK16 relocation at offset {} exceeds section "
-                            "bounds in object {}",
-                            reloc.offset, obj_idx
-                        );
-                    }
-                    write_u16_le(target_section.data, reloc.offset,
-                        static_cast<std::uint16_t>(quick_offset & 0xFFFF));
+                    failure = relocation_failure {
+                        obj_idx, i,
+                        std::format(
+                            "Relocation references unknown section {} in "
+                            "object {}",
+                            reloc.section_index, obj_idx
+                        )
+                    };
                     break;
                 }
 
-                case relocation_type::port8:
+                groups[target_idx].push_back({ obj_idx, i });
+            }
+        }
+
+        // Apply each section's relocations, stopping a section at its first
+        // failure.
+        std::vector<std::optional<relocation_failure>> failures(groups.size());
+        parallel_for(groups.size(), [&] (std::size_t section_idx)
+        {
+            for (const auto& ref : groups[section_idx])
+            {
+                const auto& reloc = objects[ref.object_index]
+                    .get_relocations()[ref.relocation_index];
+                auto result = apply_relocation(ref.object_index, reloc,
+                    sections[section_idx]);
+                if (result.has_value() == false)
                 {
-                    // 8-bit offset relative to $FFFFFF00.
-                    const std::int32_t port_offset =
-                        final_value - static_cast<std::int32_t>(0xFFFFFF00);
-                    target_section.data[reloc.offset] =
-                        static_cast<std::uint8_t>(port_offset & 0xFF);
-                    break;
+                    failures[section_idx] = relocation_failure {
+                        ref.object_index, ref.relocation_index,
+                        std::move(result.error())
+                    };
+                    return;
                 }
+            }
+        });
 
-                case relocation_type::none:
-                default:
-                    // No relocation needed.
-                    break;
-                }
+        // Report the failure the serial linker would have met first.
+        for (auto& section_failure : failures)
+        {
+            if (section_failure.has_value() == false)
+            {
+                continue;
+            }
+
+            if (failure.has_value() == false ||
+                std::tie(section_failure->object_index,
+                    section_failure->relocation_index) <
+                std::tie(failure->object_index, failure->relocation_index))
+            {
+                failure = std::move(section_failure);
             }
         }
 
+        if (failure.has_value() == true)
+        {
+            return error("{}", failure->message);
+        }
+
         return {};
     }
 
@@ -1572,6 +3132,44 @@ namespace g10
             }
         };
 
+        // Helper lambda to check if a section can be merged into a segment:
+        // if it overlaps the segment or is contiguous with it. Allow a small
+        // gap (up to 16 bytes) for contiguous merging to reduce fragmentation.
+        auto can_merge = [](const program_segment& segment, const link_section& sec)
+            -> bool
+        {
+            constexpr std::uint32_t MAX_GAP = 16;
+
+            const std::uint32_t seg_start = segment.load_address;
+            const std::uint32_t seg_end = seg_start + segment.memory_size;
+            const std::uint32_t sec_start = sec.address;
+            const std::uint32_t sec_end = sec_start +
+                static_cast<std::uint32_t>(sec.data.size());
+
+            bool overlaps = (sec_start < seg_end && sec_end > seg_start);
+            bool contiguous = (sec_start <= seg_end + MAX_GAP &&
+                               sec_start >= seg_start);
+
+            return overlaps || contiguous;
+        };
+
+        // The sections are sorted by address, so every segment starts at or
+        // before the section being merged, and a segment which a section can
+        // no longer reach can never be reached by a later one. Each group of
+        // compatible segment types keeps its segments which may still be
+        // merged into, in the order they were created; the first of them which
+        // the section can reach is the one it is merged into.
+        auto merge_group = [](segment_type type) -> std::size_t
+        {
+            return (type == segment_type::data) ?
+                std::to_underlying(segment_type::code) :
+                std::to_underlying(type);
+        };
+
+        std::array<std::deque<std::size_t>,
+            std::to_underlying(segment_type::interrupt) + 1> open_segments;
+        std::optional<std::size_t> bss_segment;
+
         // Process each section and merge into segments.
         for (const auto& sec : sections)
         {
@@ -1591,30 +3189,20 @@ namespace g10
             if (sec.type == section_type::bss)
             {
                 // Find or create a BSS segment.
-                bool found = false;
-                for (auto& segment : m_segments)
+                if (bss_segment.has_value())
                 {
-                    if (segment.type == segment_type::bss)
+                    // Extend BSS segment if needed.
+                    // BSS just needs to track the total memory reservation.
+                    // Use the minimum address and maximum extent.
+                    auto& segment = m_segments[bss_segment.value()];
+                    if (sec.address < segment.load_address)
                     {
-                        // Extend BSS segment if needed.
-                        // BSS just needs to track the total memory reservation.
-                        const std::uint32_t seg_end = 
-                            segment.load_address + segment.memory_size;
-                        
-                        // Use the minimum address and maximum extent.
-                        if (sec.address < segment.load_address)
-                        {
-                            segment.memory_size += 
-                                segment.load_address - sec.address;
-                            segment.load_address = sec.address;
-                        }
-                        
-                        found = true;
-                        break;
+                        segment.memory_size +=
+                            segment.load_address - sec.address;
+                        segment.load_address = sec.address;
                     }
                 }
-                
-                if (!found)
+                else
                 {
                     // Create new BSS segment.
                     program_segment segment;
@@ -1623,58 +3211,33 @@ namespace g10
                     segment.type = seg_type;
                     segment.flags = seg_flags;
                     segment.data.clear();
+                    bss_segment = m_segments.size();
                     m_segments.push_back(std::move(segment));
                 }
                 continue;
             }
 
-            // For non-BSS sections, find a compatible segment to merge into.
-            bool merged = false;
-            for (auto& segment : m_segments)
+            // For non-BSS sections, find a compatible segment to merge into,
+            // discarding those left behind.
+            auto& candidates = open_segments[merge_group(seg_type)];
+            while (candidates.empty() == false &&
+                can_merge(m_segments[candidates.front()], sec) == false)
             {
-                // Skip BSS segments for non-BSS sections.
-                if (segment.type == segment_type::bss)
-                {
-                    continue;
-                }
-
-                // Check if types are compatible.
-                if (!types_compatible(segment.type, seg_type))
-                {
-                    continue;
-                }
+                candidates.pop_front();
+            }
 
-                const std::uint32_t seg_start = segment.load_address;
-                const std::uint32_t seg_end = seg_start + segment.memory_size;
-                const std::uint32_t sec_start = sec.address;
-                const std::uint32_t sec_end = sec_start + 
-                    static_cast<std::uint32_t>(sec.data.size());
+            if (candidates.empty() == false)
+            {
+                auto& segment = m_segments[candidates.front()];
+                merge_section_into_segment(segment, sec);
 
-                // Check if section overlaps or is contiguous with this segment.
-                // Allow a small gap (up to 16 bytes) for contiguous merging to
-                // reduce fragmentation.
-                constexpr std::uint32_t MAX_GAP = 16;
-                
-                bool overlaps = (sec_start < seg_end && sec_end > seg_start);
-                bool contiguous = (sec_start <= seg_end + MAX_GAP && 
-                                   sec_start >= seg_start);
-                
-                if (overlaps || contiguous)
+                // Update type to be the more specific one.
+                if (seg_type == segment_type::interrupt)
                 {
-                    merge_section_into_segment(segment, sec);
-                    
-                    // Update type to be the more specific one.
-                    if (seg_type == segment_type::interrupt)
-                    {
-                        segment.type = segment_type::interrupt;
-                    }
-                    
-                    merged = true;
-                    break;
+                    segment.type = segment_type::interrupt;
                 }
             }
-
-            if (!merged)
+            else
             {
                 // Create a new segment.
                 program_segment segment;
@@ -1683,6 +3246,7 @@ namespace g10
                 segment.type = seg_type;
                 segment.flags = seg_flags;
                 segment.data = sec.data;
+                candidates.push_back(m_segments.size());
                 m_segments.push_back(std::move(segment));
             }
         }
@@ -1698,54 +3262,195 @@ namespace g10
         return {};
     }
 
-    auto program::find_entry_point (
-        const std::vector<resolved_symbol>& symbols
-    ) -> result<void>
+    auto program::record_link_state (
+        const std::vector<object>& objects,
+        const std::vector<resolved_symbol>& symbols,
+        const std::vector<link_section>& sections,
+        const link_section_index& index,
+        link_state& state
+    ) const -> void
     {
-        // Look for a symbol marked with the entry flag, or named "main" or
-        // "_start".
-        const resolved_symbol* entry_symbol = nullptr;
+        // Locate each loaded segment's data in the program file, as laid out
+        // by `save_to_file`.
+        std::vector<std::uint32_t> segment_offsets;
+        segment_offsets.reserve(m_segments.size());
+        std::size_t data_offset = PROGRAM_HEADER_SIZE +
+            (m_segments.size() * PROGRAM_SEGMENT_HEADER_SIZE);
+        for (const auto& seg : m_segments)
+        {
+            if ((seg.flags & segment_flags::load) == segment_flags::none)
+            {
+                segment_offsets.push_back(LINK_STATE_NO_OFFSET);
+                continue;
+            }
 
-        // First, look for a symbol with the entry flag set.
-        for (const auto& sym : symbols)
+            segment_offsets.push_back(static_cast<std::uint32_t>(data_offset));
+            data_offset += seg.data.size();
+        }
+
+        // Locate each section's data within the segment holding it. The
+        // sections are sorted by address; a section overlapping another
+        // cannot be patched on its own, so neither is given an offset.
+        std::vector<std::uint32_t> file_offsets(sections.size(),
+            LINK_STATE_NO_OFFSET);
+        std::size_t furthest = NO_LINK_SECTION;
+        std::uint64_t furthest_end = 0;
+        for (std::size_t i = 0; i < sections.size(); ++i)
         {
-            if ((sym.flags & symbol_flags::entry) != symbol_flags::none)
+            const auto& sec = sections[i];
+            if (sec.type == section_type::bss || sec.data.empty() == true)
             {
-                entry_symbol = &sym;
-                break;
+                continue;
+            }
+
+            const std::uint64_t end = std::uint64_t { sec.address } +
+                sec.data.size();
+            auto seg = std::upper_bound(m_segments.begin(), m_segments.end(),
+                sec.address,
+                [] (std::uint32_t address, const program_segment& segment)
+                {
+                    return address < segment.load_address;
+                }
+            );
+
+            if (seg != m_segments.begin())
+            {
+                --seg;
+                const auto seg_idx = static_cast<std::size_t>(
+                    seg - m_segments.begin());
+                if (segment_offsets[seg_idx] != LINK_STATE_NO_OFFSET &&
+                    end <= std::uint64_t { seg->load_address } +
+                        seg->data.size())
+                {
+                    file_offsets[i] = segment_offsets[seg_idx] +
+                        (sec.address - seg->load_address);
+                }
+            }
+
+            if (furthest != NO_LINK_SECTION && sec.address < furthest_end)
+            {
+                file_offsets[i] = LINK_STATE_NO_OFFSET;
+                file_offsets[furthest] = LINK_STATE_NO_OFFSET;
+            }
+
+            if (furthest == NO_LINK_SECTION || end > furthest_end)
+            {
+                furthest = i;
+                furthest_end = end;
             }
         }
 
-        // If no explicit entry symbol, look for "main".
-        if (entry_symbol == nullptr)
+        // Record each object's sections, in section order, and its
+        // relocations against global symbols.
+        state.objects.resize(objects.size());
+        parallel_for(objects.size(), [&] (std::size_t obj_idx)
         {
-            for (const auto& sym : symbols)
+            const auto& obj = objects[obj_idx];
+            const auto& obj_sections = obj.get_sections();
+            auto& record = state.objects[obj_idx];
+            record.interface_hash = compute_interface_hash(obj);
+            record.sections.clear();
+            for (std::size_t sec_idx = 0; sec_idx < obj_sections.size();
+                ++sec_idx)
             {
-                if (sym.name == "main" &&
-                    (sym.binding == symbol_binding::global ||
-                     sym.binding == symbol_binding::weak))
+                const std::size_t link_idx =
+                    index.slots[index.slot_offsets[obj_idx] + sec_idx];
+                if (link_idx == NO_LINK_SECTION)
                 {
-                    entry_symbol = &sym;
-                    break;
+                    continue;
                 }
+
+                const auto& link_sec = sections[link_idx];
+                record.sections.push_back({
+                    .section_index      = static_cast<std::uint32_t>(sec_idx),
+                    .original_address   = link_sec.original_address,
+                    .address            = link_sec.address,
+                    .size               = static_cast<std::uint32_t>(
+                        obj_sections[sec_idx].data.size()),
+                    .file_offset        = file_offsets[link_idx],
+                    .type               = link_sec.type,
+                    .flags              = link_sec.flags
+                });
+            }
+
+            record.relocations = record_relocations(obj, record.sections);
+        });
+
+        // Record the definition each global symbol name resolves to, as
+        // `apply_relocations` resolves it: the last global or weak symbol of
+        // that name.
+        std::unordered_map<std::string_view, std::size_t> symbol_map;
+        for (std::size_t i = 0; i < symbols.size(); ++i)
+        {
+            const auto& sym = symbols[i];
+            if (sym.binding == symbol_binding::global ||
+                sym.binding == symbol_binding::weak)
+            {
+                symbol_map[sym.name] = i;
+            }
+        }
+
+        state.symbols.clear();
+        for (std::size_t i = 0; i < symbols.size(); ++i)
+        {
+            const auto& sym = symbols[i];
+            const auto it = symbol_map.find(sym.name);
+            if (it != symbol_map.end() && it->second == i)
+            {
+                state.symbols.push_back({
+                    .name           = sym.name,
+                    .address        = sym.address,
+                    .object_index   = static_cast<std::uint32_t>(
+                        sym.object_index)
+                });
+            }
+        }
+
+        // Record the entry point symbol.
+        const auto* entry = select_entry_symbol(symbols);
+        state.entry_symbol = (entry != nullptr) ? entry->name : "";
+        state.entry_object = (entry != nullptr) ?
+            static_cast<std::uint32_t>(entry->object_index) : 0;
+    }
+
+    auto program::select_entry_symbol (
+        const std::vector<resolved_symbol>& symbols
+    ) -> const resolved_symbol*
+    {
+        // First, look for a symbol with the entry flag set.
+        for (const auto& sym : symbols)
+        {
+            if ((sym.flags & symbol_flags::entry) != symbol_flags::none)
+            {
+                return &sym;
             }
         }
 
-        // If no "main", look for "_start".
-        if (entry_symbol == nullptr)
+        // If no explicit entry symbol, look for "main", then "_start".
+        for (const std::string_view name : { "main", "_start" })
         {
             for (const auto& sym : symbols)
             {
-                if (sym.name == "_start" &&
+                if (sym.name == name &&
                     (sym.binding == symbol_binding::global ||
                      sym.binding == symbol_binding::weak))
                 {
-                    entry_symbol = &sym;
-                    break;
+                    return &sym;
                 }
             }
         }
 
+        return nullptr;
+    }
+
+    auto program::find_entry_point (
+        const std::vector<resolved_symbol>& symbols
+    ) -> result<void>
+    {
+        // Look for a symbol marked with the entry flag, or named "main" or
+        // "_start".
+        const resolved_symbol* entry_symbol = select_entry_symbol(symbols);
+
         // Set the entry point if found.
         if (entry_symbol != nullptr)
         {
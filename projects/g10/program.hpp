@@ -10,7 +10,7 @@
 
 /* Public Includes ************************************************************/
 
-#include <g10/object.hpp>
+#include <g10/link_state.hpp>
 
 /* Public Constants and Enumerations ******************************************/
 
@@ -227,6 +227,27 @@ namespace g10
         std::uint32_t   build_date { 0 };   /** @brief Build timestamp (Unix epoch) */
         std::uint32_t   checksum { 0 };     /** @brief CRC-32 of segment data */
     };
+
+    /**
+     * @brief   Represents an entry in a section ordering, naming a symbol whose
+     *          section is placed by how often it runs.
+     */
+    struct link_order_entry final
+    {
+        std::string                     symbol; /** @brief Symbol name */
+        std::optional<std::uint64_t>    count;  /** @brief Execution count, zero for cold code; none if not counted */
+    };
+
+    /**
+     * @brief   Options controlling how the linker lays out a program.
+     */
+    struct link_options final
+    {
+        bool                        gc_sections { false };  /** @brief Drop the sections unreachable from the program's roots */
+        std::vector<std::string>    keep_symbols;           /** @brief Symbols whose sections are always kept by `gc_sections` */
+        bool                        fold_identical { false };/** @brief Fold identical read-only sections into a single copy */
+        std::vector<link_order_entry> section_order;        /** @brief Place the ROM sections defining these symbols first (hot) or last (cold) */
+    };
 }
 
 /* Public Classes *************************************************************/
@@ -285,14 +306,58 @@ namespace g10
          *          G10 object files.
          * 
          * @param   objects     The vector of G10 object files to link.
+         * @param   state       If not `nullptr`, receives the layout, global
+         *                      symbols and relocations of the linked program,
+         *                      for a later incremental relink. The objects'
+         *                      paths and content hashes, and the program
+         *                      file's hash, are left to the caller.
+         * @param   options     Options controlling the program's layout.
          * 
          * @return  If linked successfully and is valid, returns `void`;
          *          Otherwise, returns an error message describing the failure.
          */
         auto link_from_objects (
-            const std::vector<object>& objects
+            const std::vector<object>& objects,
+            link_state* state = nullptr,
+            const link_options& options = {}
         ) -> result<void>;
 
+        /**
+         * @brief   Relinks a previously linked program file in place, given
+         *          new versions of some of its input objects.
+         *
+         * The changed objects must define and reference the same global
+         * symbols as before, and each of their sections must have the same
+         * type, flags and original address as before, and still fit within
+         * the slot recorded for it. Their sections are then copied into their
+         * slots and relocated again, any space left over in a slot is zeroed,
+         * and the relocations in other objects which reference a symbol that
+         * has moved are applied again. The layout of the program is otherwise
+         * unchanged.
+         *
+         * On success, the program file is loaded into this program, and the
+         * link state is updated to describe it; the changed objects' content
+         * hashes are left to the caller.
+         *
+         * @param   path            The path to the program file to patch.
+         * @param   state           The link state recorded for the program.
+         * @param   changed         The indices of the changed objects, in
+         *                          ascending order.
+         * @param   changed_objects The new versions of the changed objects, in
+         *                          the same order.
+         *
+         * @return  If the program file was patched, returns `true`;
+         *          If the changes cannot be patched in place, and the objects
+         *          must be linked again in full, returns `false`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto relink_in_place (
+            const fs::path& path,
+            link_state& state,
+            std::span<const std::size_t> changed,
+            const std::vector<object>& changed_objects
+        ) -> result<bool>;
+
         /**
          * @brief   Saves the G10 program file to a file located at the given
          *          path.
@@ -467,6 +532,16 @@ namespace g10
             std::size_t     section_index;      /** @brief Source section index */
         };
 
+        /**
+         * @brief   Represents where a section named by a link's section
+         *          ordering is placed in ROM.
+         */
+        struct section_rank final
+        {
+            std::size_t     rank;               /** @brief Position among the ordered sections, hottest first */
+            bool            cold;               /** @brief Placed after the sections not ordered, rather than before */
+        };
+
         /**
          * @brief   Represents a section during linking with tracking info.
          */
@@ -481,28 +556,189 @@ namespace g10
             section_flags           flags;              /** @brief Section flags */
         };
 
+        /**
+         * @brief   Represents the original address range of a collected section
+         *          in a `link_section_index`.
+         */
+        struct link_section_range final
+        {
+            std::uint32_t   start;          /** @brief Original start address */
+            std::uint32_t   end;            /** @brief Original end address (exclusive) */
+            std::uint32_t   max_end;        /** @brief Greatest end of this and the object's preceding ranges */
+            std::size_t     section;        /** @brief Index of the link section */
+        };
+
+        /**
+         * @brief   Indexes the collected sections by their source object and
+         *          section index, and by the original address ranges of each
+         *          object's sections, so that both lookups made for every
+         *          symbol and relocation are logarithmic rather than linear in
+         *          the number of sections.
+         */
+        struct link_section_index final
+        {
+            std::vector<std::size_t>        slot_offsets;   /** @brief Offset of each object's first slot; one extra entry ends the last object */
+            std::vector<std::size_t>        slots;          /** @brief Link section index of each (object, section) pair */
+            std::vector<std::size_t>        range_offsets;  /** @brief Offset of each object's first range; one extra entry ends the last object */
+            std::vector<link_section_range> ranges;         /** @brief Each object's ranges, sorted by start address */
+        };
+
+        /**
+         * @brief   Builds the index of the collected sections.
+         *
+         * @param   objects     The input object files.
+         * @param   sections    The collected sections.
+         *
+         * @return  The section index.
+         */
+        static auto index_sections (
+            const std::vector<object>& objects,
+            const std::vector<link_section>& sections
+        ) -> link_section_index;
+
+        /**
+         * @brief   Finds the collected section holding an object's symbol: the
+         *          section with the given index, if it was collected, or else
+         *          the first collected section of the same object whose
+         *          original address range contains the given address.
+         *
+         * @param   index           The section index.
+         * @param   object_index    The index of the object.
+         * @param   section_index   The index of the section within the object.
+         * @param   address         The symbol's original address.
+         *
+         * @return  The index of the link section, or `NO_LINK_SECTION` if no
+         *          section was found.
+         */
+        static auto find_link_section (
+            const link_section_index& index,
+            std::size_t object_index,
+            std::size_t section_index,
+            std::uint32_t address
+        ) -> std::size_t;
+
         /**
          * @brief   Collects and resolves all symbols from input object files.
-         * 
+         *
          * @param   objects     The input object files.
          * @param   symbols     Output: resolved symbol table.
          * @param   sections    The collected sections (for address adjustment).
-         * 
+         * @param   index       The index of the collected sections.
+         *
          * @return  If successful, returns `void`;
          *          Otherwise, returns an error message.
          */
         auto collect_symbols (
             const std::vector<object>& objects,
             std::vector<resolved_symbol>& symbols,
-            const std::vector<link_section>& sections
+            const std::vector<link_section>& sections,
+            const link_section_index& index
         ) -> result<void>;
 
+        /**
+         * @brief   Finds the sections reachable from the program's roots, for
+         *          `link_options::gc_sections`.
+         *
+         * The roots are the section holding the entry point symbol, the
+         * sections in the metadata or interrupt vector regions, and the
+         * sections defining the symbols to keep. A section reaches the
+         * sections holding the symbols its relocations reference: a local
+         * symbol's own section, or every section defining a global symbol of
+         * the same name.
+         *
+         * An extern symbol which no relocation references is reached from
+         * every live section of its object. References within an object
+         * which carry no relocation, such as relative branches and the
+         * differences of labels, are not followed, and must not cross from
+         * one section into another.
+         *
+         * @param   objects     The input object files.
+         * @param   options     The link options, naming the symbols to keep.
+         *
+         * @return  If successful, returns whether each section of each object
+         *          is reachable;
+         *          Otherwise, returns an error message.
+         */
+        static auto find_live_sections (
+            const std::vector<object>& objects,
+            const link_options& options
+        ) -> result<std::vector<std::vector<bool>>>;
+
+        /**
+         * @brief   Finds the identical read-only sections of the linked
+         *          objects, for `link_options::fold_identical`.
+         *
+         * Two sections are identical if they have the same type, flags and
+         * contents, and relocations of the same types and addends at the same
+         * offsets, which resolve to the same targets: the same offset within
+         * the same section, or within the section itself. Sections are
+         * grouped by a hash of all of these, then compared in full; each is
+         * folded into the first identical section in link order. In the
+         * targets of other sections, a folded section is replaced by the
+         * section it is folded into, so the sections are compared again until
+         * no more fold.
+         *
+         * Any read-only section of an object may be folded, as references
+         * between an object's sections carry relocations. References which
+         * carry none, such as relative branches and the differences of
+         * labels, must not cross from one section into another. Sections in
+         * the metadata and interrupt vector regions, whose addresses are
+         * fixed, are never folded.
+         *
+         * @param   objects     The input object files.
+         * @param   live        Whether each section of each object is
+         *                      linked, or empty if every section is linked.
+         *
+         * @return  A map from each folded section's (object, section) indices
+         *          to those of the section it is folded into.
+         */
+        static auto find_identical_sections (
+            const std::vector<object>& objects,
+            const std::vector<std::vector<bool>>& live
+        ) -> std::map<std::pair<std::size_t, std::size_t>,
+            std::pair<std::size_t, std::size_t>>;
+
+        /**
+         * @brief   Ranks the ROM sections which define the symbols named by a
+         *          link's section ordering.
+         *
+         * The entries are ranked by descending execution count, and those
+         * without a count, such as a list of hot functions, come first in the
+         * order given. A section takes the rank of the highest-ranked entry
+         * naming one of its symbols, and is cold if that entry's count is
+         * zero. Sections in the metadata and interrupt regions keep their
+         * fixed addresses, and are not ranked.
+         *
+         * @param   objects     The input object files.
+         * @param   live        Whether each section of each object is
+         *                      linked, or empty if every section is linked.
+         * @param   options     The link options, with the section ordering.
+         *
+         * @return  A map from each ranked section's (object, section) indices
+         *          to its rank.
+         */
+        static auto rank_sections (
+            const std::vector<object>& objects,
+            const std::vector<std::vector<bool>>& live,
+            const link_options& options
+        ) -> std::map<std::pair<std::size_t, std::size_t>, section_rank>;
+
         /**
          * @brief   Collects all sections from input object files for linking.
          *          Sections are relocated to avoid overlaps within each memory
          *          region.
+         *
+         * Ranked sections are packed together from the start of the ROM
+         * region, hottest first, ahead of the unranked sections; cold
+         * sections are packed after them, at the end of ROM.
          * 
          * @param   objects     The input object files.
+         * @param   live        Whether each section of each object is
+         *                      linked, or empty to link every section.
+         * @param   folds       The sections to fold, each placed at the address
+         *                      of the section it is folded into.
+         * @param   ranks       The ranked sections, or empty to lay the
+         *                      sections out in link order.
          * @param   sections    Output: collected sections with final addresses.
          * 
          * @return  If successful, returns `void`;
@@ -510,6 +746,11 @@ namespace g10
          */
         auto collect_sections (
             const std::vector<object>& objects,
+            const std::vector<std::vector<bool>>& live,
+            const std::map<std::pair<std::size_t, std::size_t>,
+                std::pair<std::size_t, std::size_t>>& folds,
+            const std::map<std::pair<std::size_t, std::size_t>,
+                section_rank>& ranks,
             std::vector<link_section>& sections
         ) -> result<void>;
 
@@ -517,16 +758,23 @@ namespace g10
          * @brief   Applies relocations to all collected sections.
          * 
          * @param   objects     The input object files.
+         * @param   live        Whether each section of each object is
+         *                      linked, or empty if every section is linked.
+         *                      The relocations of sections not linked are
+         *                      skipped.
          * @param   symbols     The resolved symbol table.
          * @param   sections    The sections to patch.
-         * 
+         * @param   index       The index of the collected sections.
+         *
          * @return  If successful, returns `void`;
          *          Otherwise, returns an error message.
          */
         auto apply_relocations (
             const std::vector<object>& objects,
+            const std::vector<std::vector<bool>>& live,
             const std::vector<resolved_symbol>& symbols,
-            std::vector<link_section>& sections
+            std::vector<link_section>& sections,
+            const link_section_index& index
         ) -> result<void>;
 
         /**
@@ -541,6 +789,37 @@ namespace g10
             const std::vector<link_section>& sections
         ) -> result<void>;
 
+        /**
+         * @brief   Records the layout, global symbols and relocations of a
+         *          freshly linked program in a link state.
+         *
+         * @param   objects     The input object files.
+         * @param   symbols     The resolved symbol table.
+         * @param   sections    The linked sections.
+         * @param   index       The index of the linked sections.
+         * @param   state       Output: the link state.
+         */
+        auto record_link_state (
+            const std::vector<object>& objects,
+            const std::vector<resolved_symbol>& symbols,
+            const std::vector<link_section>& sections,
+            const link_section_index& index,
+            link_state& state
+        ) const -> void;
+
+        /**
+         * @brief   Selects the entry point symbol: the first symbol marked with
+         *          the entry flag, or else the first global symbol named
+         *          "main", or else the first named "_start".
+         *
+         * @param   symbols     The resolved symbol table.
+         *
+         * @return  The entry point symbol, or `nullptr` if there is none.
+         */
+        static auto select_entry_symbol (
+            const std::vector<resolved_symbol>& symbols
+        ) -> const resolved_symbol*;
+
         /**
          * @brief   Finds the entry point symbol and sets the entry point address.
          * 
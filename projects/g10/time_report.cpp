@@ -0,0 +1,155 @@
+/**
+ * @file    g10/time_report.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 toolchain's phase timing and
+ *          memory usage report.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/time_report.hpp>
+
+#if defined(G10_LINUX)
+    #include <sys/resource.h>
+#endif
+
+/* Private Static Members *****************************************************/
+
+namespace g10
+{
+    std::atomic<bool>           time_report::s_enabled = false;
+    std::atomic<std::uint64_t>  time_report::s_allocations = 0;
+    std::atomic<std::uint64_t>  time_report::s_allocated_bytes = 0;
+    std::vector<time_report_phase> time_report::s_phases;
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10
+{
+    time_report::phase::phase (std::string_view name) :
+        m_name              { name },
+        m_active            { time_report::is_enabled() },
+        m_start             { std::chrono::steady_clock::now() },
+        m_allocations       { s_allocations.load(std::memory_order_relaxed) },
+        m_allocated_bytes   { s_allocated_bytes.load(std::memory_order_relaxed) }
+    {
+    }
+
+    time_report::phase::~phase ()
+    {
+        if (m_active == false)
+        {
+            return;
+        }
+
+        // - Take the measurements before touching the phase list, so that its
+        //   own allocations are not charged to the phase.
+        const auto wall_time = std::chrono::steady_clock::now() - m_start;
+        const auto allocations =
+            s_allocations.load(std::memory_order_relaxed) - m_allocations;
+        const auto allocated_bytes =
+            s_allocated_bytes.load(std::memory_order_relaxed) - m_allocated_bytes;
+
+        auto it = std::ranges::find(s_phases, m_name, &time_report_phase::name);
+        if (it == s_phases.end())
+        {
+            s_phases.push_back({
+                .name               = std::string { m_name },
+                .runs               = 0,
+                .wall_time          = std::chrono::nanoseconds { 0 },
+                .allocations        = 0,
+                .allocated_bytes    = 0
+            });
+            it = std::prev(s_phases.end());
+        }
+
+        it->runs += 1;
+        it->wall_time += std::chrono::duration_cast<std::chrono::nanoseconds>(wall_time);
+        it->allocations += allocations;
+        it->allocated_bytes += allocated_bytes;
+    }
+
+    auto time_report::enable () -> void
+    {
+        s_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    auto time_report::reset () -> void
+    {
+        s_enabled.store(false, std::memory_order_relaxed);
+        s_phases.clear();
+    }
+
+    auto time_report::is_enabled () -> bool
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    auto time_report::get_phases () -> const std::vector<time_report_phase>&
+    {
+        return s_phases;
+    }
+
+    auto time_report::peak_rss () -> std::optional<std::uint64_t>
+    {
+    #if defined(G10_LINUX)
+        // - On Linux, `ru_maxrss` is reported in kilobytes.
+        struct rusage usage {};
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+        }
+    #endif
+
+        return std::nullopt;
+    }
+
+    auto time_report::print (std::FILE* stream) -> void
+    {
+        std::println(stream, "Time Report:");
+        std::println(stream, "  {:<24}  {:>5}  {:>11}  {:>11}  {:>14}",
+            "Phase", "Runs", "Wall (ms)", "Allocations", "Bytes");
+
+        std::chrono::nanoseconds total_time { 0 };
+        std::uint64_t total_allocations = 0;
+        std::uint64_t total_bytes = 0;
+        for (const auto& entry : s_phases)
+        {
+            std::println(stream, "  {:<24}  {:>5}  {:>11.3f}  {:>11}  {:>14}",
+                entry.name, entry.runs,
+                std::chrono::duration<double, std::milli> { entry.wall_time }.count(),
+                entry.allocations, entry.allocated_bytes);
+
+            total_time += entry.wall_time;
+            total_allocations += entry.allocations;
+            total_bytes += entry.allocated_bytes;
+        }
+
+        std::println(stream, "  {:<24}  {:>5}  {:>11.3f}  {:>11}  {:>14}",
+            "Total", "",
+            std::chrono::duration<double, std::milli> { total_time }.count(),
+            total_allocations, total_bytes);
+
+        if (const auto rss = peak_rss(); rss.has_value())
+        {
+            std::println(stream, "  Peak RSS: {:.2f} MiB",
+                static_cast<double>(rss.value()) / (1024.0 * 1024.0));
+        }
+        else
+        {
+            std::println(stream, "  Peak RSS: unavailable on this platform");
+        }
+    }
+
+    auto time_report::count_allocation (std::size_t size) noexcept -> void
+    {
+        if (s_enabled.load(std::memory_order_relaxed) == true)
+        {
+            s_allocations.fetch_add(1, std::memory_order_relaxed);
+            s_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/**
+ * @file    g10/time_report.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 toolchain's phase timing and
+ *          memory usage report.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/common.hpp>
+
+/* Public Macros **************************************************************/
+
+/**
+ * @brief   Defines replacements of the global `operator new` and `operator
+ *          delete` which count heap allocations for the time report. A tool
+ *          offering `--time-report` expands this once, at global scope, in a
+ *          translation unit of its own executable which does not allocate.
+ */
+#define G10_TIME_REPORT_ALLOCATOR() \
+    auto operator new (std::size_t size) -> void* \
+    { \
+        g10::time_report::count_allocation(size); \
+        if (size == 0) { size = 1; } \
+        while (true) \
+        { \
+            if (void* pointer = std::malloc(size); pointer != nullptr) \
+                { return pointer; } \
+            auto handler = std::get_new_handler(); \
+            if (handler == nullptr) { throw std::bad_alloc {}; } \
+            handler(); \
+        } \
+    } \
+    auto operator delete (void* pointer) noexcept -> void \
+        { std::free(pointer); } \
+    auto operator delete (void* pointer, std::size_t) noexcept -> void \
+        { std::free(pointer); }
+
+/* Public Unions and Structures ***********************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Defines a structure holding the measurements accumulated for a
+     *          single phase of a tool's work.
+     */
+    struct time_report_phase final
+    {
+        std::string     name;               /** @brief The phase's name. */
+        std::uint32_t   runs;               /** @brief Number of times the phase was run. */
+        std::chrono::nanoseconds wall_time; /** @brief Total wall time spent in the phase. */
+        std::uint64_t   allocations;        /** @brief Number of heap allocations made during the phase. */
+        std::uint64_t   allocated_bytes;    /** @brief Number of bytes allocated during the phase. */
+    };
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10
+{
+    /**
+     * @brief   Defines a static class representing a report of the wall time
+     *          and heap allocations spent in each phase of a tool's work, as
+     *          requested by the tools' `--time-report` option.
+     *
+     * Phases are measured by constructing a `time_report::phase` guard at the
+     * start of the phase's scope. Phases should not be nested; a phase which
+     * is run more than once accumulates its measurements, in the order it was
+     * first run. Nothing is measured unless the report has been enabled.
+     *
+     * Heap allocations are counted by replacements of the global `operator new`
+     * which each tool offering the report defines in its own executable, with
+     * `G10_TIME_REPORT_ALLOCATOR`; other programs using the library keep the
+     * standard allocator. On platforms where an executable's replacements do
+     * not apply to the libraries it loads (eg. a Windows DLL build), only the
+     * executable's own allocations are counted.
+     */
+    class g10api time_report final
+    {
+    public: /* Public Types ***************************************************/
+
+        /**
+         * @brief   Measures a phase from construction until destruction.
+         */
+        class g10api phase final
+        {
+        public:
+
+            /**
+             * @brief   Starts measuring the named phase, if the report is
+             *          enabled.
+             *
+             * @param   name    The phase's name.
+             */
+            explicit phase (std::string_view name);
+
+            /**
+             * @brief   Stops measuring the phase, adding its measurements to
+             *          the report.
+             */
+            ~phase ();
+
+            phase (const phase&) = delete;
+            phase& operator= (const phase&) = delete;
+
+        private:
+
+            std::string_view    m_name;         /** @brief The phase's name. */
+            bool                m_active;       /** @brief Whether the phase is being measured. */
+            std::chrono::steady_clock::time_point m_start;  /** @brief When the phase started. */
+            std::uint64_t       m_allocations;  /** @brief Allocation count when the phase started. */
+            std::uint64_t       m_allocated_bytes;  /** @brief Allocated bytes when the phase started. */
+
+        };
+
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Enables the report, and starts counting heap allocations.
+         */
+        static auto enable () -> void;
+
+        /**
+         * @brief   Disables the report, and discards the phases measured so
+         *          far, as between the jobs of a long-lived tool process.
+         */
+        static auto reset () -> void;
+
+        /**
+         * @brief   Indicates whether the report is enabled.
+         *
+         * @return  `true` if the report is enabled; `false` otherwise.
+         */
+        static auto is_enabled () -> bool;
+
+        /**
+         * @brief   Retrieves the phases measured so far.
+         *
+         * @return  The phases, in the order they were first run.
+         */
+        static auto get_phases () -> const std::vector<time_report_phase>&;
+
+        /**
+         * @brief   Retrieves the peak resident set size of the process.
+         *
+         * @return  The peak resident set size in bytes, or `std::nullopt` if it
+         *          cannot be determined on this platform.
+         */
+        static auto peak_rss () -> std::optional<std::uint64_t>;
+
+        /**
+         * @brief   Prints the report to the given stream: one line per phase,
+         *          a line of totals, and the process's peak resident set size.
+         *
+         * @param   stream  The stream to print to.
+         */
+        static auto print (std::FILE* stream) -> void;
+
+        /**
+         * @brief   Counts a heap allocation, if the report is enabled. Called
+         *          by the replacements of the global `operator new` defined by
+         *          `G10_TIME_REPORT_ALLOCATOR`.
+         *
+         * @param   size    The size of the allocation, in bytes.
+         */
+        static auto count_allocation (std::size_t size) noexcept -> void;
+
+    private: /* Private Members ***********************************************/
+
+        /**
+         * @brief   Whether the report is enabled.
+         */
+        static std::atomic<bool> s_enabled;
+
+        /**
+         * @brief   The number of heap allocations counted since the report was
+         *          enabled.
+         */
+        static std::atomic<std::uint64_t> s_allocations;
+
+        /**
+         * @brief   The number of bytes allocated since the report was enabled.
+         */
+        static std::atomic<std::uint64_t> s_allocated_bytes;
+
+        /**
+         * @brief   The phases measured so far, in the order they were first run.
+         */
+        static std::vector<time_report_phase> s_phases;
+
+    };
+}
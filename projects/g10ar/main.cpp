@@ -0,0 +1,238 @@
+/**
+ * @file    g10ar/main.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains the primary entry point for the G10 CPU Archiver Tool.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/archive.hpp>
+
+/* Private Static Variables ***************************************************/
+
+namespace g10ar
+{
+    // Usage: `g10ar [options] <object files> -o <archive file>`
+    // - `<object files>` - One or more object files to bundle (required)
+    // - `-o <archive file>`, `--output <archive file>` - Specify the output file name (required)
+    // - `-l`, `--list` - List the members and symbol index of the input archives
+    // - `-h`, `--help` - Show help message
+    // - `-v`, `--version` - Show version info
+    static std::vector<std::string> s_input_files;  // Input object files, or archives with `--list`
+    static std::string s_output_file = "";          // `-o <file>`, `--output <file>` - Output file name
+    static bool s_list = false;                     // `-l`, `--list` - List archive contents
+    static bool s_help = false;                     // `-h`, `--help` - Show help message
+    static bool s_version = false;                  // `-v`, `--version` - Show version info
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10ar
+{
+    static auto parse_arguments (int argc, const char** argv) -> bool
+    {
+        // - Iterate through command-line arguments and parse them.
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "-o" || arg == "--output")
+            {
+                if (i + 1 < argc)
+                {
+                    s_output_file = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing output file after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "-l" || arg == "--list")
+            {
+                s_list = true;
+            }
+            else if (arg == "-h" || arg == "--help")
+            {
+                s_help = true;
+            }
+            else if (arg == "-v" || arg == "--version")
+            {
+                s_version = true;
+            }
+            else if (arg.starts_with("-"))
+            {
+                std::println(stderr, "Error: Unknown argument '{}'.", arg);
+                return false;
+            }
+            else
+            {
+                s_input_files.push_back(arg);
+            }
+        }
+
+        // - Check for `--help` or `--version` flags.
+        if (s_help == true || s_version == true)
+        {
+            return true;
+        }
+
+        // - Validate required arguments.
+        if (s_input_files.empty() == true)
+        {
+            std::println(stderr,
+                "Error: At least one input file is required.");
+            return false;
+        }
+        else if (s_output_file.empty() == true && s_list == false)
+        {
+            std::println(stderr,
+                "Error: Output file is required. Use '-o <file>' or '--output <file>'.");
+            return false;
+        }
+
+        return true;
+    }
+
+    static auto show_version () -> void
+    {
+        std::println(
+            "'g10ar' - G10 CPU Archiver Tool\n"
+            "By: Dennis W. Griffin <dgdev1024@gmail.com>\n"
+        );
+    }
+
+    static auto show_help () -> void
+    {
+        std::println(
+            "Usage: g10ar [options] <object files> -o <archive file>\n"
+            "       g10ar --list <archive files>\n\n"
+            "Options:\n"
+            "  -o, --output <file>     Specify the output archive file name (required).\n"
+            "  -l, --list              List the members and symbol index of each input archive.\n"
+            "  -h, --help              Show this help message and exit.\n"
+            "  -v, --version           Show version information and exit.\n"
+        );
+    }
+
+    static auto read_file (
+        const std::string& path,
+        std::vector<std::uint8_t>& buffer
+    ) -> bool
+    {
+        std::ifstream file { path, std::ios::binary | std::ios::ate };
+        if (file.is_open() == false)
+        {
+            return false;
+        }
+
+        buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        return static_cast<bool>(file.read(
+            reinterpret_cast<char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size())));
+    }
+
+    static auto list_archives () -> bool
+    {
+        for (const auto& path : s_input_files)
+        {
+            g10::archive archive;
+            auto load_result = archive.load_from_file(path);
+            if (load_result.has_value() == false)
+            {
+                std::println(stderr,
+                    "Error: Failed to load archive file '{}': '{}'.",
+                    path, load_result.error());
+                return false;
+            }
+
+            // - List the members, then the symbol index, sorted by name.
+            const auto& members = archive.get_members();
+            std::println("{}:", path);
+            std::println("  Members ({}):", members.size());
+            for (const auto& member : members)
+            {
+                std::println("    {:<32} {:>8} bytes", member.name,
+                    member.data_size);
+            }
+
+            auto symbols = archive.get_symbols();
+            std::ranges::sort(symbols);
+            std::println("  Symbols ({}):", symbols.size());
+            for (const auto& [name, member] : symbols)
+            {
+                std::println("    {:<32} {}", name, members[member].name);
+            }
+        }
+
+        return true;
+    }
+}
+
+/* Main Function **************************************************************/
+
+auto main (int argc, const char** argv) -> int
+{
+    // - Parse command-line arguments.
+    if (g10ar::parse_arguments(argc, argv) == false)
+    {
+        return 1;
+    }
+
+    // - Handle `--help` and `--version` flags.
+    if (g10ar::s_help == true)
+    {
+        g10ar::show_version();
+        g10ar::show_help();
+        return 0;
+    }
+    else if (g10ar::s_version == true)
+    {
+        g10ar::show_version();
+        return 0;
+    }
+
+    // - Handle the `--list` flag.
+    if (g10ar::s_list == true)
+    {
+        return (g10ar::list_archives() == true) ? 0 : 1;
+    }
+
+    // - Add each input object file to the archive, named by its file name.
+    g10::archive archive;
+    std::vector<std::uint8_t> buffer;
+    for (const auto& path : g10ar::s_input_files)
+    {
+        if (g10ar::read_file(path, buffer) == false)
+        {
+            std::println(stderr,
+                "Error: Failed to read object file '{}'.", path);
+            return 1;
+        }
+
+        const std::string name = fs::path { path }.filename().string();
+        auto add_result = archive.add_member(name, buffer);
+        if (add_result.has_value() == false)
+        {
+            std::println(stderr,
+                "Error: Failed to add object file '{}' to archive: '{}'.",
+                path, add_result.error());
+            return 1;
+        }
+    }
+
+    // - Save the archive, with its symbol index, to the output file.
+    auto save_result = archive.save_to_file(g10ar::s_output_file);
+    if (save_result.has_value() == false)
+    {
+        std::println(stderr,
+            "Error: Failed to save archive to file '{}': '{}'.",
+            g10ar::s_output_file, save_result.error());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+/**
+ * @file    g10asm/allocator.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains the G10 assembler's replacements of the global allocation
+ *          functions, which count its heap allocations for `--time-report`.
+ *
+ * These are kept in their own translation unit, apart from any code which
+ * allocates, so that the compiler does not see through them.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/time_report.hpp>
+
+/* Global Allocation Functions ************************************************/
+
+G10_TIME_REPORT_ALLOCATOR()
@@ -73,6 +73,14 @@ namespace g10asm
         const std::string_view  source_file;    /** @brief The source file from which this node originated. */
         const std::size_t       source_line;    /** @brief The source line number at which this node originated. */
         const std::size_t       source_column;  /** @brief The source column number at which this node originated. */
+        const symbol_id         symbol;         /** @brief The interned name of the node's source token, if it is an identifier or variable. */
+
+        /**
+         * @brief   Nodes are owned and destroyed through pointers to this base,
+         *          so their operands and subexpressions must be released by
+         *          the derived destructor.
+         */
+        virtual ~ast_node () = default;
 
     protected:
         explicit ast_node (const token& src_token, ast_node_type type) :
@@ -81,7 +89,8 @@ namespace g10asm
             lexeme          { src_token.lexeme },
             source_file     { src_token.source_file },
             source_line     { src_token.source_line },
-            source_column   { src_token.source_column }
+            source_column   { src_token.source_column },
+            symbol          { src_token.symbol }
         {}
 
         explicit ast_node (g10::cref<token> src_token, ast_node_type type) :
@@ -90,7 +99,8 @@ namespace g10asm
             lexeme          { src_token.get().lexeme },
             source_file     { src_token.get().source_file },
             source_line     { src_token.get().source_line },
-            source_column   { src_token.get().source_column }
+            source_column   { src_token.get().source_column },
+            symbol          { src_token.get().symbol }
         {}
 
         explicit ast_node (g10::result_cref<token> src_token_result, ast_node_type type) :
@@ -99,7 +109,8 @@ namespace g10asm
             lexeme          { src_token_result.has_value() ? src_token_result.value().get().lexeme : "" },
             source_file     { src_token_result.has_value() ? src_token_result.value().get().source_file : "" },
             source_line     { src_token_result.has_value() ? src_token_result.value().get().source_line : 0 },
-            source_column   { src_token_result.has_value() ? src_token_result.value().get().source_column : 0 }
+            source_column   { src_token_result.has_value() ? src_token_result.value().get().source_column : 0 },
+            symbol          { src_token_result.has_value() ? src_token_result.value().get().symbol : INVALID_SYMBOL }
         {}
 
     };
@@ -252,6 +263,7 @@ namespace g10asm
         ast_node_ctor(ast_instruction, ast_node_type::instruction)
         g10::instruction instruction;                       /** @brief The CPU instruction represented by this AST node. */
         std::vector<std::unique_ptr<ast_node>> operands;    /** @brief A list of AST nodes representing the instruction's operands, if any. */
+        bool long_branch { false };                         /** @brief For a relaxable `JP` instruction, set once its short (`JPB`) form is found unable to reach its target. */
     };
 
     /**
@@ -558,6 +570,7 @@ namespace g10asm
     {
         ast_node_ctor(ast_dir_global, ast_node_type::dir_global)
         std::vector<std::string_view> symbols;  /** @brief A list of label names (symbols) to be declared as global. */
+        std::vector<symbol_id> symbol_ids;      /** @brief The interned IDs of the names in `symbols`. */
     };
 
     /**
@@ -591,6 +604,7 @@ namespace g10asm
     {
         ast_node_ctor(ast_dir_extern, ast_node_type::dir_extern)
         std::vector<std::string_view> symbols;  /** @brief A list of label names (symbols) to be declared as external. */
+        std::vector<symbol_id> symbol_ids;      /** @brief The interned IDs of the names in `symbols`. */
     };
 
     /**
@@ -612,6 +626,7 @@ namespace g10asm
     {
         ast_node_ctor(ast_dir_let, ast_node_type::dir_let)
         std::string_view variable_name;                     /** @brief The variable name (without the `$` prefix). */
+        symbol_id variable_symbol;                          /** @brief The interned ID of the variable name. */
         std::unique_ptr<ast_expression> init_expression;    /** @brief The initialization expression. */
     };
 
@@ -634,6 +649,7 @@ namespace g10asm
     {
         ast_node_ctor(ast_dir_const, ast_node_type::dir_const)
         std::string_view constant_name;                     /** @brief The constant name (without the `$` prefix). */
+        symbol_id constant_symbol;                          /** @brief The interned ID of the constant name. */
         std::unique_ptr<ast_expression> value_expression;   /** @brief The constant value expression. */
     };
 
@@ -657,6 +673,7 @@ namespace g10asm
     {
         ast_node_ctor(ast_stmt_var_assignment, ast_node_type::stmt_var_assignment)
         std::string_view variable_name;                     /** @brief The target variable name (without the `$` prefix). */
+        symbol_id variable_symbol;                          /** @brief The interned ID of the target variable name. */
         token_type assignment_operator;                     /** @brief The assignment operator (=, +=, -=, *=, etc.). */
         std::unique_ptr<ast_expression> value_expression;   /** @brief The right-hand side value expression. */
     };
@@ -884,6 +901,25 @@ namespace g10asm
      */
     struct ast_expression : public ast_node
     {
+        /**
+         * @brief   The result of evaluating this expression, cached by the code
+         *          generator once every label and symbol it references is
+         *          known. Holds `std::monostate` until a result is cached.
+         */
+        mutable std::variant<
+            std::monostate,
+            std::int64_t,
+            std::uint64_t,
+            std::uint32_t
+        > cached_value;
+
+        /**
+         * @brief   The code generation attempt in which `cached_value` was
+         *          cached. The cached value is stale if this differs from the
+         *          current attempt.
+         */
+        mutable std::uint32_t cached_epoch { 0 };
+
     protected:
         explicit ast_expression (const token& src_token, ast_node_type type) :
             ast_node { src_token, type }
@@ -9,21 +9,169 @@
 
 /* Private Includes ***********************************************************/
 
+#include <g10/time_report.hpp>
 #include <g10asm/environment.hpp>
 #include <g10asm/codegen.hpp>
+#include <g10asm/parser.hpp>
+#include <g10asm/peephole.hpp>
 
 /* Private Constants and Enumerations *****************************************/
 
 namespace g10asm
 {
-
+    /**
+     * @brief   The number of bytes of source code read at a time in streaming
+     *          mode. Chunks are cut at line boundaries, so may be shorter, or
+     *          longer if a single line exceeds this size.
+     */
+    constexpr std::size_t STREAM_CHUNK_SIZE = 1024 * 1024;
+
+    /**
+     * @brief   By default, the smallest number of top-level nodes in a module
+     *          for which sections are emitted concurrently, on a machine with
+     *          more than one hardware thread. Below this, the cost of laying
+     *          out the module in two passes and starting worker threads
+     *          outweighs the gain.
+     */
+    constexpr std::size_t PARALLEL_EMISSION_MIN_NODES = 4096;
 }
 
 /* Private Unions and Structures **********************************************/
 
 namespace g10asm
 {
-    
+    /**
+     * @brief   Defines a structure holding a chunk of source code which has
+     *          been lexed and parsed in streaming mode.
+     */
+    struct stream_chunk final
+    {
+        std::unique_ptr<lexer>  lex;        /** @brief The lexer holding the chunk's source code and tokens. */
+        ast_module              module;     /** @brief The chunk's statements. */
+    };
+
+    /**
+     * @brief   Defines a structure describing what a section run emitted on a
+     *          worker thread recorded, in the worker's copy of the state.
+     */
+    struct emission_run_output final
+    {
+        std::size_t         worker = 0;             /** @brief Index of the worker which emitted the run. */
+        std::size_t         relocations_begin = 0;  /** @brief Index of the run's first relocation. */
+        std::size_t         relocations_end = 0;    /** @brief One past the index of the run's last relocation. */
+        std::size_t         listing_begin = 0;      /** @brief Index of the run's first listing entry. */
+        std::size_t         listing_end = 0;        /** @brief One past the index of the run's last listing entry. */
+        g10::result<void>   result {};              /** @brief The result of emitting the run. */
+    };
+}
+
+/* Private Classes ************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Reads, lexes and parses a source file in chunks of whole lines,
+     *          for streaming assembly.
+     */
+    class source_stream final
+    {
+    public:
+
+        explicit source_stream (const fs::path& source_file) :
+            m_source_file   { source_file },
+            m_file          { source_file, std::ios::binary }
+        {
+        }
+
+        /**
+         * @brief   Reads, lexes and parses the next chunk of the source file.
+         *
+         * @return  If successful, returns the chunk, or `std::nullopt` at the
+         *          end of the file;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto next () -> g10::result<std::optional<stream_chunk>>
+        {
+            if (m_file.is_open() == false)
+            {
+                return g10::error("Could not open source file '{}'.",
+                    m_source_file.string());
+            }
+
+            const std::size_t first_line = m_next_line;
+            if (read_chunk() == false)
+            {
+                return std::nullopt;
+            }
+
+            auto lex = std::make_unique<lexer>(m_chunk, m_source_file,
+                first_line, m_at_end == false);
+            if (lex->is_good() == false)
+            {
+                return g10::error("Failed to lex source file '{}' at line {}.",
+                    m_source_file.string(), first_line);
+            }
+
+            auto parse_result = parser::parse(*lex);
+            if (parse_result.has_value() == false)
+            {
+                return g10::error(parse_result.error());
+            }
+
+            return stream_chunk {
+                .lex = std::move(lex),
+                .module = std::move(parse_result.value())
+            };
+        }
+
+    private:
+
+        auto read_chunk () -> bool
+        {
+            m_chunk = std::move(m_carry);
+            m_carry.clear();
+
+            while (m_at_end == false)
+            {
+                const std::size_t old_size = m_chunk.size();
+                m_chunk.resize(old_size + STREAM_CHUNK_SIZE);
+                m_file.read(m_chunk.data() + old_size, STREAM_CHUNK_SIZE);
+                m_chunk.resize(old_size +
+                    static_cast<std::size_t>(m_file.gcount()));
+                m_at_end = (m_file.good() == false);
+
+                // - Cut the chunk after its last complete line, carrying the
+                //   rest over to the next chunk. Statements never span lines,
+                //   so they never span chunks.
+                const auto newline = m_chunk.rfind('\n');
+                if (m_at_end == false && newline != std::string::npos)
+                {
+                    m_carry.assign(m_chunk, newline + 1);
+                    m_chunk.resize(newline + 1);
+                    break;
+                }
+            }
+
+            // - A file which ends right at a cut has no further chunks.
+            if (m_at_end == false && m_carry.empty() == true &&
+                m_file.peek() == std::ifstream::traits_type::eof())
+            {
+                m_at_end = true;
+            }
+
+            m_next_line += static_cast<std::size_t>(
+                std::ranges::count(m_chunk, '\n'));
+            return m_chunk.empty() == false;
+        }
+
+        fs::path        m_source_file;
+        std::ifstream   m_file;
+        std::string     m_chunk = "";
+        std::string     m_carry = "";
+        std::size_t     m_next_line = 1;
+        bool            m_at_end = false;
+
+    };
 }
 
 /* Private Static Members *****************************************************/
@@ -37,7 +185,10 @@ namespace g10asm
 
 namespace g10asm
 {
-    auto codegen::process (ast_module& module) -> g10::result<g10::object>
+    auto codegen::process (
+        ast_module& module,
+        const codegen_options& options
+    ) -> g10::result<g10::object>
     {
         // - Create the codegen state.
         codegen_state state;
@@ -53,38 +204,244 @@ namespace g10asm
         // - This must be done before the first pass because variables can be
         //   used in `.org` expressions and other places that affect address
         //   calculation.
-        if (auto result = variable_pass(state, module); !result.has_value())
         {
-            std::println(stderr,
-                "Variable pass code generation failed: {}", result.error());
-            return g10::error(result.error());
+            g10::time_report::phase timer { "Variable pass" };
+            if (auto result = variable_pass(state, module); !result.has_value())
+            {
+                std::println(stderr,
+                    "Variable pass code generation failed: {}", result.error());
+                return g10::error(result.error());
+            }
         }
 
-        // First Pass: 
-        // - Collect symbols, create sections, assign addresses.
-        if (auto result = first_pass(state, module); !result.has_value())
+        // Constant Folding:
+        // - With all variables and constants known, collapse constant
+        //   subexpressions into literals.
         {
-            std::println(stderr,
-                "First pass code generation failed: {}", result.error());
-            return g10::error(result.error());
+            g10::time_report::phase timer { "Constant folding" };
+            fold_constants(state, module);
         }
 
-        // Second Pass: 
-        // - Emit code, evaluate expressions, generate relocations.
-        if (auto result = second_pass(state, module); !result.has_value())
+        // Peephole Optimization:
+        // - If enabled, rewrite instructions into cheaper equivalents, now
+        //   that constant operands are known.
+        if (options.optimize == true)
         {
-            std::println(stderr,
-                "Second pass code generation failed: {}", result.error());
-            return g10::error(result.error());
+            g10::time_report::phase timer { "Peephole optimization" };
+            peephole::optimize(module, options.verbose);
         }
 
+        // Code Generation and Branch Relaxation:
+        // - Generate code until the encoding of every relaxable branch (`JP`)
+        //   has settled. Branches only ever grow from their short form to
+        //   their long form, so this converges within a few attempts.
+        // - Each attempt starts from a fresh state. The environment is left
+        //   untouched, as the variable pass has already run.
+        std::uint32_t attempt = 0;
+        do
+        {
+            state = codegen_state {};
+            state.object.set_flags(g10::object_flags::relocatable);
+            state.cache_expressions = true;
+            state.cache_epoch = ++attempt;
+            state.listing = (options.listing != nullptr);
+            state.parallel_min_nodes = options.parallel_min_nodes.value_or(
+                (std::thread::hardware_concurrency() > 1) ?
+                    PARALLEL_EMISSION_MIN_NODES : 0);
+
+            if (auto result = generate_code(state, module); !result.has_value())
+            {
+                return g10::error(result.error());
+            }
+        } while (state.relaxation_changed == true);
+
         // Finalization: 
         // - Validate the object, set final flags, verify symbols and relocations.
-        if (auto result = finalize(state); !result.has_value())
         {
-            std::println(stderr,
-                "Finalization failed: {}", result.error());
-            return g10::error(result.error());
+            g10::time_report::phase timer { "Finalization" };
+            if (auto result = finalize(state); !result.has_value())
+            {
+                std::println(stderr,
+                    "Finalization failed: {}", result.error());
+                return g10::error(result.error());
+            }
+        }
+
+        // - Hand over the listing entries recorded by the final attempt, if
+        //   requested.
+        if (options.listing != nullptr)
+        {
+            *options.listing = std::move(state.listing_entries);
+        }
+
+        // - Return the generated object file.
+        return std::move(state.object);
+    }
+}
+
+namespace g10asm
+{
+    auto codegen::process_stream (
+        const fs::path& source_file,
+        const codegen_options& options
+    ) -> g10::result<g10::object>
+    {
+        // - Create the codegen state.
+        codegen_state state;
+
+        // - Clear the environment from any previous assembly runs.
+        environment::clear();
+
+        // Variable Pass:
+        // - Stream the whole file once, processing only its variable-related
+        //   statements. Each chunk is discarded as soon as it is processed.
+        {
+            g10::time_report::phase timer { "Streaming variable pass" };
+            source_stream stream { source_file };
+            while (true)
+            {
+                auto chunk_result = stream.next();
+                if (!chunk_result.has_value())
+                {
+                    std::println(stderr, "Error: {}", chunk_result.error());
+                    return g10::error(chunk_result.error());
+                }
+                else if (chunk_result->has_value() == false)
+                {
+                    break;
+                }
+
+                if (auto result = variable_pass(state,
+                        chunk_result->value().module);
+                    !result.has_value())
+                {
+                    std::println(stderr,
+                        "Variable pass code generation failed: {}", result.error());
+                    return g10::error(result.error());
+                }
+            }
+        }
+
+        // Single Pass:
+        // - Stream the file again, folding, optimizing and emitting each chunk
+        //   in turn. A chunk is kept only while fixups recorded for any of its
+        //   statements remain unresolved.
+        {
+            g10::time_report::phase timer { "Streaming single pass" };
+
+            state = codegen_state {};
+            state.object.set_flags(g10::object_flags::relocatable);
+            state.cache_expressions = true;
+            state.cache_epoch = 1;
+
+            auto single_result = [&state, &source_file, &options] ()
+                -> g10::result<void>
+            {
+                if (auto result = ensure_section(state, state.location_counter);
+                    !result.has_value())
+                {
+                    return g10::error(result.error());
+                }
+
+                source_stream stream { source_file };
+                std::map<std::size_t, stream_chunk> live_chunks;
+                std::vector<std::size_t> fixup_chunks;
+                for (std::size_t sequence = 0; ; ++sequence)
+                {
+                    auto chunk_result = stream.next();
+                    if (!chunk_result.has_value())
+                    {
+                        return g10::error(chunk_result.error());
+                    }
+                    else if (chunk_result->has_value() == false)
+                    {
+                        break;
+                    }
+
+                    auto& module = chunk_result->value().module;
+                    fold_constants(state, module);
+                    if (options.optimize == true)
+                    {
+                        peephole::optimize(module, options.verbose);
+                    }
+
+                    for (auto& child : module.children)
+                    {
+                        if (!child || !child->valid)
+                        {
+                            continue;
+                        }
+
+                        settle_stream_branch(state, *child);
+                        auto result = single_pass_node(state, *child);
+                        if (!result.has_value())
+                        {
+                            return g10::error(result.error());
+                        }
+                        else if (result.value() == false)
+                        {
+                            return g10::error(
+                                " - This statement's placement depends on a label which is not yet defined,\n"
+                                "   which cannot be assembled in streaming mode.\n"
+                                " - In file '{}:{}'",
+                                child->source_file,
+                                child->source_line
+                            );
+                        }
+                    }
+
+                    // - Resolve whatever fixups this chunk's labels allow, then
+                    //   keep only the chunks still referenced by a fixup.
+                    fixup_chunks.resize(state.fixups.size(), sequence);
+                    live_chunks.emplace(sequence,
+                        std::move(chunk_result->value()));
+                    if (auto result = resolve_ready_fixups(state, fixup_chunks);
+                        !result.has_value())
+                    {
+                        return result;
+                    }
+
+                    std::erase_if(live_chunks,
+                        [&fixup_chunks] (const auto& entry)
+                        {
+                            return std::ranges::binary_search(fixup_chunks,
+                                entry.first) == false;
+                        });
+                }
+
+                // - Whatever remains references labels which were never
+                //   defined; resolving it reports the errors.
+                auto result = resolve_fixups(state);
+                if (!result.has_value())
+                {
+                    return g10::error(result.error());
+                }
+                else if (result.value() == false || state.relaxation_changed == true)
+                {
+                    return g10::error("The module's layout could not be settled in streaming mode.");
+                }
+
+                return {};
+            }();
+
+            if (!single_result.has_value())
+            {
+                std::println(stderr,
+                    "Code generation failed: {}", single_result.error());
+                return g10::error(single_result.error());
+            }
+        }
+
+        // Finalization: 
+        // - Validate the object, set final flags, verify symbols and relocations.
+        {
+            g10::time_report::phase timer { "Finalization" };
+            if (auto result = finalize(state); !result.has_value())
+            {
+                std::println(stderr,
+                    "Finalization failed: {}", result.error());
+                return g10::error(result.error());
+            }
         }
 
         // - Return the generated object file.
@@ -173,7 +530,7 @@ namespace g10asm
 
         // - Define the variable in the environment.
         auto define_result = environment::define_variable(
-            std::string(let_dir.variable_name),
+            let_dir.variable_symbol,
             init_result.value(),
             let_dir.source_file,
             let_dir.source_line
@@ -215,193 +572,1033 @@ namespace g10asm
 
         // - Define the constant in the environment.
         auto define_result = environment::define_constant(
-            std::string(const_dir.constant_name),
+            const_dir.constant_symbol,
             value_result.value(),
             const_dir.source_file,
             const_dir.source_line
         );
 
-        if (!define_result.has_value())
-        {
-            return g10::error(
-                " - Failed to define constant '${}': {}\n"
-                " - In file '{}:{}'",
-                const_dir.constant_name,
-                define_result.error(),
-                const_dir.source_file,
-                const_dir.source_line
-            );
+        if (!define_result.has_value())
+        {
+            return g10::error(
+                " - Failed to define constant '${}': {}\n"
+                " - In file '{}:{}'",
+                const_dir.constant_name,
+                define_result.error(),
+                const_dir.source_file,
+                const_dir.source_line
+            );
+        }
+
+        return {};
+    }
+
+    auto codegen::variable_pass_assignment (
+        codegen_state& state,
+        ast_stmt_var_assignment& assign_stmt
+    ) -> g10::result<void>
+    {
+        const std::string_view var_name { assign_stmt.variable_name };
+        const symbol_id var_symbol = assign_stmt.variable_symbol;
+
+        // - Check if the variable exists.
+        if (!environment::exists(var_symbol))
+        {
+            return g10::error(
+                " - Undefined variable '${}' in assignment.\n"
+                " - In file '{}:{}'",
+                var_name,
+                assign_stmt.source_file,
+                assign_stmt.source_line
+            );
+        }
+
+        // - Check if it's a constant (cannot be modified).
+        if (environment::is_constant(var_symbol))
+        {
+            return g10::error(
+                " - Cannot modify constant '${}' in assignment.\n"
+                " - In file '{}:{}'",
+                var_name,
+                assign_stmt.source_file,
+                assign_stmt.source_line
+            );
+        }
+
+        // - Get the current value.
+        auto current_result = environment::get_value(var_symbol);
+        if (!current_result.has_value())
+        {
+            return g10::error(current_result.error());
+        }
+
+        // - Evaluate the right-hand side expression.
+        auto rhs_result = evaluate_expression(state, *assign_stmt.value_expression);
+        if (!rhs_result.has_value())
+        {
+            return g10::error(
+                " - Failed to evaluate assignment expression for '${}': {}\n"
+                " - In file '{}:{}'",
+                var_name,
+                rhs_result.error(),
+                assign_stmt.source_file,
+                assign_stmt.source_line
+            );
+        }
+
+        // - Convert both values to integers for compound operations.
+        auto current_int_result = value_to_integer(current_result.value());
+        auto rhs_int_result = value_to_integer(rhs_result.value());
+
+        if (!current_int_result.has_value())
+        {
+            return g10::error(
+                " - Variable '${}' does not hold a numeric value.\n"
+                " - In file '{}:{}'",
+                var_name,
+                assign_stmt.source_file,
+                assign_stmt.source_line
+            );
+        }
+
+        if (!rhs_int_result.has_value())
+        {
+            return g10::error(
+                " - Assignment expression for '${}' does not evaluate to a numeric value.\n"
+                " - In file '{}:{}'",
+                var_name,
+                assign_stmt.source_file,
+                assign_stmt.source_line
+            );
+        }
+
+        std::int64_t current_int = current_int_result.value();
+        std::int64_t rhs_int = rhs_int_result.value();
+        std::int64_t new_value = 0;
+
+        // - Apply the assignment operator.
+        switch (assign_stmt.assignment_operator)
+        {
+            case token_type::assign_equal:
+                new_value = rhs_int;
+                break;
+            case token_type::assign_plus:
+                new_value = current_int + rhs_int;
+                break;
+            case token_type::assign_minus:
+                new_value = current_int - rhs_int;
+                break;
+            case token_type::assign_times:
+                new_value = current_int * rhs_int;
+                break;
+            case token_type::assign_divide:
+                if (rhs_int == 0)
+                {
+                    return g10::error(
+                        " - Division by zero in assignment to '${}'\n"
+                        " - In file '{}:{}'",
+                        var_name,
+                        assign_stmt.source_file,
+                        assign_stmt.source_line
+                    );
+                }
+                new_value = current_int / rhs_int;
+                break;
+            case token_type::assign_modulo:
+                if (rhs_int == 0)
+                {
+                    return g10::error(
+                        " - Modulo by zero in assignment to '${}'\n"
+                        " - In file '{}:{}'",
+                        var_name,
+                        assign_stmt.source_file,
+                        assign_stmt.source_line
+                    );
+                }
+                new_value = current_int % rhs_int;
+                break;
+            case token_type::assign_and:
+                new_value = current_int & rhs_int;
+                break;
+            case token_type::assign_or:
+                new_value = current_int | rhs_int;
+                break;
+            case token_type::assign_xor:
+                new_value = current_int ^ rhs_int;
+                break;
+            case token_type::assign_shift_left:
+                new_value = current_int << rhs_int;
+                break;
+            case token_type::assign_shift_right:
+                new_value = current_int >> rhs_int;
+                break;
+            case token_type::assign_exponent:
+            {
+                // - Compute exponentiation.
+                new_value = 1;
+                for (std::int64_t i = 0; i < rhs_int; ++i)
+                {
+                    new_value *= current_int;
+                }
+                break;
+            }
+            default:
+                return g10::error(
+                    " - Unknown assignment operator in assignment to '${}'\n"
+                    " - In file '{}:{}'",
+                    var_name,
+                    assign_stmt.source_file,
+                    assign_stmt.source_line
+                );
+        }
+
+        // - Update the variable in the environment.
+        auto set_result = environment::set_value(var_symbol, value{new_value});
+        if (!set_result.has_value())
+        {
+            return g10::error(set_result.error());
+        }
+
+        return {};
+    }
+}
+
+/* Private Methods - Constant Folding *****************************************/
+
+namespace g10asm
+{
+    auto codegen::fold_constants (codegen_state& state, ast_module& module)
+        -> void
+    {
+        for (auto& child : module.children)
+        {
+            if (!child || !child->valid)
+            {
+                continue;
+            }
+
+            switch (child->type)
+            {
+                case ast_node_type::instruction:
+                {
+                    auto& instr = static_cast<ast_instruction&>(*child);
+                    for (auto& operand : instr.operands)
+                    {
+                        if (!operand || !operand->valid)
+                        {
+                            continue;
+                        }
+
+                        if (operand->type == ast_node_type::opr_immediate)
+                        {
+                            fold_expression(state,
+                                static_cast<ast_opr_immediate&>(*operand).value);
+                        }
+                        else if (operand->type == ast_node_type::opr_direct)
+                        {
+                            fold_expression(state,
+                                static_cast<ast_opr_direct&>(*operand).address);
+                        }
+                    }
+                } break;
+
+                case ast_node_type::dir_org:
+                    fold_expression(state,
+                        static_cast<ast_dir_org&>(*child).address_expression);
+                    break;
+
+                case ast_node_type::dir_int:
+                    fold_expression(state,
+                        static_cast<ast_dir_int&>(*child).vector_expression);
+                    break;
+
+                case ast_node_type::dir_byte:
+                    for (auto& value_node : static_cast<ast_dir_byte&>(*child).values)
+                    {
+                        fold_node(state, value_node);
+                    }
+                    break;
+
+                case ast_node_type::dir_word:
+                    for (auto& value_node : static_cast<ast_dir_word&>(*child).values)
+                    {
+                        fold_node(state, value_node);
+                    }
+                    break;
+
+                case ast_node_type::dir_dword:
+                    for (auto& value_node : static_cast<ast_dir_dword&>(*child).values)
+                    {
+                        fold_node(state, value_node);
+                    }
+                    break;
+
+                default:
+                    // - `.let`, `.const` and assignments have already been
+                    //   evaluated by the variable pass.
+                    break;
+            }
+        }
+    }
+
+    auto codegen::fold_expression (
+        codegen_state& state,
+        std::unique_ptr<ast_expression>& slot
+    ) -> bool
+    {
+        if (!slot || !slot->valid)
+        {
+            return false;
+        }
+
+        // - Fold the expression's children first, and determine whether the
+        //   expression as a whole is constant.
+        bool is_constant = false;
+        bool is_literal = false;
+        switch (slot->type)
+        {
+            case ast_node_type::expr_primary:
+            {
+                const auto& primary = static_cast<const ast_expr_primary&>(*slot);
+                switch (primary.expr_type)
+                {
+                    case ast_expr_primary::primary_type::integer_literal:
+                    case ast_expr_primary::primary_type::number_literal:
+                    case ast_expr_primary::primary_type::char_literal:
+                        is_constant = true;
+                        is_literal = true;
+                        break;
+
+                    case ast_expr_primary::primary_type::variable:
+                        is_constant = environment::is_constant(primary.symbol);
+                        break;
+
+                    default:
+                        // - String literals are left in place, as `.byte`
+                        //   emits them specially; identifiers refer to labels
+                        //   and symbols, which are not yet known.
+                        break;
+                }
+            } break;
+
+            case ast_node_type::expr_binary:
+            {
+                auto& binary = static_cast<ast_expr_binary&>(*slot);
+                const bool left = fold_expression(state, binary.left_operand);
+                const bool right = fold_expression(state, binary.right_operand);
+                is_constant = left && right;
+            } break;
+
+            case ast_node_type::expr_unary:
+                is_constant = fold_expression(state,
+                    static_cast<ast_expr_unary&>(*slot).operand);
+                break;
+
+            case ast_node_type::expr_grouping:
+                is_constant = fold_expression(state,
+                    static_cast<ast_expr_grouping&>(*slot).inner_expression);
+                break;
+
+            default:
+                break;
+        }
+
+        if (is_constant == false || is_literal == true)
+        {
+            return is_constant;
+        }
+
+        // - Evaluate the constant expression. If it fails (eg. division by
+        //   zero), leave it in place so the error is reported in context.
+        auto result = evaluate_uncached(state, *slot);
+        if (!result.has_value())
+        {
+            return false;
+        }
+        else if (std::holds_alternative<std::int64_t>(result.value()) == false)
+        {
+            // - Fixed-point and string constants are left in place, but may
+            //   still fold into an enclosing integer expression.
+            return true;
+        }
+
+        // - Replace the expression with an integer literal, keeping its source
+        //   location for error reporting.
+        auto literal = std::make_unique<ast_expr_primary>(token {
+            .type = token_type::integer_literal,
+            .lexeme = slot->lexeme,
+            .source_file = slot->source_file,
+            .source_line = slot->source_line,
+            .source_column = slot->source_column
+        });
+        literal->expr_type = ast_expr_primary::primary_type::integer_literal;
+        literal->value = std::get<std::int64_t>(result.value());
+
+        slot = std::move(literal);
+        return true;
+    }
+
+    auto codegen::fold_node (
+        codegen_state& state,
+        std::unique_ptr<ast_node>& slot
+    ) -> void
+    {
+        if (!slot ||
+            (
+                slot->type != ast_node_type::expr_primary &&
+                slot->type != ast_node_type::expr_binary &&
+                slot->type != ast_node_type::expr_unary &&
+                slot->type != ast_node_type::expr_grouping
+            ))
+        {
+            return;
+        }
+
+        std::unique_ptr<ast_expression> expr {
+            static_cast<ast_expression*>(slot.release())
+        };
+        fold_expression(state, expr);
+        slot = std::move(expr);
+    }
+}
+
+/* Private Methods - Code Generation ******************************************/
+
+namespace g10asm
+{
+    auto codegen::generate_code (codegen_state& state, ast_module& module)
+        -> g10::result<void>
+    {
+        // Single Pass:
+        // - Collect symbols, create sections and emit code in one walk over
+        //   the AST, then patch any forward references in place.
+        // - A module whose sections are emitted concurrently skips straight
+        //   to the two-pass scheme, which places every label first.
+        bool laid_out = false;
+        if (emits_concurrently(state, module) == false)
+        {
+            auto single_result = [&state, &module] ()
+            {
+                g10::time_report::phase timer { "Single pass" };
+                auto result = single_pass(state, module);
+                if (result.has_value() == true && result.value() == true)
+                {
+                    result = resolve_fixups(state);
+                }
+
+                return result;
+            }();
+
+            if (!single_result.has_value())
+            {
+                std::println(stderr,
+                    "Code generation failed: {}", single_result.error());
+                return g10::error(single_result.error());
+            }
+
+            laid_out = single_result.value();
+        }
+
+        // - If the module's layout depends on forward references, start over
+        //   and fall back to the two-pass scheme below. Any branches already
+        //   marked to use their long form remain so.
+        if (laid_out == false)
+        {
+            const bool listing = state.listing;
+            const std::size_t parallel_min_nodes = state.parallel_min_nodes;
+            state = codegen_state {};
+            state.object.set_flags(g10::object_flags::relocatable);
+            state.listing = listing;
+            state.parallel_min_nodes = parallel_min_nodes;
+
+            // First Pass: 
+            // - Collect symbols, create sections, assign addresses.
+            {
+                g10::time_report::phase timer { "First pass" };
+                if (auto result = first_pass(state, module); !result.has_value())
+                {
+                    std::println(stderr,
+                        "First pass code generation failed: {}", result.error());
+                    return g10::error(result.error());
+                }
+            }
+
+            // Second Pass: 
+            // - Emit code, evaluate expressions, generate relocations.
+            {
+                g10::time_report::phase timer { "Second pass" };
+                if (auto result = second_pass(state, module); !result.has_value())
+                {
+                    std::println(stderr,
+                        "Second pass code generation failed: {}", result.error());
+                    return g10::error(result.error());
+                }
+            }
+        }
+
+        return {};
+    }
+
+    auto codegen::emits_concurrently (
+        const codegen_state& state,
+        const ast_module& module
+    ) -> bool
+    {
+        if (state.parallel_min_nodes == 0 ||
+            module.children.size() < state.parallel_min_nodes)
+        {
+            return false;
+        }
+
+        // - Only a directive which moves the location counter can start
+        //   another section.
+        return std::ranges::any_of(module.children,
+            [] (const std::unique_ptr<ast_node>& child)
+            {
+                return child && child->valid && (
+                    child->type == ast_node_type::dir_org ||
+                    child->type == ast_node_type::dir_rom ||
+                    child->type == ast_node_type::dir_ram ||
+                    child->type == ast_node_type::dir_int);
+            });
+    }
+}
+
+/* Private Methods - Branch Relaxation ****************************************/
+
+namespace g10asm
+{
+    auto codegen::is_relaxable_branch (const ast_instruction& instr) -> bool
+    {
+        if (instr.instruction != g10::instruction::jp ||
+            instr.long_branch == true)
+        {
+            return false;
+        }
+
+        // - Skip the execution condition, if any.
+        std::size_t operand_start = 0;
+        if (!instr.operands.empty() &&
+            instr.operands[0]->type == ast_node_type::opr_condition)
+        {
+            operand_start = 1;
+        }
+
+        if (operand_start >= instr.operands.size() ||
+            instr.operands[operand_start]->type != ast_node_type::opr_immediate)
+        {
+            return false;
+        }
+
+        // - Only bare labels are relaxed; any other target expression is an
+        //   absolute address, which must be reached with `JMP`.
+        const auto& imm_node =
+            static_cast<const ast_opr_immediate&>(*instr.operands[operand_start]);
+        if (!imm_node.value || imm_node.value->type != ast_node_type::expr_primary)
+        {
+            return false;
+        }
+
+        const auto& primary =
+            static_cast<const ast_expr_primary&>(*imm_node.value);
+        return primary.expr_type == ast_expr_primary::primary_type::identifier;
+    }
+
+    auto codegen::emit_relaxed_branch (
+        codegen_state& state,
+        ast_instruction& instr,
+        std::uint8_t condition
+    ) -> g10::result<void>
+    {
+        const std::size_t operand_start =
+            (instr.operands[0]->type == ast_node_type::opr_condition) ? 1 : 0;
+        const auto& imm_node =
+            static_cast<const ast_opr_immediate&>(*instr.operands[operand_start]);
+        const auto& primary =
+            static_cast<const ast_expr_primary&>(*imm_node.value);
+
+        // - Work out the offset to the target label, from the address after
+        //   this instruction. While emitting speculatively, the label is not
+        //   yet known; the instruction is re-emitted once it is.
+        std::int64_t offset = 0;
+        bool reachable = state.speculative;
+        if (const auto* label = state.label_map.find(primary.symbol);
+            label != nullptr && label->first == state.current_section_index)
+        {
+            offset = static_cast<std::int64_t>(label->second) -
+                static_cast<std::int64_t>(state.location_counter + 4);
+            reachable = (offset >= -32768 && offset <= 32767);
+        }
+
+        // - If the target cannot be reached, use the long form from the next
+        //   attempt onwards, but keep this attempt's layout intact.
+        if (reachable == false)
+        {
+            instr.long_branch = true;
+            state.relaxation_changed = true;
+            offset = 0;
+        }
+
+        emit_word(state, 0x4200 | (condition << 4));
+        emit_word(state, static_cast<std::uint16_t>(
+            static_cast<std::int16_t>(offset)));
+        return {};
+    }
+}
+
+/* Private Methods - Single Pass **********************************************/
+
+namespace g10asm
+{
+    auto codegen::single_pass (codegen_state& state, ast_module& module)
+        -> g10::result<bool>
+    {
+        // - Create initial section at the default location (`$2000` in ROM).
+        if (auto result = ensure_section(state, state.location_counter);
+            !result.has_value())
+        {
+            return g10::error(result.error());
+        }
+
+        // - Process each node in the module.
+        for (auto& child : module.children)
+        {
+            if (!child || !child->valid)
+            {
+                continue;
+            }
+
+            auto result = single_pass_node(state, *child);
+            if (!result.has_value() || result.value() == false)
+            {
+                return result;
+            }
+        }
+
+        return true;
+    }
+
+    auto codegen::single_pass_node (codegen_state& state, ast_node& node)
+        -> g10::result<bool>
+    {
+        // - Symbol and region directives are handled exactly as in the first
+        //   pass; instructions and data are emitted immediately.
+        g10::result<void> result {};
+        switch (node.type)
+        {
+            case ast_node_type::label_definition:
+                result = first_pass_label(state,
+                    static_cast<ast_label_definition&>(node));
+                record_listing_entry(state, node,
+                    state.location_counter,
+                    current_section_offset(state));
+                break;
+
+            case ast_node_type::dir_org:
+            {
+                // - The new location must be known now, so a forward
+                //   reference here requires the two-pass scheme.
+                auto& org = static_cast<ast_dir_org&>(node);
+                if (org.address_expression &&
+                    references_unresolved(state, *org.address_expression))
+                {
+                    return false;
+                }
+
+                result = first_pass_org(state, org);
+            } break;
+
+            case ast_node_type::dir_rom:
+                result = first_pass_rom(state,
+                    static_cast<ast_dir_rom&>(node));
+                break;
+
+            case ast_node_type::dir_ram:
+                result = first_pass_ram(state,
+                    static_cast<ast_dir_ram&>(node));
+                break;
+
+            case ast_node_type::dir_int:
+            {
+                auto& int_ = static_cast<ast_dir_int&>(node);
+                if (int_.vector_expression &&
+                    references_unresolved(state, *int_.vector_expression))
+                {
+                    return false;
+                }
+
+                result = first_pass_int(state, int_);
+            } break;
+
+            case ast_node_type::dir_byte:
+            case ast_node_type::dir_word:
+            case ast_node_type::dir_dword:
+                // - In the RAM region, data directives reserve space by
+                //   count, so their size must be known now.
+                if (state.in_rom_region == false &&
+                    statement_references_unresolved(state, node))
+                {
+                    return false;
+                }
+
+                [[fallthrough]];
+
+            case ast_node_type::instruction:
+            {
+                const std::uint32_t address = state.location_counter;
+                const std::uint32_t offset = current_section_offset(state);
+
+                auto emit_result = single_pass_statement(state, node);
+                if (!emit_result.has_value())
+                {
+                    return g10::error(emit_result.error());
+                }
+                else if (emit_result.value() == false)
+                {
+                    return false;
+                }
+
+                record_listing_entry(state, node, address, offset);
+            } break;
+
+            case ast_node_type::dir_global:
+                result = first_pass_global(state,
+                    static_cast<ast_dir_global&>(node));
+                break;
+
+            case ast_node_type::dir_extern:
+                result = first_pass_extern(state,
+                    static_cast<ast_dir_extern&>(node));
+                break;
+
+            default:
+                // Ignore other node types (expressions, operands, etc.)
+                break;
+        }
+
+        if (!result.has_value())
+        {
+            return g10::error(result.error());
+        }
+
+        return true;
+    }
+
+    auto codegen::single_pass_statement (
+        codegen_state& state,
+        ast_node& node
+    ) -> g10::result<bool>
+    {
+        // - If everything the statement references is already known, emit it
+        //   directly.
+        if (statement_references_unresolved(state, node) == false)
+        {
+            if (auto result = emit_statement(state, node); !result.has_value())
+            {
+                return g10::error(result.error());
+            }
+
+            return true;
+        }
+
+        // - Otherwise, emit the statement speculatively to reserve its space,
+        //   and record a fixup so that it can be re-emitted once all labels
+        //   are known.
+        codegen_fixup fixup {
+            .node = &node,
+            .section_index = state.current_section_index,
+            .section_offset = current_section_offset(state),
+            .location_counter = state.location_counter,
+            .size = 0,
+            .in_rom_region = state.in_rom_region
+        };
+
+        state.speculative = true;
+        auto result = emit_statement(state, node);
+        state.speculative = false;
+
+        // - If the statement cannot be emitted speculatively, its size cannot
+        //   be determined; the two-pass scheme will report any real error.
+        if (!result.has_value())
+        {
+            return false;
+        }
+
+        fixup.size = state.location_counter - fixup.location_counter;
+        state.fixups.push_back(fixup);
+        return true;
+    }
+
+    auto codegen::resolve_fixups (codegen_state& state)
+        -> g10::result<bool>
+    {
+        for (const auto& fixup : state.fixups)
+        {
+            auto result = resolve_fixup(state, fixup);
+            if (!result.has_value() || result.value() == false)
+            {
+                return result;
+            }
+        }
+
+        state.fixups.clear();
+        return true;
+    }
+
+    auto codegen::resolve_fixup (
+        codegen_state& state,
+        const codegen_fixup& fixup
+    ) -> g10::result<bool>
+    {
+        // - Restore the state as it was when the statement was first
+        //   encountered, then re-emit it over its reserved space.
+        state.location_counter = fixup.location_counter;
+        state.current_section_index = fixup.section_index;
+        state.in_rom_region = fixup.in_rom_region;
+        state.patch_cursor = fixup.section_offset;
+
+        state.patching = true;
+        auto result = emit_statement(state, *fixup.node);
+        state.patching = false;
+
+        if (!result.has_value())
+        {
+            return g10::error(result.error());
+        }
+
+        // - The statement's size must not depend on the values of the labels
+        //   it references.
+        return (state.location_counter - fixup.location_counter == fixup.size);
+    }
+
+    auto codegen::emit_statement (codegen_state& state, ast_node& node)
+        -> g10::result<void>
+    {
+        switch (node.type)
+        {
+            case ast_node_type::instruction:
+                return emit_instruction(state,
+                    static_cast<ast_instruction&>(node));
+
+            case ast_node_type::dir_byte:
+                return second_pass_byte(state,
+                    static_cast<ast_dir_byte&>(node));
+
+            case ast_node_type::dir_word:
+                return second_pass_word(state,
+                    static_cast<ast_dir_word&>(node));
+
+            case ast_node_type::dir_dword:
+                return second_pass_dword(state,
+                    static_cast<ast_dir_dword&>(node));
+
+            default:
+                return g10::error("Internal error: node is not a statement "
+                    "({}:{}:{})",
+                    node.source_file,
+                    node.source_line,
+                    node.source_column);
+        }
+    }
+
+    auto codegen::references_unresolved (
+        const codegen_state& state,
+        const ast_expression& expr
+    ) -> bool
+    {
+        switch (expr.type)
+        {
+            case ast_node_type::expr_primary:
+            {
+                const auto& primary = static_cast<const ast_expr_primary&>(expr);
+                if (primary.expr_type == ast_expr_primary::primary_type::identifier)
+                {
+                    return state.label_map.contains(primary.symbol) == false &&
+                        state.extern_symbols.contains(primary.symbol) == false;
+                }
+                return false;
+            }
+
+            case ast_node_type::expr_binary:
+            {
+                const auto& binary = static_cast<const ast_expr_binary&>(expr);
+                return (binary.left_operand &&
+                        references_unresolved(state, *binary.left_operand)) ||
+                    (binary.right_operand &&
+                        references_unresolved(state, *binary.right_operand));
+            }
+
+            case ast_node_type::expr_unary:
+            {
+                const auto& unary = static_cast<const ast_expr_unary&>(expr);
+                return unary.operand && references_unresolved(state, *unary.operand);
+            }
+
+            case ast_node_type::expr_grouping:
+            {
+                const auto& grouping = static_cast<const ast_expr_grouping&>(expr);
+                return grouping.inner_expression &&
+                    references_unresolved(state, *grouping.inner_expression);
+            }
+
+            default:
+                return false;
         }
-
-        return {};
     }
 
-    auto codegen::variable_pass_assignment (
-        codegen_state& state,
-        ast_stmt_var_assignment& assign_stmt
-    ) -> g10::result<void>
+    auto codegen::statement_references_unresolved (
+        const codegen_state& state,
+        const ast_node& node
+    ) -> bool
     {
-        const std::string var_name(assign_stmt.variable_name);
-
-        // - Check if the variable exists.
-        if (!environment::exists(var_name))
+        // - Checks a single operand or value node.
+        auto check = [&] (const std::unique_ptr<ast_node>& child) -> bool
         {
-            return g10::error(
-                " - Undefined variable '${}' in assignment.\n"
-                " - In file '{}:{}'",
-                var_name,
-                assign_stmt.source_file,
-                assign_stmt.source_line
-            );
-        }
+            if (!child || !child->valid)
+            {
+                return false;
+            }
 
-        // - Check if it's a constant (cannot be modified).
-        if (environment::is_constant(var_name))
+            switch (child->type)
+            {
+                case ast_node_type::opr_immediate:
+                {
+                    const auto& imm = static_cast<const ast_opr_immediate&>(*child);
+                    return imm.value && references_unresolved(state, *imm.value);
+                }
+
+                case ast_node_type::opr_direct:
+                {
+                    const auto& dir = static_cast<const ast_opr_direct&>(*child);
+                    return dir.address && references_unresolved(state, *dir.address);
+                }
+
+                case ast_node_type::expr_primary:
+                case ast_node_type::expr_binary:
+                case ast_node_type::expr_unary:
+                case ast_node_type::expr_grouping:
+                    return references_unresolved(state,
+                        static_cast<const ast_expression&>(*child));
+
+                default:
+                    return false;
+            }
+        };
+
+        switch (node.type)
         {
-            return g10::error(
-                " - Cannot modify constant '${}' in assignment.\n"
-                " - In file '{}:{}'",
-                var_name,
-                assign_stmt.source_file,
-                assign_stmt.source_line
-            );
+            case ast_node_type::instruction:
+                return std::ranges::any_of(
+                    static_cast<const ast_instruction&>(node).operands, check);
+
+            case ast_node_type::dir_byte:
+                return std::ranges::any_of(
+                    static_cast<const ast_dir_byte&>(node).values, check);
+
+            case ast_node_type::dir_word:
+                return std::ranges::any_of(
+                    static_cast<const ast_dir_word&>(node).values, check);
+
+            case ast_node_type::dir_dword:
+                return std::ranges::any_of(
+                    static_cast<const ast_dir_dword&>(node).values, check);
+
+            default:
+                return false;
         }
+    }
+}
 
-        // - Get the current value.
-        auto current_result = environment::get_value(var_name);
-        if (!current_result.has_value())
+/* Private Methods - Streaming ************************************************/
+
+namespace g10asm
+{
+    auto codegen::settle_stream_branch (codegen_state& state, ast_node& node)
+        -> void
+    {
+        if (node.type != ast_node_type::instruction)
         {
-            return g10::error(current_result.error());
+            return;
         }
 
-        // - Evaluate the right-hand side expression.
-        auto rhs_result = evaluate_expression(state, *assign_stmt.value_expression);
-        if (!rhs_result.has_value())
+        auto& instr = static_cast<ast_instruction&>(node);
+        if (is_relaxable_branch(instr) == false)
         {
-            return g10::error(
-                " - Failed to evaluate assignment expression for '${}': {}\n"
-                " - In file '{}:{}'",
-                var_name,
-                rhs_result.error(),
-                assign_stmt.source_file,
-                assign_stmt.source_line
-            );
+            return;
         }
 
-        // - Convert both values to integers for compound operations.
-        auto current_int_result = value_to_integer(current_result.value());
-        auto rhs_int_result = value_to_integer(rhs_result.value());
+        const std::size_t operand_start =
+            (instr.operands[0]->type == ast_node_type::opr_condition) ? 1 : 0;
+        const auto& imm_node =
+            static_cast<const ast_opr_immediate&>(*instr.operands[operand_start]);
+        const auto& primary =
+            static_cast<const ast_expr_primary&>(*imm_node.value);
 
-        if (!current_int_result.has_value())
+        // - A forward branch's target is not yet known, and the branch will
+        //   not be emitted again once it is, so it must take its long form.
+        bool reachable = false;
+        if (const auto* label = state.label_map.find(primary.symbol);
+            label != nullptr && label->first == state.current_section_index)
         {
-            return g10::error(
-                " - Variable '${}' does not hold a numeric value.\n"
-                " - In file '{}:{}'",
-                var_name,
-                assign_stmt.source_file,
-                assign_stmt.source_line
-            );
+            const std::int64_t offset = static_cast<std::int64_t>(label->second) -
+                static_cast<std::int64_t>(state.location_counter + 4);
+            reachable = (offset >= -32768 && offset <= 32767);
         }
 
-        if (!rhs_int_result.has_value())
-        {
-            return g10::error(
-                " - Assignment expression for '${}' does not evaluate to a numeric value.\n"
-                " - In file '{}:{}'",
-                var_name,
-                assign_stmt.source_file,
-                assign_stmt.source_line
-            );
-        }
+        instr.long_branch = (reachable == false);
+    }
 
-        std::int64_t current_int = current_int_result.value();
-        std::int64_t rhs_int = rhs_int_result.value();
-        std::int64_t new_value = 0;
+    auto codegen::resolve_ready_fixups (
+        codegen_state& state,
+        std::vector<std::size_t>& fixup_chunks
+    ) -> g10::result<void>
+    {
+        const std::uint32_t location_counter = state.location_counter;
+        const std::size_t section_index = state.current_section_index;
+        const bool in_rom_region = state.in_rom_region;
 
-        // - Apply the assignment operator.
-        switch (assign_stmt.assignment_operator)
+        std::size_t kept = 0;
+        g10::result<void> result {};
+        for (std::size_t i = 0; i < state.fixups.size(); ++i)
         {
-            case token_type::assign_equal:
-                new_value = rhs_int;
-                break;
-            case token_type::assign_plus:
-                new_value = current_int + rhs_int;
-                break;
-            case token_type::assign_minus:
-                new_value = current_int - rhs_int;
-                break;
-            case token_type::assign_times:
-                new_value = current_int * rhs_int;
-                break;
-            case token_type::assign_divide:
-                if (rhs_int == 0)
-                {
-                    return g10::error(
-                        " - Division by zero in assignment to '${}'\n"
-                        " - In file '{}:{}'",
-                        var_name,
-                        assign_stmt.source_file,
-                        assign_stmt.source_line
-                    );
-                }
-                new_value = current_int / rhs_int;
-                break;
-            case token_type::assign_modulo:
-                if (rhs_int == 0)
-                {
-                    return g10::error(
-                        " - Modulo by zero in assignment to '${}'\n"
-                        " - In file '{}:{}'",
-                        var_name,
-                        assign_stmt.source_file,
-                        assign_stmt.source_line
-                    );
-                }
-                new_value = current_int % rhs_int;
-                break;
-            case token_type::assign_and:
-                new_value = current_int & rhs_int;
-                break;
-            case token_type::assign_or:
-                new_value = current_int | rhs_int;
-                break;
-            case token_type::assign_xor:
-                new_value = current_int ^ rhs_int;
-                break;
-            case token_type::assign_shift_left:
-                new_value = current_int << rhs_int;
-                break;
-            case token_type::assign_shift_right:
-                new_value = current_int >> rhs_int;
-                break;
-            case token_type::assign_exponent:
+            const codegen_fixup fixup = state.fixups[i];
+            if (statement_references_unresolved(state, *fixup.node) == true)
             {
-                // - Compute exponentiation.
-                new_value = 1;
-                for (std::int64_t i = 0; i < rhs_int; ++i)
-                {
-                    new_value *= current_int;
-                }
+                state.fixups[kept] = fixup;
+                fixup_chunks[kept] = fixup_chunks[i];
+                ++kept;
+                continue;
+            }
+
+            auto fixup_result = resolve_fixup(state, fixup);
+            if (!fixup_result.has_value())
+            {
+                result = g10::error(fixup_result.error());
                 break;
             }
-            default:
-                return g10::error(
-                    " - Unknown assignment operator in assignment to '${}'\n"
+            else if (fixup_result.value() == false)
+            {
+                result = g10::error(
+                    " - This statement's size changed once the labels it references were defined.\n"
                     " - In file '{}:{}'",
-                    var_name,
-                    assign_stmt.source_file,
-                    assign_stmt.source_line
+                    fixup.node->source_file,
+                    fixup.node->source_line
                 );
+                break;
+            }
         }
 
-        // - Update the variable in the environment.
-        auto set_result = environment::set_value(var_name, value{new_value});
-        if (!set_result.has_value())
+        // - Pick up where the single pass left off.
+        if (result.has_value() == true)
         {
-            return g10::error(set_result.error());
+            state.fixups.resize(kept);
+            fixup_chunks.resize(kept);
         }
 
-        return {};
+        state.location_counter = location_counter;
+        state.current_section_index = section_index;
+        state.in_rom_region = in_rom_region;
+        return result;
     }
 }
 
@@ -419,6 +1616,12 @@ namespace g10asm
             return result;
         }
 
+        state.section_runs.push_back({
+            .first_node = 0,
+            .section_index = state.current_section_index,
+            .address = state.location_counter
+        });
+
         // - Process each node in the module.
         for (auto& child : module.children)
         {
@@ -534,8 +1737,24 @@ namespace g10asm
                     // Ignore other node types (expressions, operands, etc.)
                     break;
             }
+
+            // - A directive which moves the location counter starts a new
+            //   run, in whichever section it selected.
+            if (child->type == ast_node_type::dir_org ||
+                child->type == ast_node_type::dir_rom ||
+                child->type == ast_node_type::dir_ram ||
+                child->type == ast_node_type::dir_int)
+            {
+                state.section_runs.push_back({
+                    .first_node = static_cast<std::size_t>(
+                        &child - module.children.data()),
+                    .section_index = state.current_section_index,
+                    .address = state.location_counter
+                });
+            }
         }
 
+        note_section_extent(state);
         return {};
     }
 
@@ -548,7 +1767,7 @@ namespace g10asm
         const std::string label_name { label.label_name };
 
         // - Check if label already exists.
-        if (state.label_map.contains(label_name))
+        if (state.label_map.contains(label.symbol))
         {
             return g10::error("Label '{}' redefined ({}:{}:{})",
                 label_name,
@@ -558,10 +1777,10 @@ namespace g10asm
         }
 
         // - Store label location (section index and address).
-        state.label_map[label_name] = {
+        state.label_map.insert(label.symbol, {
             state.current_section_index,
             state.location_counter
-        };
+        });
 
         // - Create a symbol for this label.
         // - Check if the label was declared global before definition.
@@ -571,12 +1790,13 @@ namespace g10asm
         symbol.section_index = static_cast<std::uint32_t>(state.current_section_index);
         symbol.type = g10::symbol_type::label;
         // - If label was declared global before, use global binding.
-        symbol.binding = state.global_symbols.contains(label_name) ?
+        symbol.binding = state.global_symbols.contains(label.symbol) ?
             g10::symbol_binding::global : g10::symbol_binding::local_;
         symbol.flags = g10::symbol_flags::none;
 
         // - Add the symbol to the object file.
-        if (auto result = state.object.add_symbol(symbol); !result.has_value())
+        auto result = state.object.add_symbol(symbol);
+        if (!result.has_value())
         {
             return g10::error("Failed to add symbol '{}': {} ({}:{}:{})",
                 label_name,
@@ -586,6 +1806,7 @@ namespace g10asm
                 label.source_column);
         }
 
+        state.label_symbols.insert(label.symbol, result.value());
         return {};
     }
 
@@ -660,6 +1881,10 @@ namespace g10asm
                 org.source_column);
         }
 
+        // - Record how far the location counter reached within the section
+        //   being left, before the counter moves away from it.
+        note_section_extent(state);
+
         // - Save current location counter to appropriate region counter.
         if (state.in_rom_region)
         {
@@ -685,7 +1910,17 @@ namespace g10asm
         }
 
         // Create or switch to section at this address.
-        return ensure_section(state, new_address);
+        if (auto result = ensure_section(state, new_address);
+            !result.has_value())
+        {
+            return g10::error(".org directive: {} ({}:{}:{})",
+                result.error(),
+                org.source_file,
+                org.source_line,
+                org.source_column);
+        }
+
+        return {};
     }
 
     auto codegen::first_pass_rom (
@@ -693,8 +1928,17 @@ namespace g10asm
         ast_dir_rom& rom
     ) -> g10::result<void>
     {
-        // - If not in the ROM region, save the current RAM location counter.
-        if (!state.in_rom_region)
+        // - Record how far the location counter reached within the section
+        //   being left, before the counter moves away from it.
+        note_section_extent(state);
+
+        // - Save the current location counter to its region's counter, so
+        //   that `.rom` within the ROM region stays where it is.
+        if (state.in_rom_region)
+        {
+            state.rom_location_counter = state.location_counter;
+        }
+        else
         {
             state.ram_location_counter = state.location_counter;
         }
@@ -712,11 +1956,20 @@ namespace g10asm
         ast_dir_ram& ram
     ) -> g10::result<void>
     {
-        // - If in the ROM region, save the current ROM location counter.
+        // - Record how far the location counter reached within the section
+        //   being left, before the counter moves away from it.
+        note_section_extent(state);
+
+        // - Save the current location counter to its region's counter, so
+        //   that `.ram` within the RAM region stays where it is.
         if (state.in_rom_region)
         {
             state.rom_location_counter = state.location_counter;
         }
+        else
+        {
+            state.ram_location_counter = state.location_counter;
+        }
 
         // - Switch to RAM region.
         state.in_rom_region = false;
@@ -795,13 +2048,27 @@ namespace g10asm
         std::uint32_t new_address = IVT_START + 
             (static_cast<std::uint32_t>(vector_num) * VECTOR_SIZE);
 
+        // - Record how far the location counter reached within the section
+        //   being left, before the counter moves away from it.
+        note_section_extent(state);
+
         // - Switch to ROM region and set location counter.
         state.in_rom_region = true;
         state.location_counter = new_address;
         state.rom_location_counter = new_address;
 
         // - Ensure section exists at the new location.
-        return ensure_section(state, new_address);
+        if (auto result = ensure_section(state, new_address);
+            !result.has_value())
+        {
+            return g10::error(".int directive: {} ({}:{}:{})",
+                result.error(),
+                int_.source_file,
+                int_.source_line,
+                int_.source_column);
+        }
+
+        return {};
     }
 
     auto codegen::first_pass_data (
@@ -809,44 +2076,78 @@ namespace g10asm
         ast_node& node
     ) -> g10::result<void>
     {
-        // - Determine data size based on directive type.
+        // - Determine the directive's values and element size.
+        std::string_view directive = "";
+        const std::vector<std::unique_ptr<ast_node>>* values = nullptr;
         std::size_t element_size = 0;
-        std::size_t element_count = 0;
 
         if (node.type == ast_node_type::dir_byte)
         {
+            directive = ".byte";
+            values = &static_cast<ast_dir_byte&>(node).values;
             element_size = 1;
-            auto& dir = static_cast<ast_dir_byte&>(node);
-            element_count = dir.values.size();
         }
         else if (node.type == ast_node_type::dir_word)
         {
+            directive = ".word";
+            values = &static_cast<ast_dir_word&>(node).values;
             element_size = 2;
-            auto& dir = static_cast<ast_dir_word&>(node);
-            element_count = dir.values.size();
         }
         else if (node.type == ast_node_type::dir_dword)
         {
+            directive = ".dword";
+            values = &static_cast<ast_dir_dword&>(node).values;
             element_size = 4;
-            auto& dir = static_cast<ast_dir_dword&>(node);
-            element_count = dir.values.size();
+        }
+        else
+        {
+            return {};
         }
 
         // In ROM region: emit data directly (size = element_size * element_count)
-        // In RAM region: reserve BSS space (size depends on evaluated expressions)
+        // In RAM region: reserve BSS space, sized exactly as the second pass
+        // sizes it, so that labels after it land at the same addresses.
         if (state.in_rom_region)
         {
-            // ROM: Each value contributes element_size bytes.
-            state.location_counter += static_cast<std::uint32_t>(
-                element_size * element_count);
+            // ROM: Each value contributes element_size bytes, except for a
+            // string literal in a `.byte` directive, which contributes one
+            // byte per character.
+            for (const auto& value_node : *values)
+            {
+                if (!value_node)
+                {
+                    continue;
+                }
+
+                if (node.type == ast_node_type::dir_byte &&
+                    value_node->type == ast_node_type::expr_primary)
+                {
+                    const auto& primary =
+                        static_cast<const ast_expr_primary&>(*value_node);
+                    if (primary.expr_type ==
+                            ast_expr_primary::primary_type::string_literal &&
+                        std::holds_alternative<std::string_view>(primary.value))
+                    {
+                        state.location_counter += static_cast<std::uint32_t>(
+                            std::get<std::string_view>(primary.value).size());
+                        continue;
+                    }
+                }
+
+                state.location_counter +=
+                    static_cast<std::uint32_t>(element_size);
+            }
         }
         else
         {
-            // RAM: Values are counts, need to sum them (simplified for now).
-            // In first pass, we'll assume each value = 1 for size calculation.
-            // Full expression evaluation happens in second pass.
-            state.location_counter += static_cast<std::uint32_t>(
-                element_size * element_count);
+            auto size_result = data_reservation_size(state, directive, node,
+                *values, element_size);
+            if (!size_result.has_value())
+            {
+                return g10::error(size_result.error());
+            }
+
+            state.location_counter += size_result.value();
         }
 
         return {};
@@ -858,12 +2159,13 @@ namespace g10asm
     ) -> g10::result<void>
     {
         // - Process each symbol declared as global.
-        for (const auto& symbol_name_view : global.symbols)
+        for (std::size_t i = 0; i < global.symbols.size(); ++i)
         {
-            const std::string symbol_name { symbol_name_view };
+            const std::string symbol_name { global.symbols[i] };
+            const symbol_id name_id = global.symbol_ids[i];
 
             // - Check for duplicate global declarations.
-            if (state.global_symbols.contains(symbol_name))
+            if (state.global_symbols.contains(name_id))
             {
                 return g10::error("Symbol '{}' already declared as global ({}:{}:{})",
                     symbol_name,
@@ -873,7 +2175,7 @@ namespace g10asm
             }
 
             // - Check if symbol is extern.
-            if (state.extern_symbols.contains(symbol_name))
+            if (state.extern_symbols.contains(name_id))
             {
                 return g10::error("Symbol '{}' cannot be both global and extern ({}:{}:{})",
                     symbol_name,
@@ -883,7 +2185,7 @@ namespace g10asm
             }
 
             // - Add to global symbols set.
-            state.global_symbols.insert(symbol_name);
+            state.global_symbols.insert(name_id);
 
             // - Find the symbol in the object and promote it to global.
             auto symbol_index = state.object.find_symbol(symbol_name);
@@ -907,18 +2209,19 @@ namespace g10asm
     ) -> g10::result<void>
     {
         // - Process each symbol declared as extern.
-        for (const auto& symbol_name_view : extern_.symbols)
+        for (std::size_t i = 0; i < extern_.symbols.size(); ++i)
         {
-            const std::string symbol_name { symbol_name_view };
+            const std::string symbol_name { extern_.symbols[i] };
+            const symbol_id name_id = extern_.symbol_ids[i];
 
             // - Check for duplicate extern declarations.
-            if (state.extern_symbols.contains(symbol_name))
+            if (state.extern_symbols.contains(name_id))
             {
                 continue; // Already declared extern, skip.
             }
 
             // - Check if symbol is global.
-            if (state.global_symbols.contains(symbol_name))
+            if (state.global_symbols.contains(name_id))
             {
                 return g10::error("Symbol '{}' cannot be both extern and global ({}:{}:{})",
                     symbol_name,
@@ -928,7 +2231,7 @@ namespace g10asm
             }
 
             // - Add to extern symbols set.
-            state.extern_symbols.insert(symbol_name);
+            state.extern_symbols.insert(name_id);
 
             // - Create an extern symbol entry.
             g10::object_symbol symbol;
@@ -969,7 +2272,37 @@ namespace g10asm
         state.current_section_index = 0;
         state.in_rom_region = true;
 
+        // Pre-size each section's buffer to the extent found by the first
+        // pass, so that emission does not reallocate. BSS sections are never
+        // emitted into.
+        const auto& sections = state.object.get_sections();
+        for (std::size_t i = 0; i < state.section_extents.size(); ++i)
+        {
+            if (sections[i].type == g10::section_type::bss)
+            {
+                continue;
+            }
+
+            if (auto data = state.object.get_section_data(i); data.has_value())
+            {
+                data.value().get().reserve(state.section_extents[i]);
+            }
+        }
+
+        // In a large module spanning several sections, emit the sections
+        // concurrently.
+        if (emits_concurrently(state, module) == true &&
+            std::ranges::any_of(state.section_runs,
+                [&state] (const codegen_section_run& run)
+                {
+                    return run.section_index != state.section_runs[0].section_index;
+                }))
+        {
+            return second_pass_parallel(state, module);
+        }
+
         // Process each node in the module.
+        std::size_t run_index = 0;
         for (auto& child : module.children)
         {
             if (!child || !child->valid)
@@ -977,11 +2310,17 @@ namespace g10asm
                 continue;
             }
 
+            // Note where the node starts, for the listing.
+            const std::uint32_t address = state.location_counter;
+            const std::uint32_t offset = current_section_offset(state);
+
             // Dispatch based on node type.
             switch (child->type)
             {
                 case ast_node_type::label_definition:
-                    // Labels were processed in first pass; skip.
+                    // Labels were processed in first pass; only note their
+                    // placement for the listing.
+                    record_listing_entry(state, *child, address, offset);
                     break;
 
                 case ast_node_type::instruction:
@@ -1081,6 +2420,220 @@ namespace g10asm
                     // Ignore other node types.
                     break;
             }
+
+            // A directive which moved the location counter started a new run;
+            // resume where the first pass placed it, which is the end of the
+            // section's contents if the directive returned to it.
+            if (child->type == ast_node_type::dir_org ||
+                child->type == ast_node_type::dir_rom ||
+                child->type == ast_node_type::dir_ram ||
+                child->type == ast_node_type::dir_int)
+            {
+                const auto& run = state.section_runs[++run_index];
+                state.current_section_index = run.section_index;
+                state.location_counter = run.address;
+            }
+
+            if (child->type == ast_node_type::instruction ||
+                child->type == ast_node_type::dir_byte ||
+                child->type == ast_node_type::dir_word ||
+                child->type == ast_node_type::dir_dword)
+            {
+                record_listing_entry(state, *child, address, offset);
+            }
+        }
+
+        return {};
+    }
+
+    auto codegen::second_pass_parallel (
+        codegen_state& state,
+        ast_module& module
+    ) -> g10::result<void>
+    {
+        // - Group the runs by section, keeping each section's runs in module
+        //   order. Each group is emitted by a single worker, in order.
+        std::map<std::size_t, std::vector<std::size_t>> section_runs;
+        for (std::size_t i = 0; i < state.section_runs.size(); ++i)
+        {
+            section_runs[state.section_runs[i].section_index].push_back(i);
+        }
+
+        std::vector<std::vector<std::size_t>> tasks;
+        tasks.reserve(section_runs.size());
+        for (auto& [_, runs] : section_runs)
+        {
+            tasks.push_back(std::move(runs));
+        }
+
+        // - Take every section's buffer out of the object, so that the
+        //   workers' copies of the state are made without them. Each worker
+        //   swaps in the buffer of the section it is emitting.
+        const std::size_t section_count = state.object.get_sections().size();
+        std::vector<std::vector<std::uint8_t>> buffers(section_count);
+        for (std::size_t i = 0; i < section_count; ++i)
+        {
+            std::swap(buffers[i], state.object.get_section_data(i).value().get());
+        }
+
+        // - Use at least two workers, even on a single hardware thread, so
+        //   that a lowered `parallel_min_nodes` always exercises them.
+        const std::size_t worker_count = std::min<std::size_t>(tasks.size(),
+            std::max(std::thread::hardware_concurrency(), 2u));
+        std::vector<codegen_state> workers(worker_count, state);
+        std::vector<emission_run_output> outputs(state.section_runs.size());
+        std::atomic<std::size_t> next_task { 0 };
+
+        auto work = [&] (std::size_t worker_index)
+        {
+            auto& worker = workers[worker_index];
+            for (std::size_t task = next_task.fetch_add(1);
+                task < tasks.size();
+                task = next_task.fetch_add(1))
+            {
+                const std::size_t section_index =
+                    state.section_runs[tasks[task][0]].section_index;
+                auto& data = worker.object.get_section_data(section_index)
+                    .value().get();
+                std::swap(data, buffers[section_index]);
+
+                for (const std::size_t run_index : tasks[task])
+                {
+                    auto& output = outputs[run_index];
+                    output.worker = worker_index;
+                    output.relocations_begin = worker.object.get_relocations().size();
+                    output.listing_begin = worker.listing_entries.size();
+                    output.result = second_pass_run(worker, module, run_index);
+                    output.relocations_end = worker.object.get_relocations().size();
+                    output.listing_end = worker.listing_entries.size();
+                    if (!output.result.has_value())
+                    {
+                        break;
+                    }
+                }
+
+                std::swap(data, buffers[section_index]);
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(worker_count - 1);
+            for (std::size_t i = 1; i < worker_count; ++i)
+            {
+                threads.emplace_back(work, i);
+            }
+
+            work(0);
+        }
+
+        // - Return the buffers to the object.
+        for (std::size_t i = 0; i < section_count; ++i)
+        {
+            std::swap(buffers[i], state.object.get_section_data(i).value().get());
+        }
+
+        // - Merge what each run recorded, in module order. The first run to
+        //   fail in module order is the one whose error a sequential pass
+        //   would have reported.
+        for (const auto& output : outputs)
+        {
+            if (!output.result.has_value())
+            {
+                return output.result;
+            }
+
+            const auto& worker = workers[output.worker];
+            const auto& relocations = worker.object.get_relocations();
+            for (std::size_t i = output.relocations_begin; i < output.relocations_end; ++i)
+            {
+                if (auto result = state.object.add_relocation(relocations[i]);
+                    !result.has_value())
+                {
+                    return g10::error("Failed to add relocation: {}", result.error());
+                }
+            }
+
+            state.listing_entries.insert(state.listing_entries.end(),
+                worker.listing_entries.begin() + output.listing_begin,
+                worker.listing_entries.begin() + output.listing_end);
+        }
+
+        for (const auto& worker : workers)
+        {
+            state.relaxation_changed |= worker.relaxation_changed;
+        }
+
+        return {};
+    }
+
+    auto codegen::second_pass_run (
+        codegen_state& state,
+        ast_module& module,
+        std::size_t run_index
+    ) -> g10::result<void>
+    {
+        const auto& run = state.section_runs[run_index];
+        const std::size_t end = (run_index + 1 < state.section_runs.size()) ?
+            state.section_runs[run_index + 1].first_node :
+            module.children.size();
+
+        // - Whichever directive started the run, the second pass resumes
+        //   where the first pass placed it.
+        state.current_section_index = run.section_index;
+        state.location_counter = run.address;
+        state.in_rom_region = (run.address & 0x80000000) == 0;
+
+        for (std::size_t i = run.first_node; i < end; ++i)
+        {
+            auto& child = module.children[i];
+            if (!child || !child->valid)
+            {
+                continue;
+            }
+
+            const std::uint32_t address = state.location_counter;
+            const std::uint32_t offset = current_section_offset(state);
+
+            g10::result<void> result {};
+            switch (child->type)
+            {
+                case ast_node_type::label_definition:
+                    record_listing_entry(state, *child, address, offset);
+                    continue;
+
+                case ast_node_type::instruction:
+                    result = second_pass_instruction(state,
+                        static_cast<ast_instruction&>(*child));
+                    break;
+
+                case ast_node_type::dir_byte:
+                    result = second_pass_byte(state,
+                        static_cast<ast_dir_byte&>(*child));
+                    break;
+
+                case ast_node_type::dir_word:
+                    result = second_pass_word(state,
+                        static_cast<ast_dir_word&>(*child));
+                    break;
+
+                case ast_node_type::dir_dword:
+                    result = second_pass_dword(state,
+                        static_cast<ast_dir_dword&>(*child));
+                    break;
+
+                default:
+                    // - Directives were accounted for when the runs were
+                    //   found; other node types are ignored.
+                    continue;
+            }
+
+            if (!result.has_value())
+            {
+                return result;
+            }
+
+            record_listing_entry(state, *child, address, offset);
         }
 
         return {};
@@ -1147,9 +2700,28 @@ namespace g10asm
                 org.source_column);
         }
 
+        // - Save and update the region counters exactly as the first pass
+        //   did, so that a later `.rom` or `.ram` resumes where it did there.
+        if (state.in_rom_region)
+        {
+            state.rom_location_counter = state.location_counter;
+        }
+        else
+        {
+            state.ram_location_counter = state.location_counter;
+        }
+
         // Update location counter and region flag.
         state.location_counter = new_address;
         state.in_rom_region = (new_address & 0x80000000) == 0;
+        if (state.in_rom_region)
+        {
+            state.rom_location_counter = new_address;
+        }
+        else
+        {
+            state.ram_location_counter = new_address;
+        }
 
         // Find the section that contains this address.
         const auto& sections = state.object.get_sections();
@@ -1176,8 +2748,13 @@ namespace g10asm
         ast_dir_rom& rom
     ) -> g10::result<void>
     {
-        // - If not in the ROM region, save the current RAM location counter.
-        if (!state.in_rom_region)
+        // - Save the current location counter to its region's counter, so
+        //   that `.rom` within the ROM region stays where it is.
+        if (state.in_rom_region)
+        {
+            state.rom_location_counter = state.location_counter;
+        }
+        else
         {
             state.ram_location_counter = state.location_counter;
         }
@@ -1211,11 +2788,16 @@ namespace g10asm
         ast_dir_ram& ram
     ) -> g10::result<void>
     {
-        // - If in the ROM region, save the current ROM location counter.
+        // - Save the current location counter to its region's counter, so
+        //   that `.ram` within the RAM region stays where it is.
         if (state.in_rom_region)
         {
             state.rom_location_counter = state.location_counter;
         }
+        else
+        {
+            state.ram_location_counter = state.location_counter;
+        }
 
         // - Switch to RAM region.
         state.in_rom_region = false;
@@ -1360,10 +2942,10 @@ namespace g10asm
                         {
                             std::string_view str = 
                                 std::get<std::string_view>(primary.value);
-                            for (char c : str)
-                            {
-                                emit_byte(state, static_cast<std::uint8_t>(c));
-                            }
+                            emit_bytes(state, {
+                                reinterpret_cast<const std::uint8_t*>(str.data()),
+                                str.size()
+                            });
                             continue;
                         }
                     }
@@ -1397,41 +2979,14 @@ namespace g10asm
         else
         {
             // RAM region (BSS): reserve space, don't emit values.
-            // Sum all values to get count.
-            std::size_t total_count = 0;
-            for (const auto& value_node : dir.values)
+            auto size_result = data_reservation_size(state, ".byte", dir,
+                dir.values, 1);
+            if (!size_result.has_value())
             {
-                if (!value_node)
-                {
-                    total_count += 1;
-                    continue;
-                }
-
-                auto result = evaluate_expression(
-                    state, static_cast<const ast_expression&>(*value_node));
-                if (!result.has_value())
-                {
-                    return g10::error(".byte: {} ({}:{}:{})",
-                        result.error(),
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
-
-                auto int_result = value_to_integer(result.value());
-                if (!int_result.has_value() || int_result.value() < 0)
-                {
-                    return g10::error(".byte count must be positive ({}:{}:{})",
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
-
-                total_count += static_cast<std::size_t>(int_result.value());
+                return g10::error(size_result.error());
             }
 
-            // Advance location counter without emitting data.
-            state.location_counter += static_cast<std::uint32_t>(total_count);
+            state.location_counter += size_result.value();
         }
 
         return {};
@@ -1514,41 +3069,15 @@ namespace g10asm
         }
         else
         {
-            // RAM region (BSS): reserve space.
-            std::size_t total_count = 0;
-            for (const auto& value_node : dir.values)
+            // RAM region (BSS): reserve space, don't emit values.
+            auto size_result = data_reservation_size(state, ".word", dir,
+                dir.values, 2);
+            if (!size_result.has_value())
             {
-                if (!value_node)
-                {
-                    total_count += 1;
-                    continue;
-                }
-
-                auto result = evaluate_expression(
-                    state, static_cast<const ast_expression&>(*value_node));
-                if (!result.has_value())
-                {
-                    return g10::error(".word: {} ({}:{}:{})",
-                        result.error(),
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
-
-                auto int_result = value_to_integer(result.value());
-                if (!int_result.has_value() || int_result.value() < 0)
-                {
-                    return g10::error(".word count must be positive ({}:{}:{})",
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
-
-                total_count += static_cast<std::size_t>(int_result.value());
+                return g10::error(size_result.error());
             }
 
-            // Advance location counter (2 bytes per word).
-            state.location_counter += static_cast<std::uint32_t>(total_count * 2);
+            state.location_counter += size_result.value();
         }
 
         return {};
@@ -1626,49 +3155,76 @@ namespace g10asm
 
                     emit_dword(state, static_cast<std::uint32_t>(
                         int_result.value() & 0xFFFFFFFF));
+
+                    if (auto reloc_result = create_label_relocation(state, expr,
+                        g10::relocation_type::abs32); !reloc_result.has_value())
+                    {
+                        return reloc_result;
+                    }
                 }
             }
         }
         else
         {
-            // RAM region (BSS): reserve space.
-            std::size_t total_count = 0;
-            for (const auto& value_node : dir.values)
+            // RAM region (BSS): reserve space, don't emit values.
+            auto size_result = data_reservation_size(state, ".dword", dir,
+                dir.values, 4);
+            if (!size_result.has_value())
             {
-                if (!value_node)
-                {
-                    total_count += 1;
-                    continue;
-                }
+                return g10::error(size_result.error());
+            }
 
-                auto result = evaluate_expression(
-                    state, static_cast<const ast_expression&>(*value_node));
-                if (!result.has_value())
-                {
-                    return g10::error(".dword: {} ({}:{}:{})",
-                        result.error(),
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
+            state.location_counter += size_result.value();
+        }
 
-                auto int_result = value_to_integer(result.value());
-                if (!int_result.has_value() || int_result.value() < 0)
-                {
-                    return g10::error(".dword count must be positive ({}:{}:{})",
-                        dir.source_file,
-                        dir.source_line,
-                        dir.source_column);
-                }
+        return {};
+    }
+
+    auto codegen::data_reservation_size (
+        codegen_state& state,
+        std::string_view directive,
+        const ast_node& dir,
+        const std::vector<std::unique_ptr<ast_node>>& values,
+        std::size_t element_size
+    ) -> g10::result<std::uint32_t>
+    {
+        // - Each value is a count of elements to reserve. A missing value
+        //   reserves a single element.
+        std::size_t total_count = 0;
+        for (const auto& value_node : values)
+        {
+            if (!value_node)
+            {
+                total_count += 1;
+                continue;
+            }
+
+            auto result = evaluate_expression(
+                state, static_cast<const ast_expression&>(*value_node));
+            if (!result.has_value())
+            {
+                return g10::error("{}: {} ({}:{}:{})",
+                    directive,
+                    result.error(),
+                    dir.source_file,
+                    dir.source_line,
+                    dir.source_column);
+            }
 
-                total_count += static_cast<std::size_t>(int_result.value());
+            auto int_result = value_to_integer(result.value());
+            if (!int_result.has_value() || int_result.value() < 0)
+            {
+                return g10::error("{} count must be positive ({}:{}:{})",
+                    directive,
+                    dir.source_file,
+                    dir.source_line,
+                    dir.source_column);
             }
 
-            // Advance location counter (4 bytes per dword).
-            state.location_counter += static_cast<std::uint32_t>(total_count * 4);
+            total_count += static_cast<std::size_t>(int_result.value());
         }
 
-        return {};
+        return static_cast<std::uint32_t>(total_count * element_size);
     }
 }
 
@@ -1693,7 +3249,13 @@ namespace g10asm
             return g10::error(result.error());
         }
 
-        // Step 4: Run the object's internal validation.
+        // Step 4: Put the relocations in a canonical order. The single pass
+        //         appends a forward reference's relocation when its label is
+        //         resolved, while concurrent emission records it in place;
+        //         sorting makes both produce the same object file.
+        state.object.sort_relocations();
+
+        // Step 5: Run the object's internal validation.
         // The object class has its own validate() method that checks for:
         // - Section overlaps
         // - Valid symbol references
@@ -1742,8 +3304,10 @@ namespace g10asm
         std::vector<std::string> undefined_globals;
 
         // Check each global symbol to ensure it's defined.
-        for (const auto& global_name : state.global_symbols)
+        for (const auto& [global_symbol, _] : state.global_symbols)
         {
+            const std::string global_name { symbol_table::name_of(global_symbol) };
+
             // Look up the symbol in the object.
             auto sym_idx = state.object.find_symbol(global_name);
             if (!sym_idx.has_value())
@@ -1816,14 +3380,17 @@ namespace g10asm
             {
                 case g10::relocation_type::abs8:
                 case g10::relocation_type::rel8:
+                case g10::relocation_type::port8:
                     reloc_size = 1;
                     break;
                 case g10::relocation_type::abs16:
                 case g10::relocation_type::rel16:
+                case g10::relocation_type::quick16:
                     reloc_size = 2;
                     break;
                 case g10::relocation_type::abs32:
                 case g10::relocation_type::rel32:
+                case g10::relocation_type::jump32:
                     reloc_size = 4;
                     break;
                 default:
@@ -1848,15 +3415,64 @@ namespace g10asm
             // (though this might be valid for position-independent code).
         }
 
-        return {};
+        return {};
+    }
+}
+
+/* Private Methods - Expression Evaluation ************************************/
+
+namespace g10asm
+{
+    auto codegen::evaluate_expression (
+        codegen_state& state,
+        const ast_expression& expr
+    ) -> g10::result<value>
+    {
+        // Reuse the cached result, if this expression has been evaluated
+        // before.
+        if (state.cache_expressions &&
+            expr.cached_epoch == state.cache_epoch &&
+            !std::holds_alternative<std::monostate>(expr.cached_value))
+        {
+            return std::visit([] (const auto& cached) -> value
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(cached)>,
+                    std::monostate>)
+                {
+                    return std::monostate {};
+                }
+                else
+                {
+                    return cached;
+                }
+            }, expr.cached_value);
+        }
+
+        auto result = evaluate_uncached(state, expr);
+
+        // Cache numeric results, unless a forward reference stood in for an
+        // undefined label during this evaluation.
+        if (state.cache_expressions && !state.speculative && result.has_value())
+        {
+            std::visit([&] (const auto& val)
+            {
+                using value_type = std::decay_t<decltype(val)>;
+                if constexpr (
+                    std::is_same_v<value_type, std::int64_t> ||
+                    std::is_same_v<value_type, std::uint64_t> ||
+                    std::is_same_v<value_type, std::uint32_t>
+                )
+                {
+                    expr.cached_value = val;
+                    expr.cached_epoch = state.cache_epoch;
+                }
+            }, result.value());
+        }
+
+        return result;
     }
-}
 
-/* Private Methods - Expression Evaluation ************************************/
-
-namespace g10asm
-{
-    auto codegen::evaluate_expression (
+    auto codegen::evaluate_uncached (
         codegen_state& state,
         const ast_expression& expr
     ) -> g10::result<value>
@@ -1967,35 +3583,32 @@ namespace g10asm
 
             case ast_expr_primary::primary_type::identifier:
             {
-                // Identifier: look up as a label.
-                std::string name;
-                if (std::holds_alternative<std::string_view>(expr.value))
-                {
-                    name = std::string { std::get<std::string_view>(expr.value) };
-                }
-                else
-                {
-                    name = std::string { expr.lexeme };
-                }
-
-                // Check if it's a known label.
-                if (auto it = state.label_map.find(name);
-                    it != state.label_map.end())
+                // Identifier: look up its interned name as a label.
+                if (const auto* label = state.label_map.find(expr.symbol);
+                    label != nullptr)
                 {
                     // Return as address (uint32_t).
-                    return it->second.second;
+                    return label->second;
                 }
 
                 // Check if it's an extern symbol.
-                if (state.extern_symbols.contains(name))
+                if (state.extern_symbols.contains(expr.symbol))
                 {
                     // Extern symbols have unknown addresses at assembly time.
                     // Return 0 as placeholder; relocation will fix it.
                     return static_cast<std::uint32_t>(0);
                 }
 
+                // While reserving space for a statement with forward
+                // references, stand in the current location for the label;
+                // the statement is re-emitted once the label is defined.
+                if (state.speculative)
+                {
+                    return state.location_counter;
+                }
+
                 return g10::error("Undefined symbol '{}' at {}:{}:{}",
-                    name,
+                    symbol_table::name_of(expr.symbol),
                     expr.source_file,
                     expr.source_line,
                     expr.source_column);
@@ -2003,29 +3616,12 @@ namespace g10asm
 
             case ast_expr_primary::primary_type::variable:
             {
-                // Variable: look up in the environment.
-                std::string var_name;
-                if (std::holds_alternative<std::string_view>(expr.value))
-                {
-                    var_name = std::string { std::get<std::string_view>(expr.value) };
-                }
-                else
-                {
-                    var_name = std::string { expr.lexeme };
-                }
-
-                // Remove the '$' prefix if present.
-                if (!var_name.empty() && var_name[0] == '$')
-                {
-                    var_name = var_name.substr(1);
-                }
-
-                // Look up in the environment.
-                auto value_result = environment::get_value(var_name);
+                // Variable: look up its interned name in the environment.
+                auto value_result = environment::get_value(expr.symbol);
                 if (!value_result.has_value())
                 {
                     return g10::error("Undefined variable '${}' at {}:{}:{}",
-                        var_name,
+                        symbol_table::name_of(expr.symbol),
                         expr.source_file,
                         expr.source_line,
                         expr.source_column);
@@ -2418,16 +4014,7 @@ namespace g10asm
                 const auto& primary = static_cast<const ast_expr_primary&>(expr);
                 if (primary.expr_type == ast_expr_primary::primary_type::identifier)
                 {
-                    std::string name;
-                    if (std::holds_alternative<std::string_view>(primary.value))
-                    {
-                        name = std::string { std::get<std::string_view>(primary.value) };
-                    }
-                    else
-                    {
-                        name = std::string { primary.lexeme };
-                    }
-                    return state.extern_symbols.contains(name);
+                    return state.extern_symbols.contains(primary.symbol);
                 }
                 return false;
             }
@@ -2459,91 +4046,411 @@ namespace g10asm
                 return false;
         }
     }
+
+    auto codegen::references_label (
+        const codegen_state& state,
+        const ast_expression& expr
+    ) -> bool
+    {
+        switch (expr.type)
+        {
+            case ast_node_type::expr_primary:
+            {
+                const auto& primary = static_cast<const ast_expr_primary&>(expr);
+                return primary.expr_type == ast_expr_primary::primary_type::identifier &&
+                    state.label_map.contains(primary.symbol);
+            }
+
+            case ast_node_type::expr_binary:
+            {
+                const auto& binary = static_cast<const ast_expr_binary&>(expr);
+                return (binary.left_operand &&
+                        references_label(state, *binary.left_operand)) ||
+                    (binary.right_operand &&
+                        references_label(state, *binary.right_operand));
+            }
+
+            case ast_node_type::expr_unary:
+            {
+                const auto& unary = static_cast<const ast_expr_unary&>(expr);
+                return unary.operand && references_label(state, *unary.operand);
+            }
+
+            case ast_node_type::expr_grouping:
+            {
+                const auto& grouping = static_cast<const ast_expr_grouping&>(expr);
+                return grouping.inner_expression &&
+                    references_label(state, *grouping.inner_expression);
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    auto codegen::split_label_offset (
+        codegen_state& state,
+        const ast_expression& expr
+    ) -> std::optional<std::pair<symbol_id, std::int64_t>>
+    {
+        // - Evaluates an operand which must be a plain constant.
+        auto constant = [&state] (const ast_expression& operand)
+            -> std::optional<std::int64_t>
+        {
+            if (references_label(state, operand) == true ||
+                references_external(state, operand) == true)
+            {
+                return std::nullopt;
+            }
+
+            auto result = evaluate_expression(state, operand);
+            if (!result.has_value() ||
+                std::holds_alternative<std::int64_t>(result.value()) == false)
+            {
+                return std::nullopt;
+            }
+
+            return std::get<std::int64_t>(result.value());
+        };
+
+        switch (expr.type)
+        {
+            case ast_node_type::expr_primary:
+            {
+                const auto& primary = static_cast<const ast_expr_primary&>(expr);
+                if (primary.expr_type == ast_expr_primary::primary_type::identifier &&
+                    state.label_map.contains(primary.symbol) == true)
+                {
+                    return std::pair { primary.symbol, std::int64_t { 0 } };
+                }
+                return std::nullopt;
+            }
+
+            case ast_node_type::expr_grouping:
+            {
+                const auto& grouping = static_cast<const ast_expr_grouping&>(expr);
+                if (!grouping.inner_expression)
+                {
+                    return std::nullopt;
+                }
+                return split_label_offset(state, *grouping.inner_expression);
+            }
+
+            case ast_node_type::expr_binary:
+            {
+                const auto& binary = static_cast<const ast_expr_binary&>(expr);
+                if (!binary.left_operand || !binary.right_operand)
+                {
+                    return std::nullopt;
+                }
+
+                if (binary.operator_type == token_type::plus ||
+                    binary.operator_type == token_type::minus)
+                {
+                    const bool subtract = (binary.operator_type == token_type::minus);
+
+                    // - `label + N` or `label - N`.
+                    if (auto left = split_label_offset(state, *binary.left_operand);
+                        left.has_value())
+                    {
+                        if (auto right = constant(*binary.right_operand);
+                            right.has_value())
+                        {
+                            left->second += subtract ? -right.value() : right.value();
+                            return left;
+                        }
+                        return std::nullopt;
+                    }
+
+                    // - `N + label`.
+                    if (subtract == false)
+                    {
+                        if (auto right = split_label_offset(state, *binary.right_operand);
+                            right.has_value())
+                        {
+                            if (auto left = constant(*binary.left_operand);
+                                left.has_value())
+                            {
+                                right->second += left.value();
+                                return right;
+                            }
+                        }
+                    }
+                }
+                return std::nullopt;
+            }
+
+            default:
+                return std::nullopt;
+        }
+    }
 }
 
 /* Private Methods - Code Emission ********************************************/
 
 namespace g10asm
 {
+    auto codegen::reserve_bytes (codegen_state& state, std::size_t count)
+        -> std::span<std::uint8_t>
+    {
+        // Advance the location counter.
+        state.location_counter += static_cast<std::uint32_t>(count);
+
+        // Get the current section's data buffer.
+        auto data_result = state.object.get_section_data(
+            state.current_section_index);
+        if (!data_result.has_value())
+        {
+            return {};
+        }
+
+        auto& data = data_result.value().get();
+
+        // While resolving a fixup, overwrite the space it reserved.
+        if (state.patching && state.patch_cursor + count <= data.size())
+        {
+            std::span<std::uint8_t> bytes { data.data() + state.patch_cursor, count };
+            state.patch_cursor += static_cast<std::uint32_t>(count);
+            return bytes;
+        }
+
+        // Otherwise, grow the buffer at its end. Buffers are pre-sized where
+        // the section's size is known in advance, so this rarely reallocates.
+        const std::size_t offset = data.size();
+        data.resize(offset + count);
+        return { data.data() + offset, count };
+    }
+
     auto codegen::emit_byte (codegen_state& state, std::uint8_t byte) -> void
     {
-        // Get the current section's data vector.
-        auto& sections = const_cast<std::vector<g10::object_section>&>(
-            state.object.get_sections());
-        
+        if (auto bytes = reserve_bytes(state, 1); !bytes.empty())
+        {
+            bytes[0] = byte;
+        }
+    }
+
+    auto codegen::emit_word (codegen_state& state, std::uint16_t word) -> void
+    {
+        if (auto bytes = reserve_bytes(state, 2); !bytes.empty())
+        {
+            g10::write_u16_le(bytes, 0, word);
+        }
+    }
+
+    auto codegen::emit_dword (codegen_state& state, std::uint32_t dword) -> void
+    {
+        if (auto bytes = reserve_bytes(state, 4); !bytes.empty())
+        {
+            g10::write_u32_le(bytes, 0, dword);
+        }
+    }
+
+    auto codegen::emit_bytes (
+        codegen_state& state,
+        std::span<const std::uint8_t> data
+    ) -> void
+    {
+        if (auto bytes = reserve_bytes(state, data.size()); !bytes.empty())
+        {
+            std::memcpy(bytes.data(), data.data(), data.size());
+        }
+    }
+
+    auto codegen::current_section_offset (const codegen_state& state)
+        -> std::uint32_t
+    {
+        if (state.patching)
+        {
+            return state.patch_cursor;
+        }
+
+        const auto& sections = state.object.get_sections();
         if (state.current_section_index < sections.size())
         {
-            auto& section = sections[state.current_section_index];
-            section.data.push_back(byte);
+            const auto& section = sections[state.current_section_index];
+            return static_cast<std::uint32_t>(section.data.size());
+        }
+        return 0;
+    }
+
+    auto codegen::record_listing_entry (
+        codegen_state& state,
+        const ast_node& node,
+        std::uint32_t address,
+        std::uint32_t section_offset
+    ) -> void
+    {
+        if (state.listing == false)
+        {
+            return;
+        }
+
+        state.listing_entries.push_back({
+            .node = &node,
+            .section_index = state.current_section_index,
+            .section_offset = section_offset,
+            .address = address,
+            .size = state.location_counter - address
+        });
+    }
+
+    auto codegen::create_relocation (
+        codegen_state& state,
+        const std::string& symbol_name,
+        g10::relocation_type type,
+        std::int16_t addend
+    ) -> g10::result<void>
+    {
+        // Speculative emission only reserves space; the relocation will be
+        // created when the statement is re-emitted.
+        if (state.speculative)
+        {
+            return {};
+        }
+
+        // Find the symbol index.
+        auto symbol_index = state.object.find_symbol(symbol_name);
+        if (!symbol_index.has_value())
+        {
+            return g10::error("Cannot create relocation: symbol '{}' not found",
+                symbol_name);
+        }
+
+        // Create the relocation entry.
+        g10::object_relocation reloc;
+        reloc.offset = current_section_offset(state);
+        reloc.symbol_index = static_cast<std::uint32_t>(symbol_index.value());
+        reloc.section_index = static_cast<std::uint32_t>(state.current_section_index);
+        reloc.type = type;
+        reloc.addend = static_cast<std::int32_t>(addend);
+
+        // Add to the object file.
+        auto result = state.object.add_relocation(reloc);
+        if (!result.has_value())
+        {
+            return g10::error("Failed to add relocation: {}", result.error());
+        }
+
+        return {};
+    }
+
+    auto codegen::create_address_relocation (
+        codegen_state& state,
+        const ast_instruction& instr,
+        const ast_expression& address,
+        g10::relocation_type type
+    ) -> g10::result<bool>
+    {
+        if (references_external(state, address) == false)
+        {
+            return false;
+        }
+        else if (address.type != ast_node_type::expr_primary)
+        {
+            return g10::error("Address must be a bare external symbol at {}:{}:{}",
+                instr.source_file,
+                instr.source_line,
+                instr.source_column);
+        }
+
+        // - Emit the placeholder first, so the relocation's offset lies
+        //   within the section.
+        std::uint32_t size = 0;
+        switch (type)
+        {
+            case g10::relocation_type::quick16:
+                size = 2;
+                emit_word(state, 0x0000);
+                break;
+            case g10::relocation_type::port8:
+                size = 1;
+                emit_byte(state, 0x00);
+                break;
+            default:
+                size = 4;
+                emit_dword(state, 0x00000000);
+                break;
+        }
+
+        if (state.speculative)
+        {
+            return true;
+        }
+
+        const auto& primary = static_cast<const ast_expr_primary&>(address);
+        const std::string symbol_name =
+            std::holds_alternative<std::string_view>(primary.value) ?
+            std::string { std::get<std::string_view>(primary.value) } :
+            std::string { primary.lexeme };
+        auto symbol_index = state.object.find_symbol(symbol_name);
+        if (!symbol_index.has_value())
+        {
+            return g10::error("Cannot create relocation: symbol '{}' not found",
+                symbol_name);
+        }
+
+        g10::object_relocation reloc;
+        reloc.offset = current_section_offset(state) - size;
+        reloc.symbol_index = static_cast<std::uint32_t>(symbol_index.value());
+        reloc.section_index = static_cast<std::uint32_t>(state.current_section_index);
+        reloc.type = type;
+        reloc.addend = 0;
+
+        auto result = state.object.add_relocation(reloc);
+        if (!result.has_value())
+        {
+            return g10::error("Failed to add relocation: {}", result.error());
         }
 
-        // Advance the location counter.
-        state.location_counter += 1;
-    }
-
-    auto codegen::emit_word (codegen_state& state, std::uint16_t word) -> void
-    {
-        // Emit in little-endian order.
-        emit_byte(state, static_cast<std::uint8_t>(word & 0xFF));
-        emit_byte(state, static_cast<std::uint8_t>((word >> 8) & 0xFF));
-    }
-
-    auto codegen::emit_dword (codegen_state& state, std::uint32_t dword) -> void
-    {
-        // Emit in little-endian order.
-        emit_byte(state, static_cast<std::uint8_t>(dword & 0xFF));
-        emit_byte(state, static_cast<std::uint8_t>((dword >> 8) & 0xFF));
-        emit_byte(state, static_cast<std::uint8_t>((dword >> 16) & 0xFF));
-        emit_byte(state, static_cast<std::uint8_t>((dword >> 24) & 0xFF));
+        return true;
     }
 
-    auto codegen::emit_bytes (
+    auto codegen::create_label_relocation (
         codegen_state& state,
-        std::span<const std::uint8_t> data
-    ) -> void
+        const ast_expression& address,
+        g10::relocation_type type
+    ) -> g10::result<void>
     {
-        for (const auto byte : data)
+        // - Only a label, plus or minus a constant, is relocated. Any other
+        //   expression, such as a constant or the difference of two labels,
+        //   is emitted as evaluated.
+        if (state.speculative)
         {
-            emit_byte(state, byte);
+            return {};
         }
-    }
 
-    auto codegen::current_section_offset (const codegen_state& state)
-        -> std::uint32_t
-    {
-        const auto& sections = state.object.get_sections();
-        if (state.current_section_index < sections.size())
+        const auto split = split_label_offset(state, address);
+        if (split.has_value() == false)
         {
-            const auto& section = sections[state.current_section_index];
-            return static_cast<std::uint32_t>(section.data.size());
+            return {};
         }
-        return 0;
-    }
 
-    auto codegen::create_relocation (
-        codegen_state& state,
-        const std::string& symbol_name,
-        g10::relocation_type type,
-        std::int16_t addend
-    ) -> g10::result<void>
-    {
-        // Find the symbol index.
-        auto symbol_index = state.object.find_symbol(symbol_name);
-        if (!symbol_index.has_value())
+        const auto [label, offset] = split.value();
+        const std::size_t* symbol_index = state.label_symbols.find(label);
+        if (symbol_index == nullptr)
         {
-            return g10::error("Cannot create relocation: symbol '{}' not found",
-                symbol_name);
+            return {};
+        }
+
+        // - The object file stores only the low 16 bits of an addend.
+        if (offset < -32768 || offset > 32767)
+        {
+            return g10::error("Offset {} from label '{}' is out of the "
+                "relocatable range -32768 to 32767 ({}:{}:{})",
+                offset,
+                symbol_table::name_of(label),
+                address.source_file,
+                address.source_line,
+                address.source_column);
         }
 
-        // Create the relocation entry.
         g10::object_relocation reloc;
-        reloc.offset = current_section_offset(state);
-        reloc.symbol_index = static_cast<std::uint32_t>(symbol_index.value());
+        reloc.offset = current_section_offset(state) - 4;
+        reloc.symbol_index = static_cast<std::uint32_t>(*symbol_index);
         reloc.section_index = static_cast<std::uint32_t>(state.current_section_index);
         reloc.type = type;
-        reloc.addend = static_cast<std::int32_t>(addend);
+        reloc.addend = static_cast<std::int32_t>(offset);
 
-        // Add to the object file.
         auto result = state.object.add_relocation(reloc);
         if (!result.has_value())
         {
@@ -2807,6 +4714,12 @@ namespace g10asm
                         emit_word(state, opcode);
                         emit_dword(state, static_cast<std::uint32_t>(
                             result.value() & 0xFFFFFFFF));
+
+                        if (auto reloc_result = create_label_relocation(state, *imm_node.value,
+                            g10::relocation_type::abs32); !reloc_result.has_value())
+                        {
+                            return reloc_result;
+                        }
                         break;
                 }
                 return {};
@@ -2826,9 +4739,30 @@ namespace g10asm
                 }
 
                 // Check for Quick (LDQ) or Port (LDP) addressing.
+                // - An address referencing an external symbol is left to the
+                //   linker.
                 if (instr.instruction == g10::instruction::ldq)
                 {
                     // LDQ: 16-bit relative to $FFFF0000
+                    switch (size_class)
+                    {
+                        case 0: opcode = 0x1300 | (dest_idx << 4); break;
+                        case 1: opcode = 0x2300 | (dest_idx << 4); break;
+                        case 2: opcode = 0x3300 | (dest_idx << 4); break;
+                    }
+                    emit_word(state, opcode);
+
+                    auto reloc_result = create_address_relocation(state, instr,
+                        *dir_node.address, g10::relocation_type::quick16);
+                    if (!reloc_result.has_value())
+                    {
+                        return g10::error("{}", reloc_result.error());
+                    }
+                    else if (reloc_result.value() == true)
+                    {
+                        return {};
+                    }
+
                     // Evaluate address.
                     auto result = evaluate_as_address(state, *dir_node.address);
                     if (!result.has_value())
@@ -2840,18 +4774,25 @@ namespace g10asm
                             instr.source_column);
                     }
                     std::uint32_t addr = result.value();
-                    switch (size_class)
-                    {
-                        case 0: opcode = 0x1300 | (dest_idx << 4); break;
-                        case 1: opcode = 0x2300 | (dest_idx << 4); break;
-                        case 2: opcode = 0x3300 | (dest_idx << 4); break;
-                    }
-                    emit_word(state, opcode);
                     emit_word(state, static_cast<std::uint16_t>(addr & 0xFFFF));
                 }
                 else if (instr.instruction == g10::instruction::ldp)
                 {
                     // LDP: 8-bit relative to $FFFFFF00 (byte only)
+                    opcode = 0x1500 | (dest_idx << 4);
+                    emit_word(state, opcode);
+
+                    auto reloc_result = create_address_relocation(state, instr,
+                        *dir_node.address, g10::relocation_type::port8);
+                    if (!reloc_result.has_value())
+                    {
+                        return g10::error("{}", reloc_result.error());
+                    }
+                    else if (reloc_result.value() == true)
+                    {
+                        return {};
+                    }
+
                     auto result = evaluate_as_address(state, *dir_node.address);
                     if (!result.has_value())
                     {
@@ -2862,8 +4803,6 @@ namespace g10asm
                             instr.source_column);
                     }
                     std::uint32_t addr = result.value();
-                    opcode = 0x1500 | (dest_idx << 4);
-                    emit_word(state, opcode);
                     emit_byte(state, static_cast<std::uint8_t>(addr & 0xFF));
                 }
                 else
@@ -2877,64 +4816,33 @@ namespace g10asm
                     }
                     emit_word(state, opcode);
 
-                    // Check if the address references an external symbol.
-                    bool needs_reloc = references_external(state, *dir_node.address);
-                    if (needs_reloc)
+                    auto reloc_result = create_address_relocation(state, instr,
+                        *dir_node.address, g10::relocation_type::abs32);
+                    if (!reloc_result.has_value())
                     {
-                        // Find the external symbol name.
-                        std::string symbol_name;
-                        if (dir_node.address->type == ast_node_type::expr_primary)
-                        {
-                            const auto& primary = 
-                                static_cast<const ast_expr_primary&>(*dir_node.address);
-                            if (std::holds_alternative<std::string_view>(primary.value))
-                            {
-                                symbol_name = std::string { 
-                                    std::get<std::string_view>(primary.value) };
-                            }
-                            else
-                            {
-                                symbol_name = std::string { primary.lexeme };
-                            }
-                        }
-
-                        // Emit placeholder FIRST (so offset is valid for relocation).
-                        emit_dword(state, 0x00000000);
-
-                        // Create relocation for 32-bit absolute address.
-                        auto symbol_index = state.object.find_symbol(symbol_name);
-                        if (!symbol_index.has_value())
-                        {
-                            return g10::error("Cannot create relocation: symbol '{}' not found",
-                                symbol_name);
-                        }
-
-                        g10::object_relocation reloc;
-                        reloc.offset = current_section_offset(state) - 4;
-                        reloc.symbol_index = static_cast<std::uint32_t>(symbol_index.value());
-                        reloc.section_index = static_cast<std::uint32_t>(state.current_section_index);
-                        reloc.type = g10::relocation_type::abs32;
-                        reloc.addend = 0;
+                        return g10::error("{}", reloc_result.error());
+                    }
+                    else if (reloc_result.value() == true)
+                    {
+                        return {};
+                    }
 
-                        auto result = state.object.add_relocation(reloc);
-                        if (!result.has_value())
-                        {
-                            return g10::error("Failed to add relocation: {}", result.error());
-                        }
+                    // Evaluate address.
+                    auto result = evaluate_as_address(state, *dir_node.address);
+                    if (!result.has_value())
+                    {
+                        return g10::error("Invalid address: {} at {}:{}:{}",
+                            result.error(),
+                            instr.source_file,
+                            instr.source_line,
+                            instr.source_column);
                     }
-                    else
+                    emit_dword(state, result.value());
+
+                    if (auto reloc_result = create_label_relocation(state, *dir_node.address,
+                        g10::relocation_type::abs32); !reloc_result.has_value())
                     {
-                        // Evaluate address.
-                        auto result = evaluate_as_address(state, *dir_node.address);
-                        if (!result.has_value())
-                        {
-                            return g10::error("Invalid address: {} at {}:{}:{}",
-                                result.error(),
-                                instr.source_file,
-                                instr.source_line,
-                                instr.source_column);
-                        }
-                        emit_dword(state, result.value());
+                        return reloc_result;
                     }
                 }
                 return {};
@@ -3035,18 +4943,9 @@ namespace g10asm
                         instr.source_column);
                 }
 
-                auto result = evaluate_as_address(state, *dir_node.address);
-                if (!result.has_value())
-                {
-                    return g10::error("Invalid address: {} at {}:{}:{}",
-                        result.error(),
-                        instr.source_file,
-                        instr.source_line,
-                        instr.source_column);
-                }
-
-                std::uint32_t addr = result.value();
-
+                // - An address referencing an external symbol is left to the
+                //   linker.
+                g10::relocation_type reloc_type = g10::relocation_type::abs32;
                 if (instr.instruction == g10::instruction::stq)
                 {
                     // STQ: 16-bit relative to $FFFF0000
@@ -3056,15 +4955,13 @@ namespace g10asm
                         case 1: opcode = 0x2900 | src_idx; break;
                         case 2: opcode = 0x3900 | src_idx; break;
                     }
-                    emit_word(state, opcode);
-                    emit_word(state, static_cast<std::uint16_t>(addr & 0xFFFF));
+                    reloc_type = g10::relocation_type::quick16;
                 }
                 else if (instr.instruction == g10::instruction::stp)
                 {
                     // STP: 8-bit relative to $FFFFFF00 (byte only)
                     opcode = 0x1B00 | src_idx;
-                    emit_word(state, opcode);
-                    emit_byte(state, static_cast<std::uint8_t>(addr & 0xFF));
+                    reloc_type = g10::relocation_type::port8;
                 }
                 else
                 {
@@ -3075,8 +4972,49 @@ namespace g10asm
                         case 1: opcode = 0x2700 | src_idx; break;
                         case 2: opcode = 0x3700 | src_idx; break;
                     }
-                    emit_word(state, opcode);
-                    emit_dword(state, addr);
+                }
+                emit_word(state, opcode);
+
+                auto reloc_result = create_address_relocation(state, instr,
+                    *dir_node.address, reloc_type);
+                if (!reloc_result.has_value())
+                {
+                    return g10::error("{}", reloc_result.error());
+                }
+                else if (reloc_result.value() == true)
+                {
+                    return {};
+                }
+
+                auto result = evaluate_as_address(state, *dir_node.address);
+                if (!result.has_value())
+                {
+                    return g10::error("Invalid address: {} at {}:{}:{}",
+                        result.error(),
+                        instr.source_file,
+                        instr.source_line,
+                        instr.source_column);
+                }
+
+                std::uint32_t addr = result.value();
+
+                switch (reloc_type)
+                {
+                    case g10::relocation_type::quick16:
+                        emit_word(state, static_cast<std::uint16_t>(addr & 0xFFFF));
+                        break;
+                    case g10::relocation_type::port8:
+                        emit_byte(state, static_cast<std::uint8_t>(addr & 0xFF));
+                        break;
+                    default:
+                        emit_dword(state, addr);
+                        break;
+                }
+
+                if (reloc_type == g10::relocation_type::abs32)
+                {
+                    return create_label_relocation(state, *dir_node.address,
+                        g10::relocation_type::abs32);
                 }
                 return {};
             }
@@ -3278,7 +5216,8 @@ namespace g10asm
                 opcode = 0x3500;
                 emit_word(state, opcode);
                 emit_dword(state, result.value());
-                return {};
+                return create_label_relocation(state, *imm_node.value,
+                    g10::relocation_type::abs32);
             }
 
             case g10::instruction::pop:
@@ -3347,7 +5286,8 @@ namespace g10asm
                 opcode = 0x3B00;
                 emit_word(state, opcode);
                 emit_dword(state, result.value());
-                return {};
+                return create_label_relocation(state, *dir_node.address,
+                    g10::relocation_type::abs32);
             }
 
             case g10::instruction::push:
@@ -3452,8 +5392,14 @@ namespace g10asm
 
         switch (instr.instruction)
         {
-            case g10::instruction::jmp:
             case g10::instruction::jp:
+                if (is_relaxable_branch(instr) == true)
+                {
+                    return emit_relaxed_branch(state, instr, condition);
+                }
+                [[fallthrough]];
+
+            case g10::instruction::jmp:
             {
                 if (operand_start >= instr.operands.size())
                 {
@@ -3478,6 +5424,27 @@ namespace g10asm
                             instr.source_column);
                     }
 
+                    opcode = 0x4000 | (condition << 4);
+                    emit_word(state, opcode);
+
+                    // - A jump to an external symbol is left to the linker.
+                    //   A `JP` (rather than an explicit `JMP`) to a bare
+                    //   external label may be rewritten by the linker as a
+                    //   `JPB`, once the distance to its target is known.
+                    auto extern_result = create_address_relocation(state, instr,
+                        *imm_node.value,
+                        (instr.instruction == g10::instruction::jp) ?
+                            g10::relocation_type::jump32 :
+                            g10::relocation_type::abs32);
+                    if (!extern_result.has_value())
+                    {
+                        return g10::error(extern_result.error());
+                    }
+                    else if (extern_result.value() == true)
+                    {
+                        return {};
+                    }
+
                     auto result = evaluate_as_address(state, *imm_node.value);
                     if (!result.has_value())
                     {
@@ -3488,9 +5455,15 @@ namespace g10asm
                             instr.source_column);
                     }
 
-                    opcode = 0x4000 | (condition << 4);
-                    emit_word(state, opcode);
                     emit_dword(state, result.value());
+
+                    if (auto reloc_result = create_label_relocation(state, *imm_node.value,
+                        (instr.instruction == g10::instruction::jp) ?
+                        g10::relocation_type::jump32 :
+                        g10::relocation_type::abs32); !reloc_result.has_value())
+                    {
+                        return reloc_result;
+                    }
                 }
                 else if (target_node.type == ast_node_type::opr_register)
                 {
@@ -3619,64 +5592,33 @@ namespace g10asm
                 opcode = 0x4300 | (condition << 4);
                 emit_word(state, opcode);
 
-                // Check if the address references an external symbol.
-                bool needs_reloc = references_external(state, *imm_node.value);
-                if (needs_reloc)
+                // - A call to an external symbol is left to the linker.
+                auto extern_result = create_address_relocation(state, instr,
+                    *imm_node.value, g10::relocation_type::abs32);
+                if (!extern_result.has_value())
                 {
-                    // Find the external symbol name.
-                    std::string symbol_name;
-                    if (imm_node.value->type == ast_node_type::expr_primary)
-                    {
-                        const auto& primary = 
-                            static_cast<const ast_expr_primary&>(*imm_node.value);
-                        if (std::holds_alternative<std::string_view>(primary.value))
-                        {
-                            symbol_name = std::string { 
-                                std::get<std::string_view>(primary.value) };
-                        }
-                        else
-                        {
-                            symbol_name = std::string { primary.lexeme };
-                        }
-                    }
-
-                    // Emit placeholder FIRST (so offset is valid for relocation).
-                    emit_dword(state, 0x00000000);
-
-                    // Create relocation for 32-bit absolute address.
-                    // Offset is 4 bytes back from current position.
-                    auto symbol_index = state.object.find_symbol(symbol_name);
-                    if (!symbol_index.has_value())
-                    {
-                        return g10::error("Cannot create relocation: symbol '{}' not found",
-                            symbol_name);
-                    }
-
-                    g10::object_relocation reloc;
-                    reloc.offset = current_section_offset(state) - 4;  // Point to the dword we just emitted
-                    reloc.symbol_index = static_cast<std::uint32_t>(symbol_index.value());
-                    reloc.section_index = static_cast<std::uint32_t>(state.current_section_index);
-                    reloc.type = g10::relocation_type::abs32;
-                    reloc.addend = 0;
+                    return g10::error(extern_result.error());
+                }
+                else if (extern_result.value() == true)
+                {
+                    return {};
+                }
 
-                    auto result = state.object.add_relocation(reloc);
-                    if (!result.has_value())
-                    {
-                        return g10::error("Failed to add relocation: {}", result.error());
-                    }
+                auto result = evaluate_as_address(state, *imm_node.value);
+                if (!result.has_value())
+                {
+                    return g10::error("Invalid call target: {} at {}:{}:{}",
+                        result.error(),
+                        instr.source_file,
+                        instr.source_line,
+                        instr.source_column);
                 }
-                else
+                emit_dword(state, result.value());
+
+                if (auto reloc_result = create_label_relocation(state, *imm_node.value,
+                    g10::relocation_type::abs32); !reloc_result.has_value())
                 {
-                    auto result = evaluate_as_address(state, *imm_node.value);
-                    if (!result.has_value())
-                    {
-                        return g10::error("Invalid call target: {} at {}:{}:{}",
-                            result.error(),
-                            instr.source_file,
-                            instr.source_line,
-                            instr.source_column);
-                    }
-                    emit_dword(state, result.value());
+                    return reloc_result;
                 }
                 return {};
             }
@@ -4454,18 +6396,37 @@ namespace g10asm
              g10::section_flags::exec) :
             (g10::section_flags::alloc | g10::section_flags::write);
 
-        // - Check if we can reuse the current section.
         const auto& sections = state.object.get_sections();
-        if (!sections.empty())
+
+        // - Returning to the start of a section which already holds code or
+        //   data continues at its end, so that labels defined from here on
+        //   agree with where their code actually lands. Moving into the middle
+        //   of a range which has already been laid out is an error.
+        for (std::size_t i = 0; i < sections.size(); ++i)
         {
-            const auto& current = sections[state.current_section_index];
-            
-            // - Can reuse if same type and contiguous address.
-            if (current.type == sec_type &&
-                address == (current.virtual_address +
-                    static_cast<std::uint32_t>(current.data.size())))
+            const std::uint64_t start = sections[i].virtual_address;
+            const std::uint64_t end = start + ((i < state.section_extents.size()) ?
+                state.section_extents[i] : 0);
+            if (sections[i].type == sec_type && address == start)
+            {
+                state.current_section_index = i;
+                state.location_counter = static_cast<std::uint32_t>(end);
+                if (is_rom == true)
+                {
+                    state.rom_location_counter = state.location_counter;
+                }
+                else
+                {
+                    state.ram_location_counter = state.location_counter;
+                }
+
+                return {};
+            }
+            else if (address > start && address < end)
             {
-                return {}; // Continue using current section.
+                return g10::error("Address ${:08X} falls within the range "
+                    "${:08X}-${:08X}, which has already been laid out",
+                    address, start, end - 1);
             }
         }
 
@@ -4482,6 +6443,32 @@ namespace g10asm
         return {};
     }
 
+    auto codegen::note_section_extent (codegen_state& state) -> void
+    {
+        const auto& sections = state.object.get_sections();
+        if (state.current_section_index >= sections.size())
+        {
+            return;
+        }
+
+        const auto& section = sections[state.current_section_index];
+        if (state.location_counter < section.virtual_address)
+        {
+            return;
+        }
+
+        const std::uint32_t extent =
+            state.location_counter - section.virtual_address;
+
+        if (state.section_extents.size() < sections.size())
+        {
+            state.section_extents.resize(sections.size(), 0);
+        }
+
+        auto& recorded = state.section_extents[state.current_section_index];
+        recorded = std::max(recorded, extent);
+    }
+
     auto codegen::calculate_instruction_size (
         const ast_instruction& instr
     ) -> std::size_t
@@ -4660,11 +6647,21 @@ namespace g10asm
                 break;
 
             // JMP: 32-bit address if not register indirect.
+            // JP: As JMP, unless relaxed to JPB's 16-bit signed offset.
             case g10::instruction::jmp:
-                if (instr.operands.size() >= 1)
+            case g10::instruction::jp:
+                if (is_relaxable_branch(instr) == true)
+                {
+                    immediate_size = 2;
+                }
+                else if (instr.operands.size() >= 1)
                 {
-                    const auto& target_operand = *instr.operands[0];
-                    if (target_operand.type == ast_node_type::opr_direct)
+                    // - Skip the execution condition, if any.
+                    const auto& target_operand = 
+                        (instr.operands[0]->type == ast_node_type::opr_condition &&
+                            instr.operands.size() >= 2) ?
+                        *instr.operands[1] : *instr.operands[0];
+                    if (target_operand.type == ast_node_type::opr_immediate)
                     {
                         immediate_size = 4;
                     }
@@ -4702,6 +6699,7 @@ namespace g10asm
             case g10::instruction::bit:
             case g10::instruction::set:
             case g10::instruction::res:
+            case g10::instruction::tog:
                 immediate_size = 0;
                 break;
             
@@ -4735,7 +6733,7 @@ namespace g10asm
                     // - Direct memory address: size depends on instruction type.
                     //   - LD/ST: 4 bytes (32-bit address)
                     //   - LDQ/STQ: 2 bytes (16-bit relative address)
-                    //   - LDP/STP: 0 bytes (8-bit port in opcode itself)
+                    //   - LDP/STP: 1 byte (8-bit relative address)
                     switch (instr.instruction)
                     {
                         case g10::instruction::ldq:
@@ -4744,7 +6742,7 @@ namespace g10asm
                             break;
                         case g10::instruction::ldp:
                         case g10::instruction::stp:
-                            // Port address is encoded in the opcode itself.
+                            size += 1;
                             break;
                         default:
                             size += 4;
@@ -66,10 +66,84 @@ namespace g10asm
 
 }
 
+/* Public Unions and Structures ***********************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a structure describing where a label or statement was
+     *          placed by the code generation process, for producing listings.
+     */
+    struct listing_entry final
+    {
+        const ast_node*     node;                   /** @brief The label definition, instruction or data directive. */
+        std::size_t         section_index;          /** @brief Index of the section the node was placed in. */
+        std::uint32_t       section_offset;         /** @brief Offset of the node's bytes within its section. */
+        std::uint32_t       address;                /** @brief The location counter at the start of the node. */
+        std::uint32_t       size;                   /** @brief The number of bytes emitted or reserved for the node. */
+    };
+
+    /**
+     * @brief   Defines a structure containing the options which control the
+     *          code generation process.
+     */
+    struct codegen_options final
+    {
+        bool optimize = false;  /** @brief If true, the peephole optimizer is run before code is emitted. */
+        bool verbose = false;   /** @brief If true, optimizations made are reported on stdout. */
+
+        /**
+         * @brief   If not null, receives an entry for each label and statement
+         *          in the module, in the order they were placed.
+         */
+        std::vector<listing_entry>* listing = nullptr;
+
+        /**
+         * @brief   If set, overrides the smallest number of top-level nodes in
+         *          a module spanning several sections for which the sections
+         *          are emitted concurrently. `0` disables concurrent emission.
+         */
+        std::optional<std::size_t> parallel_min_nodes = std::nullopt;
+    };
+}
+
 /* Private Types **************************************************************/
 
 namespace g10asm
 {
+    /**
+     * @brief   Defines a structure representing a fixup recorded during the
+     *          single emission pass, for a statement which references labels
+     *          or symbols which were not yet defined when it was encountered.
+     * 
+     * Such statements are emitted speculatively to reserve their space, and
+     * are emitted again, in place, once every label is known.
+     */
+    struct codegen_fixup final
+    {
+        ast_node*           node;                   /** @brief The instruction or data directive to re-emit. */
+        std::size_t         section_index;          /** @brief Index of the section the statement was emitted into. */
+        std::uint32_t       section_offset;         /** @brief Offset of the statement within its section. */
+        std::uint32_t       location_counter;       /** @brief The location counter at the start of the statement. */
+        std::uint32_t       size;                   /** @brief The number of bytes reserved for the statement. */
+        bool                in_rom_region;          /** @brief Whether the statement was emitted in the ROM region. */
+    };
+
+    /**
+     * @brief   Defines a structure representing a run of consecutive top-level
+     *          nodes placed into the same section, as found by the first pass.
+     * 
+     * A run starts at the beginning of the module, or at a directive which
+     * moves the location counter (`.org`, `.rom`, `.ram` or `.int`), and ends
+     * where the next run starts.
+     */
+    struct codegen_section_run final
+    {
+        std::size_t         first_node;             /** @brief Index of the run's first node within the module. */
+        std::size_t         section_index;          /** @brief Index of the section the run is placed into. */
+        std::uint32_t       address;                /** @brief Address at which the run starts. */
+    };
+
     /**
      * @brief   Defines a structure representing the current state and context
      *          of the code generation process.
@@ -84,32 +158,118 @@ namespace g10asm
         bool                in_rom_region;          /** @brief Indicates whether the location counter is in the ROM region (`< $80000000`). */
         
         /**
-         * @brief   A map of label names to their section index and offset.
+         * @brief   A map of interned label names to their section index and
+         *          offset.
+         */
+        symbol_map<std::pair<std::size_t, std::uint32_t>> label_map;
+
+        /**
+         * @brief   A map of interned label names to the index of their symbol
+         *          within the object.
          */
-        std::unordered_map<
-            std::string, 
-            std::pair<std::size_t, std::uint32_t>
-        > label_map;
+        symbol_map<std::size_t> label_symbols;
         
         /** @brief Set of global symbol names (for duplicate checking). */
 
         /**
-         * @brief   A set of symbol names marked global, via the `.global` 
+         * @brief   A set of interned symbol names marked global, via the `.global` 
          *          directive.
          * 
          * This is needed to check for duplicate global definitions and to
          * ensure symbols are not marked both global and extern.
          */
-        std::unordered_set<std::string> global_symbols;
+        symbol_set global_symbols;
         
         /**
-         * @brief   A set of symbol names marked extern, via the `.extern`
+         * @brief   A set of interned symbol names marked extern, via the `.extern`
          *          directive.
          * 
          * This is needed to check for conflicts with global symbols, and to
          * ensure that extern symbols are not defined within the object file.
          */
-        std::unordered_set<std::string> extern_symbols;
+        symbol_set extern_symbols;
+
+        /**
+         * @brief   The fixups recorded during the single emission pass, to be
+         *          resolved once all labels are known.
+         */
+        std::vector<codegen_fixup> fixups;
+
+        /**
+         * @brief   While set, a statement containing forward references is
+         *          being emitted only to reserve its space: undefined
+         *          identifiers evaluate to the location counter, and no
+         *          relocations are created.
+         */
+        bool speculative { false };
+
+        /**
+         * @brief   While set, a fixup is being resolved, and emitted bytes
+         *          overwrite the current section's data at `patch_cursor`
+         *          instead of being appended to it.
+         */
+        bool patching { false };
+
+        /**
+         * @brief   The section offset at which the next byte is written while
+         *          resolving a fixup.
+         */
+        std::uint32_t patch_cursor { 0 };
+
+        /**
+         * @brief   The extent, in bytes, reached within each section so far,
+         *          used to reject overlapping `.org` directives and to pre-size
+         *          section buffers before the second pass emits into them.
+         */
+        std::vector<std::uint32_t> section_extents;
+
+        /**
+         * @brief   The runs of nodes placed into each section by the first
+         *          pass, in module order. Used by the second pass to emit
+         *          sections concurrently.
+         */
+        std::vector<codegen_section_run> section_runs;
+
+        /**
+         * @brief   While set, the results of evaluated expressions are cached
+         *          in their AST nodes and reused. This is only enabled once
+         *          the variable pass is complete, and is left disabled in the
+         *          two-pass fallback, whose label addresses may differ.
+         */
+        bool cache_expressions { false };
+
+        /**
+         * @brief   Identifies the current code generation attempt. Results
+         *          cached by earlier attempts, whose layouts differ, are
+         *          ignored.
+         */
+        std::uint32_t cache_epoch { 0 };
+
+        /**
+         * @brief   Set if a relaxable branch was found unable to reach its
+         *          target in its short form during this attempt, in which
+         *          case code generation must be repeated with its long form.
+         */
+        bool relaxation_changed { false };
+
+        /**
+         * @brief   While set, an entry is recorded in `listing_entries` for
+         *          each label and statement placed.
+         */
+        bool listing { false };
+
+        /**
+         * @brief   The listing entries recorded during this attempt.
+         */
+        std::vector<listing_entry> listing_entries;
+
+        /**
+         * @brief   The smallest number of top-level nodes in a module spanning
+         *          several sections for which the module is laid out by the
+         *          first pass, and its sections then emitted concurrently.
+         *          `0` disables concurrent emission.
+         */
+        std::size_t parallel_min_nodes { 0 };
 
     public:
 
@@ -154,20 +314,83 @@ namespace g10asm
          * expressions, emitting machine code, building sections, symbols and
          * relocations, and assembling everything into a valid G10 object file.
          * 
-         * This process occurs in two passes:
+         * This process occurs in the following stages:
+         * 
+         * - Variable Pass: Evaluates all `.let`, `.const` and variable
+         *   assignment statements.
+         * 
+         * - Constant Folding: Collapses constant subexpressions into literals.
+         * 
+         * - Peephole Optimization: If enabled, rewrites instructions into
+         *   cheaper equivalents. See @a `peephole`.
+         * 
+         * - Single Pass: Defines labels, creates sections and emits code in a
+         *   single walk over the AST. Statements which reference labels not
+         *   yet defined are recorded as fixups and patched in place once the
+         *   walk is complete.
          * 
-         * - First Pass: (...)
+         * - First and Second Pass: If the single pass cannot proceed because
+         *   a section's address or size depends on a label not yet defined
+         *   (eg. `.org` with a forward reference), the traditional two-pass
+         *   scheme is used instead: the first pass assigns addresses, and the
+         *   second pass emits code.
          * 
-         * - Second Pass: (...)
+         * - Branch Relaxation: The single or two-pass scheme is repeated
+         *   until every `JP` instruction has settled on its shortest encoding
+         *   which can reach its target.
          * 
-         * - Finalization: (...)
+         * - Finalization: Sets the object's flags and verifies its symbols and
+         *   relocations.
          * 
          * @param   module  The AST module to process.
+         * @param   options The options controlling code generation.
+         * 
+         * @return  If successful, returns the generated G10 object file;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto process (
+            ast_module& module,
+            const codegen_options& options = {}
+        ) -> g10::result<g10::object>;
+
+        /**
+         * @brief   Assembles the given source file in streaming mode,
+         *          generating a G10 object file while holding only a bounded
+         *          portion of the source in memory.
+         * 
+         * The source file is read, lexed and parsed in chunks of whole lines,
+         * each of which is discarded once the statements it contains have been
+         * emitted and their fixups resolved. Beyond the current chunk, only
+         * the symbol tables, the unresolved fixups (and the chunks containing
+         * their statements) and the object being built are kept in memory.
+         * 
+         * The file is streamed twice: once to run the variable pass over the
+         * whole file, so that every statement sees the same variable values as
+         * it would in @a `process`, and once to emit code in the single pass.
+         * Streaming mode differs from @a `process` as follows:
+         * 
+         * - `JP` instructions are settled as they are encountered: a branch to
+         *   a label already defined within reach uses its short form, and any
+         *   other branch uses its long form (`JMP`).
+         * 
+         * - The two-pass fallback is not available; a module whose layout
+         *   depends on a forward reference (eg. `.org` with a forward
+         *   reference) is rejected.
+         * 
+         * - Peephole optimization, if enabled, does not consider instruction
+         *   sequences which span two chunks.
+         * 
+         * @param   source_file The path to the source file to assemble.
+         * @param   options     The options controlling code generation. Listing
+         *                      entries are not supported in streaming mode.
          * 
          * @return  If successful, returns the generated G10 object file;
          *          Otherwise, returns an error message describing the failure.
          */
-        static auto process (ast_module& module) -> g10::result<g10::object>;
+        static auto process_stream (
+            const fs::path& source_file,
+            const codegen_options& options = {}
+        ) -> g10::result<g10::object>;
 
     private: /* Private Types *************************************************/
 
@@ -235,6 +458,279 @@ namespace g10asm
             ast_stmt_var_assignment& assign_stmt
         ) -> g10::result<void>;
 
+    private: /* Private Methods - Constant Folding ****************************/
+
+        /**
+         * @brief   Folds constant subexpressions throughout the module.
+         * 
+         * Once the variable pass is complete, any subexpression consisting
+         * solely of literals and `.const` constants always evaluates to the
+         * same value. Such subexpressions are evaluated once, here, and
+         * replaced with integer literal nodes, so that later passes do not
+         * re-walk them.
+         * 
+         * @param   state   The codegen state.
+         * @param   module  The AST module to process.
+         */
+        static auto fold_constants (codegen_state& state, ast_module& module)
+            -> void;
+
+        /**
+         * @brief   Folds the constant subexpressions of the expression held by
+         *          the given slot, replacing the expression itself with an
+         *          integer literal if it is constant.
+         * 
+         * @param   state   The codegen state.
+         * @param   slot    The owning pointer to the expression to fold.
+         * 
+         * @return  `true` if the expression is constant; `false` otherwise.
+         */
+        static auto fold_expression (
+            codegen_state& state,
+            std::unique_ptr<ast_expression>& slot
+        ) -> bool;
+
+        /**
+         * @brief   Folds the constant subexpressions of the expression held by
+         *          the given generic AST node slot, as in @a `fold_expression`.
+         * 
+         * @param   state   The codegen state.
+         * @param   slot    The owning pointer to the expression node to fold.
+         */
+        static auto fold_node (
+            codegen_state& state,
+            std::unique_ptr<ast_node>& slot
+        ) -> void;
+
+    private: /* Private Methods - Code Generation *****************************/
+
+        /**
+         * @brief   Makes one code generation attempt, using the single pass if
+         *          possible, or the two-pass scheme otherwise. A module whose
+         *          sections are to be emitted concurrently always uses the
+         *          two-pass scheme, so that every label is placed before any
+         *          section is emitted.
+         * 
+         * @param   state   The codegen state, freshly reset for this attempt.
+         * @param   module  The AST module to process.
+         * 
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto generate_code (codegen_state& state, ast_module& module)
+            -> g10::result<void>;
+
+        /**
+         * @brief   Checks whether the given module is large enough, and moves
+         *          its location counter often enough, for its sections to be
+         *          emitted concurrently.
+         * 
+         * @param   state   The codegen state.
+         * @param   module  The AST module to check.
+         * 
+         * @return  `true` if the module's sections should be emitted
+         *          concurrently; `false` otherwise.
+         */
+        static auto emits_concurrently (
+            const codegen_state& state,
+            const ast_module& module
+        ) -> bool;
+
+    private: /* Private Methods - Branch Relaxation ***************************/
+
+        /**
+         * @brief   Checks if the given instruction is a `JP` instruction which
+         *          may be emitted in the short `JPB` form - that is, one whose
+         *          target is a bare label, and which has not yet been found
+         *          unable to reach it.
+         * 
+         * @param   instr   The AST instruction node.
+         * 
+         * @return  True if the instruction is emitted as a 4-byte `JPB`.
+         */
+        static auto is_relaxable_branch (const ast_instruction& instr) -> bool;
+
+        /**
+         * @brief   Emits a relaxable `JP` instruction in its short `JPB` form.
+         * 
+         * If the target label lies outside of the current section, is not
+         * defined in this module, or is out of range of a 16-bit offset, the
+         * instruction is marked to use its long form in the next attempt, and
+         * a placeholder of the same size is emitted in the meantime.
+         * 
+         * @param   state       The codegen state.
+         * @param   instr       The AST instruction node.
+         * @param   condition   The instruction's execution condition.
+         * 
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto emit_relaxed_branch (
+            codegen_state& state,
+            ast_instruction& instr,
+            std::uint8_t condition
+        ) -> g10::result<void>;
+
+    private: /* Private Methods - Single Pass *********************************/
+
+        /**
+         * @brief   Performs the single emission pass of the assembly process.
+         * 
+         * Labels are defined, sections are created and code is emitted in a
+         * single walk over the AST. Instructions and data directives which
+         * reference labels not yet defined are emitted speculatively, to
+         * reserve their space, and recorded as fixups to be resolved by
+         * @a `resolve_fixups`.
+         * 
+         * @param   state   The codegen state.
+         * @param   module  The AST module to process.
+         * 
+         * @return  If successful, returns `true`, or `false` if the module
+         *          cannot be assembled in a single pass and the two-pass
+         *          scheme must be used instead;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto single_pass (codegen_state& state, ast_module& module)
+            -> g10::result<bool>;
+
+        /**
+         * @brief   Emits an instruction or data directive in the single pass,
+         *          recording a fixup if it references labels or symbols which
+         *          are not yet defined.
+         * 
+         * @param   state   The codegen state.
+         * @param   node    The AST instruction or data directive node.
+         * 
+         * @return  If successful, returns `true`, or `false` if the statement
+         *          could not be sized speculatively;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto single_pass_statement (
+            codegen_state& state,
+            ast_node& node
+        ) -> g10::result<bool>;
+
+        /**
+         * @brief   Handles a single top-level node in the single pass:
+         *          defines labels, processes symbol and region directives,
+         *          and emits instructions and data directives.
+         * 
+         * @param   state   The codegen state.
+         * @param   node    The top-level AST node.
+         * 
+         * @return  If successful, returns `true`, or `false` if the module
+         *          cannot be assembled in a single pass;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto single_pass_node (codegen_state& state, ast_node& node)
+            -> g10::result<bool>;
+
+        /**
+         * @brief   Resolves the fixups recorded during the single pass, by
+         *          re-emitting each affected statement in place.
+         * 
+         * @param   state   The codegen state.
+         * 
+         * @return  If successful, returns `true`, or `false` if a statement's
+         *          resolved size differs from its speculative size;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto resolve_fixups (codegen_state& state)
+            -> g10::result<bool>;
+
+        /**
+         * @brief   Resolves a single fixup, by re-emitting its statement in
+         *          place. The location counter, current section and region
+         *          are left as they were when the statement was encountered.
+         * 
+         * @param   state   The codegen state.
+         * @param   fixup   The fixup to resolve.
+         * 
+         * @return  If successful, returns `true`, or `false` if the statement's
+         *          resolved size differs from its speculative size;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto resolve_fixup (
+            codegen_state& state,
+            const codegen_fixup& fixup
+        ) -> g10::result<bool>;
+
+        /**
+         * @brief   Emits the machine code or data for an instruction or data
+         *          directive node, dispatching on its type.
+         * 
+         * @param   state   The codegen state.
+         * @param   node    The AST instruction or data directive node.
+         * 
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto emit_statement (codegen_state& state, ast_node& node)
+            -> g10::result<void>;
+
+        /**
+         * @brief   Checks if an expression references labels or symbols which
+         *          have not yet been defined or declared.
+         * 
+         * @param   state   The codegen state.
+         * @param   expr    The expression to check.
+         * 
+         * @return  True if the expression references an undefined identifier.
+         */
+        static auto references_unresolved (
+            const codegen_state& state,
+            const ast_expression& expr
+        ) -> bool;
+
+        /**
+         * @brief   Checks if any expression within an instruction's operands,
+         *          or a data directive's values, references labels or symbols
+         *          which have not yet been defined or declared.
+         * 
+         * @param   state   The codegen state.
+         * @param   node    The AST instruction or data directive node.
+         * 
+         * @return  True if the statement references an undefined identifier.
+         */
+        static auto statement_references_unresolved (
+            const codegen_state& state,
+            const ast_node& node
+        ) -> bool;
+
+    private: /* Private Methods - Streaming ***********************************/
+
+        /**
+         * @brief   Settles the encoding of a relaxable `JP` instruction before
+         *          it is emitted in streaming mode, where the instruction
+         *          cannot be emitted again should its short form fall short.
+         * 
+         * The short form is kept only if the branch's target label is already
+         * defined in the current section, and within reach of the branch.
+         * 
+         * @param   state   The codegen state.
+         * @param   node    The top-level AST node about to be emitted.
+         */
+        static auto settle_stream_branch (codegen_state& state, ast_node& node)
+            -> void;
+
+        /**
+         * @brief   Resolves, in place, every fixup whose statement no longer
+         *          references any undefined labels, and removes it from the
+         *          list of fixups. The location counter, current section and
+         *          region are left unchanged.
+         * 
+         * @param   state           The codegen state.
+         * @param   fixup_chunks    The chunk number of each fixup's statement,
+         *                          kept parallel to the list of fixups.
+         * 
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto resolve_ready_fixups (
+            codegen_state& state,
+            std::vector<std::size_t>& fixup_chunks
+        ) -> g10::result<void>;
+
     private: /* Private Methods - First Pass **********************************/
 
         /**
@@ -399,6 +895,42 @@ namespace g10asm
         static auto second_pass (codegen_state& state, ast_module& module)
             -> g10::result<void>;
 
+        /**
+         * @brief   Performs the second pass of assembly with each section's
+         *          runs emitted on a worker thread.
+         * 
+         * Each worker emits into its own copy of the state, holding only the
+         * data of the section it is emitting. The relocations and listing
+         * entries recorded by each run are then merged into the object in
+         * module order, so that the result is identical to that of emitting
+         * the module sequentially.
+         * 
+         * @param   state   The codegen state.
+         * @param   module  The AST module to process.
+         * 
+         * @return  If successful, returns void; otherwise an error.
+         */
+        static auto second_pass_parallel (
+            codegen_state& state,
+            ast_module& module
+        ) -> g10::result<void>;
+
+        /**
+         * @brief   Emits a single section run in the second pass, starting at
+         *          the start of its section.
+         * 
+         * @param   state       The codegen state.
+         * @param   module      The AST module to process.
+         * @param   run_index   The index of the run within `section_runs`.
+         * 
+         * @return  If successful, returns void; otherwise an error.
+         */
+        static auto second_pass_run (
+            codegen_state& state,
+            ast_module& module,
+            std::size_t run_index
+        ) -> g10::result<void>;
+
         /**
          * @brief   Processes an instruction in the second pass (emit code).
          * 
@@ -503,6 +1035,30 @@ namespace g10asm
             ast_dir_dword& dir
         ) -> g10::result<void>;
 
+        /**
+         * @brief   Computes the space reserved by a data directive in the RAM
+         *          region, where each value is a count of elements.
+         *
+         * Both the first and the second pass size reservations through this
+         * method, so that they agree on the addresses of the labels after it.
+         * 
+         * @param   state           The codegen state.
+         * @param   directive       The directive's name, for error messages.
+         * @param   dir             The data directive node.
+         * @param   values          The directive's values.
+         * @param   element_size    The size of each element, in bytes.
+         * 
+         * @return  If successful, returns the number of bytes reserved;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto data_reservation_size (
+            codegen_state& state,
+            std::string_view directive,
+            const ast_node& dir,
+            const std::vector<std::unique_ptr<ast_node>>& values,
+            std::size_t element_size
+        ) -> g10::result<std::uint32_t>;
+
     private: /* Private Methods - Finalization ********************************/
 
         /**
@@ -572,6 +1128,21 @@ namespace g10asm
             const ast_expression& expr
         ) -> g10::result<value>;
 
+        /**
+         * @brief   Evaluates an AST expression without consulting or updating
+         *          its cached result.
+         * 
+         * @param   state   The codegen state (for symbol lookup).
+         * @param   expr    The expression to evaluate.
+         * 
+         * @return  If successful, returns the evaluated value;
+         *          Otherwise, returns an error message.
+         */
+        static auto evaluate_uncached (
+            codegen_state& state,
+            const ast_expression& expr
+        ) -> g10::result<value>;
+
         /**
          * @brief   Evaluates a primary expression (literals and identifiers).
          * 
@@ -696,8 +1267,54 @@ namespace g10asm
             const ast_expression& expr
         ) -> bool;
 
+        /**
+         * @brief   Checks if an expression references labels defined in this
+         *          object.
+         * 
+         * @param   state   The codegen state.
+         * @param   expr    The expression to check.
+         * 
+         * @return  True if the expression references a label.
+         */
+        static auto references_label (
+            const codegen_state& state,
+            const ast_expression& expr
+        ) -> bool;
+
+        /**
+         * @brief   Splits an expression of the form `label`, `label + N`,
+         *          `N + label` or `label - N` into the label it refers to and
+         *          its constant offset from that label.
+         * 
+         * @param   state   The codegen state.
+         * @param   expr    The expression to split.
+         * 
+         * @return  If the expression has this form, returns the label's
+         *          interned name and the offset; otherwise, `std::nullopt`.
+         */
+        static auto split_label_offset (
+            codegen_state& state,
+            const ast_expression& expr
+        ) -> std::optional<std::pair<symbol_id, std::int64_t>>;
+
     private: /* Private Methods - Code Emission *******************************/
 
+        /**
+         * @brief   Reserves the given number of bytes at the current position
+         *          in the current section, advancing the location counter.
+         * 
+         * The bytes are appended to the section's data, or, while a fixup is
+         * being resolved, overlay the space the fixup reserved.
+         * 
+         * @param   state   The codegen state.
+         * @param   count   The number of bytes to reserve.
+         * 
+         * @return  A writable span over the reserved bytes, or an empty span if
+         *          there is no current section.
+         */
+        static auto reserve_bytes (codegen_state& state, std::size_t count)
+            -> std::span<std::uint8_t>;
+
         /**
          * @brief   Emits a single byte to the current section.
          * 
@@ -743,6 +1360,22 @@ namespace g10asm
         static auto current_section_offset (const codegen_state& state)
             -> std::uint32_t;
 
+        /**
+         * @brief   Records a listing entry for a label or statement which has
+         *          just been placed, if a listing was requested.
+         * 
+         * @param   state           The codegen state.
+         * @param   node            The label definition or statement node.
+         * @param   address         The location counter before the node.
+         * @param   section_offset  The section offset before the node.
+         */
+        static auto record_listing_entry (
+            codegen_state& state,
+            const ast_node& node,
+            std::uint32_t address,
+            std::uint32_t section_offset
+        ) -> void;
+
         /**
          * @brief   Creates a relocation entry for the current position.
          * 
@@ -760,6 +1393,48 @@ namespace g10asm
             std::int16_t addend
         ) -> g10::result<void>;
 
+        /**
+         * @brief   If a memory operand's address, or a jump or call target,
+         *          references an external symbol, emits a zero placeholder for
+         *          the address at the current position, and creates a
+         *          relocation for it. The address must then be a bare symbol.
+         * 
+         * @param   state   The codegen state.
+         * @param   instr   The instruction the operand belongs to.
+         * @param   address The operand's address expression.
+         * @param   type    The relocation type, which sets the size of the
+         *                  placeholder.
+         * 
+         * @return  If the address was emitted with a relocation, returns
+         *          `true`; if it must be evaluated and emitted by the caller,
+         *          returns `false`; otherwise an error.
+         */
+        static auto create_address_relocation (
+            codegen_state& state,
+            const ast_instruction& instr,
+            const ast_expression& address,
+            g10::relocation_type type
+        ) -> g10::result<bool>;
+
+        /**
+         * @brief   If a 32-bit address just emitted is a label defined in this
+         *          object, plus or minus a constant, creates a relocation for
+         *          it against the label, with the constant as its addend, so
+         *          that the linker may move the label's section.
+         * 
+         * @param   state   The codegen state.
+         * @param   address The address expression just emitted.
+         * @param   type    The relocation type: `ABS32`, or `JUMP32` for the
+         *                  target of a `JP`.
+         * 
+         * @return  If successful, returns void; otherwise an error.
+         */
+        static auto create_label_relocation (
+            codegen_state& state,
+            const ast_expression& address,
+            g10::relocation_type type
+        ) -> g10::result<void>;
+
     private: /* Private Methods - Instruction Emission ************************/
 
         /**
@@ -921,7 +1596,8 @@ namespace g10asm
         /**
          * @brief   Ensures that a section exists at the given address, creating
          *          one if necessary; or switches to the existing section if one
-         *          is already present.
+         *          is already present. Fails if the address falls within a
+         *          range which has already been laid out.
          * 
          * @param   state   The codegen state.
          * @param   address The address at which to ensure a section exists.
@@ -934,6 +1610,16 @@ namespace g10asm
             std::uint32_t address
         ) -> g10::result<void>;
 
+        /**
+         * @brief   Records the extent reached by the location counter within
+         *          the current section, for pre-sizing its buffer later.
+         *          Must be called before the location counter leaves the
+         *          section.
+         * 
+         * @param   state   The codegen state.
+         */
+        static auto note_section_extent (codegen_state& state) -> void;
+
         /**
          * @brief   Retrieves the size, in bytes, of the given instruction,
          *          including its operands.
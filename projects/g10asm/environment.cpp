@@ -29,7 +29,7 @@ namespace g10asm
 
 namespace g10asm
 {
-    std::unordered_map<std::string, environment_entry> environment::s_entries;
+    symbol_map<environment_entry> environment::s_entries;
 }
 
 /* Public Methods *************************************************************/
@@ -42,19 +42,19 @@ namespace g10asm
     }
 
     auto environment::define_variable (
-        const std::string& name,
+        symbol_id name,
         const value& init_value,
         std::string_view source_file,
         std::size_t source_line
     ) -> g10::result<void>
     {
         // Check if name already exists.
-        if (auto it = s_entries.find(name); it != s_entries.end())
+        if (const auto* existing_ptr = s_entries.find(name); existing_ptr != nullptr)
         {
-            const auto& existing = it->second;
+            const auto& existing = *existing_ptr;
             return g10::error(
                 "'${}' is already defined as a {} at '{}:{}'.",
-                name,
+                existing.name,
                 existing.is_constant ? "constant" : "variable",
                 existing.source_file,
                 existing.source_line
@@ -62,11 +62,12 @@ namespace g10asm
         }
 
         // Create the entry.
-        s_entries.emplace(name, environment_entry {
-            .name = name,
+        s_entries.insert(name, environment_entry {
+            .name = symbol_table::name_of(name),
             .current_value = init_value,
             .is_constant = false,
-            .source_file = source_file,
+            .source_file = symbol_table::name_of(
+                symbol_table::intern(source_file)),
             .source_line = source_line
         });
 
@@ -74,19 +75,19 @@ namespace g10asm
     }
 
     auto environment::define_constant (
-        const std::string& name,
+        symbol_id name,
         const value& init_value,
         std::string_view source_file,
         std::size_t source_line
     ) -> g10::result<void>
     {
         // Check if name already exists.
-        if (auto it = s_entries.find(name); it != s_entries.end())
+        if (const auto* existing_ptr = s_entries.find(name); existing_ptr != nullptr)
         {
-            const auto& existing = it->second;
+            const auto& existing = *existing_ptr;
             return g10::error(
                 "'${}' is already defined as a {} at '{}:{}'.",
-                name,
+                existing.name,
                 existing.is_constant ? "constant" : "variable",
                 existing.source_file,
                 existing.source_line
@@ -94,62 +95,65 @@ namespace g10asm
         }
 
         // Create the entry.
-        s_entries.emplace(name, environment_entry {
-            .name = name,
+        s_entries.insert(name, environment_entry {
+            .name = symbol_table::name_of(name),
             .current_value = init_value,
             .is_constant = true,
-            .source_file = source_file,
+            .source_file = symbol_table::name_of(
+                symbol_table::intern(source_file)),
             .source_line = source_line
         });
 
         return {};
     }
 
-    auto environment::get_value (const std::string& name) -> g10::result<value>
+    auto environment::get_value (symbol_id name) -> g10::result<value>
     {
-        auto it = s_entries.find(name);
-        if (it == s_entries.end())
+        const auto* entry = s_entries.find(name);
+        if (entry == nullptr)
         {
-            return g10::error("Undefined variable or constant '${}'. ", name);
+            return g10::error("Undefined variable or constant '${}'. ",
+                symbol_table::name_of(name));
         }
 
-        return it->second.current_value;
+        return entry->current_value;
     }
 
     auto environment::set_value (
-        const std::string& name,
+        symbol_id name,
         const value& new_value
     ) -> g10::result<void>
     {
-        auto it = s_entries.find(name);
-        if (it == s_entries.end())
+        auto* entry = s_entries.find(name);
+        if (entry == nullptr)
         {
-            return g10::error("Undefined variable '${}'. ", name);
+            return g10::error("Undefined variable '${}'. ",
+                symbol_table::name_of(name));
         }
 
-        if (it->second.is_constant)
+        if (entry->is_constant)
         {
             return g10::error(
                 "Cannot modify constant '${}' (defined at '{}:{}').",
-                name,
-                it->second.source_file,
-                it->second.source_line
+                entry->name,
+                entry->source_file,
+                entry->source_line
             );
         }
 
-        it->second.current_value = new_value;
+        entry->current_value = new_value;
         return {};
     }
 
-    auto environment::exists (const std::string& name) -> bool
+    auto environment::exists (symbol_id name) -> bool
     {
-        return s_entries.find(name) != s_entries.end();
+        return s_entries.contains(name);
     }
 
-    auto environment::is_constant (const std::string& name) -> bool
+    auto environment::is_constant (symbol_id name) -> bool
     {
-        auto it = s_entries.find(name);
-        return it != s_entries.end() && it->second.is_constant;
+        const auto* entry = s_entries.find(name);
+        return entry != nullptr && entry->is_constant;
     }
 }
 
@@ -12,6 +12,7 @@
 /* Public Includes ************************************************************/
 
 #include <g10asm/codegen.hpp>
+#include <g10asm/symbol_table.hpp>
 
 /* Public Constants and Enumerations ******************************************/
 
@@ -32,10 +33,10 @@ namespace g10asm
      */
     struct environment_entry final
     {
-        std::string         name;           /** @brief The variable/constant name (without the `$` prefix). */
+        std::string_view    name;           /** @brief The variable/constant name (without the `$` prefix). */
         value               current_value;  /** @brief The current value of this variable/constant. */
         bool                is_constant;    /** @brief If true, this entry is immutable (constant). */
-        std::string_view    source_file;    /** @brief Source file where this entry was defined. */
+        std::string_view    source_file;    /** @brief Source file where this entry was defined (interned, as it may outlive its lexer). */
         std::size_t         source_line;    /** @brief Source line where this entry was defined. */
     };
 }
@@ -55,7 +56,8 @@ namespace g10asm
      * Constants are immutable and cannot be modified after definition.
      * 
      * All variable and constant names are prefixed with `$` in source code,
-     * but stored without the prefix in the environment table.
+     * but are interned without the prefix, and are looked up in the
+     * environment table by their interned symbol IDs.
      */
     class environment final
     {
@@ -71,7 +73,7 @@ namespace g10asm
         /**
          * @brief   Defines a new mutable variable in the environment.
          * 
-         * @param   name        The variable name (without the `$` prefix).
+         * @param   name        The interned variable name (without the `$` prefix).
          * @param   init_value  The initial value of the variable.
          * @param   source_file The source file where the variable was defined.
          * @param   source_line The source line where the variable was defined.
@@ -80,7 +82,7 @@ namespace g10asm
          *          Otherwise, returns an error if the name is already defined.
          */
         static auto define_variable (
-            const std::string& name,
+            symbol_id name,
             const value& init_value,
             std::string_view source_file,
             std::size_t source_line
@@ -89,7 +91,7 @@ namespace g10asm
         /**
          * @brief   Defines a new immutable constant in the environment.
          * 
-         * @param   name        The constant name (without the `$` prefix).
+         * @param   name        The interned constant name (without the `$` prefix).
          * @param   init_value  The value of the constant.
          * @param   source_file The source file where the constant was defined.
          * @param   source_line The source line where the constant was defined.
@@ -98,7 +100,7 @@ namespace g10asm
          *          Otherwise, returns an error if the name is already defined.
          */
         static auto define_constant (
-            const std::string& name,
+            symbol_id name,
             const value& init_value,
             std::string_view source_file,
             std::size_t source_line
@@ -107,17 +109,17 @@ namespace g10asm
         /**
          * @brief   Retrieves the current value of a variable or constant.
          * 
-         * @param   name    The name to look up (without the `$` prefix).
+         * @param   name    The interned name to look up (without the `$` prefix).
          * 
          * @return  If found, returns the current value;
          *          Otherwise, returns an error indicating the name is undefined.
          */
-        static auto get_value (const std::string& name) -> g10::result<value>;
+        static auto get_value (symbol_id name) -> g10::result<value>;
 
         /**
          * @brief   Sets the value of a mutable variable.
          * 
-         * @param   name        The variable name (without the `$` prefix).
+         * @param   name        The interned variable name (without the `$` prefix).
          * @param   new_value   The new value to assign.
          * 
          * @return  If successful, returns void;
@@ -125,27 +127,27 @@ namespace g10asm
          *          if attempting to modify a constant.
          */
         static auto set_value (
-            const std::string& name,
+            symbol_id name,
             const value& new_value
         ) -> g10::result<void>;
 
         /**
          * @brief   Checks whether a name exists in the environment.
          * 
-         * @param   name    The name to check (without the `$` prefix).
+         * @param   name    The interned name to check (without the `$` prefix).
          * 
          * @return  True if the name exists; false otherwise.
          */
-        static auto exists (const std::string& name) -> bool;
+        static auto exists (symbol_id name) -> bool;
 
         /**
          * @brief   Checks whether a name refers to a constant.
          * 
-         * @param   name    The name to check (without the `$` prefix).
+         * @param   name    The interned name to check (without the `$` prefix).
          * 
          * @return  True if the name exists and is a constant; false otherwise.
          */
-        static auto is_constant (const std::string& name) -> bool;
+        static auto is_constant (symbol_id name) -> bool;
 
     private: /* Private Methods ***********************************************/
 
@@ -154,9 +156,10 @@ namespace g10asm
     private: /* Private Members ***********************************************/
 
         /**
-         * @brief   The environment table mapping names to their entries.
+         * @brief   The environment table mapping interned names to their
+         *          entries.
          */
-        static std::unordered_map<std::string, environment_entry> s_entries;
+        static symbol_map<environment_entry> s_entries;
 
     };
 }
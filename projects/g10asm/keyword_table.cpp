@@ -100,6 +100,10 @@ namespace g10asm
         { ".extern", keyword_type::assembler_directive, std::to_underlying(directive_type::extern_), 0 },
         { ".let", keyword_type::assembler_directive, std::to_underlying(directive_type::let), 0 },
         { ".const", keyword_type::assembler_directive, std::to_underlying(directive_type::const_), 0 },
+        { ".macro", keyword_type::assembler_directive, std::to_underlying(directive_type::macro), 0 },
+        { ".endm", keyword_type::assembler_directive, std::to_underlying(directive_type::endm), 0 },
+        { ".rept", keyword_type::assembler_directive, std::to_underlying(directive_type::rept), 0 },
+        { ".endr", keyword_type::assembler_directive, std::to_underlying(directive_type::endr), 0 },
 
         // CPU Registers
         { "d0", keyword_type::register_name, std::to_underlying(g10::register_type::d0), 0 },
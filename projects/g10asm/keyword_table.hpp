@@ -46,6 +46,10 @@ namespace g10asm
         extern_,    /** @brief The `.extern` directive declares symbols defined in other modules. */
         let,        /** @brief The `.let` directive declares a mutable assembler variable. */
         const_,     /** @brief The `.const` directive declares an immutable assembler constant. */
+        macro,      /** @brief The `.macro` directive begins the definition of a macro. */
+        endm,       /** @brief The `.endm` directive ends the definition of a macro. */
+        rept,       /** @brief The `.rept` directive begins a block to be repeated a number of times. */
+        endr,       /** @brief The `.endr` directive ends a repeated block. */
     };
 }
 
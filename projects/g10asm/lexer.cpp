@@ -10,6 +10,7 @@
 /* Private Includes ***********************************************************/
 
 #include <g10asm/lexer.hpp>
+#include <g10asm/macro_expander.hpp>
 
 /* Private Static Members *****************************************************/
 
@@ -17,14 +18,17 @@ namespace g10asm
 {
     std::vector<std::unique_ptr<lexer>> lexer::s_lexers;
     std::size_t lexer::s_maximum_lexer_count = 32;
+    std::uint64_t lexer::s_generation = 0;
 }
 
 /* Public Methods *************************************************************/
 
 namespace g10asm
 {
-    lexer::lexer (const std::string& source_code, const fs::path& source_file) :
-        m_source_code { source_code }
+    lexer::lexer (const std::string& source_code, const fs::path& source_file,
+        std::size_t first_line, bool partial) :
+        m_source_code { source_code },
+        m_current_line { first_line }
     {
         if (source_file.empty() == false)
         {
@@ -32,6 +36,27 @@ namespace g10asm
         }
 
         tokenize();
+        if (m_good == false)
+        {
+            return;
+        }
+
+        // - Expand macros and repeated blocks before the tokens are parsed.
+        //   A portion of a file after its first continues the macros of the
+        //   portions before it.
+        auto expand_result = macro_expander::expand(m_tokens, m_source_file,
+            first_line > 1, partial);
+        if (expand_result.has_value() == false)
+        {
+            std::println(stderr,
+                "Macro expansion error in '{}':\n{}",
+                (m_source_file.empty() == true) ?
+                    "<input>" :
+                    m_source_file,
+                expand_result.error()
+            );
+            m_good = false;
+        }
     }
 
     auto lexer::reserve_lexers (const std::size_t count) -> void
@@ -55,6 +80,7 @@ namespace g10asm
         {
             if (lex->m_source_file == normalized_path)
             {
+                lex->m_generation = s_generation;
                 return std::ref(*lex);
             }
         }
@@ -86,7 +112,10 @@ namespace g10asm
             );
         }
 
-        // - Open the file and read its contents.
+        // - Open the file and read its contents, noting when it was last
+        //   modified.
+        std::error_code ec;
+        const auto write_time = fs::last_write_time(normalized_path, ec);
         std::fstream file { normalized_path, std::ios::in };
         if (file.is_open() == false)
         {
@@ -116,10 +145,41 @@ namespace g10asm
         }
 
         // - Move the lexer into the static cache and return a reference.
+        lexer_ptr->m_write_time = write_time;
         auto& emplaced = s_lexers.emplace_back(std::move(lexer_ptr));
         return std::ref(*emplaced);
     }
 
+    auto lexer::refresh_cache () -> void
+    {
+        // - Evict the lexers of files which have changed since they were read.
+        std::erase_if(s_lexers, [] (const std::unique_ptr<lexer>& lex)
+        {
+            if (lex->m_source_file.empty() == true)
+            {
+                return false;
+            }
+
+            std::error_code ec;
+            const auto write_time = fs::last_write_time(lex->m_source_file, ec);
+            return ec || write_time != lex->m_write_time;
+        });
+
+        // - If the cache is more than half full, evict the least recently used
+        //   lexers, so that the next module has room for its own.
+        if (s_lexers.size() > s_maximum_lexer_count / 2)
+        {
+            std::stable_sort(s_lexers.begin(), s_lexers.end(),
+                [] (const auto& lhs, const auto& rhs)
+                {
+                    return lhs->m_generation > rhs->m_generation;
+                });
+            s_lexers.resize(s_maximum_lexer_count / 2);
+        }
+
+        ++s_generation;
+    }
+
     auto lexer::reset_position () -> void
     {
         m_current_token = 0;
@@ -383,7 +443,8 @@ namespace g10asm
                     .lexeme = lexeme,
                     .source_file = m_source_file,
                     .source_line = m_current_line,
-                    .source_column = start_column
+                    .source_column = start_column,
+                    .symbol = symbol_table::intern(lexeme)
                 }
             );
         }
@@ -429,7 +490,8 @@ namespace g10asm
                 .lexeme = lexeme,
                 .source_file = m_source_file,
                 .source_line = m_current_line,
-                .source_column = start_column
+                .source_column = start_column,
+                .symbol = symbol_table::intern(lexeme.substr(1))
             }
         );
 
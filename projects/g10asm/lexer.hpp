@@ -39,9 +39,17 @@ namespace g10asm
          *                          this is the path to that file. If the
          *                          source code was not read from a file, this
          *                          may be left as the default empty path.
+         * @param   first_line      The line number of the source code's first
+         *                          line, if the source code is a portion of a
+         *                          larger file.
+         * @param   partial         Whether the source code is a portion of a
+         *                          larger file which continues after it, such
+         *                          that a `.macro` or `.rept` block may be left
+         *                          open at its end.
          */
         explicit lexer (const std::string& source_code,
-            const fs::path& source_file = "");
+            const fs::path& source_file = "", std::size_t first_line = 1,
+            bool partial = false);
 
         /**
          * @brief   This static method reserves space for the specified number
@@ -64,6 +72,32 @@ namespace g10asm
          */
         static auto from_file (const fs::path& source_file) -> g10::result_ref<lexer>;
 
+        /**
+         * @brief   Retrieves the list of all lexer instances created and cached
+         *          so far, in the order in which they were created.
+         *
+         * @return  A constant reference to the static lexer cache.
+         */
+        static inline auto get_cached_lexers ()
+            -> const std::vector<std::unique_ptr<lexer>>&
+            { return s_lexers; }
+
+        /**
+         * @brief   Prepares the static lexer cache for the assembly of another
+         *          module in the same process, as in the assembler's server
+         *          mode.
+         *
+         * Lexers whose source files have been modified or removed since they
+         * were lexed are evicted. If the cache is more than half full, the
+         * lexers least recently used are evicted as well. The lexers which
+         * remain are kept for reuse, but are not considered part of the next
+         * module until they are looked up again with `from_file`.
+         *
+         * This must only be called between modules, once no AST refers to
+         * the tokens of any cached lexer.
+         */
+        static auto refresh_cache () -> void;
+
         /**
          * @brief   Resets the lexer's current token position to the beginning
          *          of the token stream.
@@ -239,6 +273,17 @@ namespace g10asm
         inline auto is_at_end () const -> bool
             { return m_current_token >= m_tokens.size(); }
 
+        /**
+         * @brief   Checks if the lexer has been used in the assembly of the
+         *          current module, ie. if it was created or looked up since
+         *          the last call to `refresh_cache`.
+         *
+         * @return  `true` if the lexer belongs to the current module;
+         *          Otherwise, `false`.
+         */
+        inline auto is_in_current_module () const -> bool
+            { return m_generation == s_generation; }
+
     private: /* Private Methods ***********************************************/
 
         /**
@@ -451,6 +496,12 @@ namespace g10asm
          */
         static std::size_t s_maximum_lexer_count;
 
+        /**
+         * @brief   The number of times the lexer cache has been refreshed,
+         *          identifying the module currently being assembled.
+         */
+        static std::uint64_t s_generation;
+
         /**
          * @file    If the source code processed by this lexer was read from a
          *          file, this is the absolute, lexically-normalized path to
@@ -458,6 +509,19 @@ namespace g10asm
          */
         std::string m_source_file { "" };
 
+        /**
+         * @brief   If the source code processed by this lexer was read from a
+         *          file, this is the file's last modification time when it
+         *          was read.
+         */
+        fs::file_time_type m_write_time {};
+
+        /**
+         * @brief   The value of `s_generation` when this lexer was last
+         *          created or looked up.
+         */
+        std::uint64_t m_generation { s_generation };
+
         /**
          * @brief   The source code being processed by this lexer.
          */
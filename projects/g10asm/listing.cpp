@@ -0,0 +1,344 @@
+/**
+ * @file    g10asm/listing.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's listing file writer.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/cpu.hpp>
+#include <g10asm/listing.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The number of bytes shown on each line of the listing. Entries
+     *          with more bytes continue on the following lines.
+     */
+    constexpr std::size_t LISTING_BYTES_PER_LINE = 8;
+
+    /**
+     * @brief   The upper nibble shared by the opcodes of all branch
+     *          instructions (`JMP`, `JPB`, `CALL`, `INT`, `RET` and `RETI`).
+     */
+    constexpr std::uint16_t LISTING_BRANCH_CATEGORY = 0x4;
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10asm
+{
+    static auto format_bytes (std::span<const std::uint8_t> bytes)
+        -> std::string
+    {
+        std::string text = "";
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+        {
+            std::format_to(std::back_inserter(text), "{}{:02X}",
+                (i == 0) ? "" : " ", bytes[i]);
+        }
+
+        return text;
+    }
+
+    static auto format_cycles (std::uint32_t cycles, std::uint32_t taken_cycles)
+        -> std::string
+    {
+        return (cycles == taken_cycles) ?
+            std::format("{}", cycles) :
+            std::format("{}/{}", cycles, taken_cycles);
+    }
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto listing::write (
+        const fs::path& path,
+        const g10::object& object,
+        std::span<const listing_entry> entries
+    ) -> g10::result<void>
+    {
+        // - Group the entries by the source file they originated from, keeping
+        //   the files in the order they were first encountered.
+        std::vector<std::string_view> source_files;
+        std::unordered_map<std::string_view,
+            std::vector<const listing_entry*>> entries_by_file;
+        for (const auto& entry : entries)
+        {
+            auto& file_entries = entries_by_file[entry.node->source_file];
+            if (file_entries.empty() == true)
+            {
+                source_files.push_back(entry.node->source_file);
+            }
+
+            file_entries.push_back(&entry);
+        }
+
+        std::string out = "";
+        std::format_to(std::back_inserter(out),
+            "; G10 Assembler Listing\n"
+            "; Cycles are in M-cycles; branches are shown as 'not-taken/taken'.\n"
+        );
+
+        for (const auto& source_file : source_files)
+        {
+            if (auto result = write_source(out, source_file, object,
+                entries_by_file[source_file]); !result.has_value())
+            {
+                return g10::error(result.error());
+            }
+        }
+
+        write_label_totals(out, object, entries);
+
+        // - Write the listing to file.
+        std::ofstream file { path, std::ios::trunc };
+        if (file.is_open() == false)
+        {
+            return g10::error("Failed to open listing file '{}' for writing.",
+                path.string());
+        }
+
+        if (!file.write(out.data(), static_cast<std::streamsize>(out.size())))
+        {
+            return g10::error("Failed to write to listing file '{}'.",
+                path.string());
+        }
+
+        return {};
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10asm
+{
+    auto listing::bytes_of (
+        const g10::object& object,
+        const listing_entry& entry
+    ) -> std::span<const std::uint8_t>
+    {
+        const auto& sections = object.get_sections();
+        if (entry.section_index >= sections.size())
+        {
+            return {};
+        }
+
+        const auto& section = sections[entry.section_index];
+        if (section.type == g10::section_type::bss ||
+            entry.section_offset + entry.size > section.data.size())
+        {
+            return {};
+        }
+
+        return { section.data.data() + entry.section_offset, entry.size };
+    }
+
+    auto listing::timing_of (
+        const g10::object& object,
+        const listing_entry& entry
+    ) -> std::optional<g10::instruction_timing>
+    {
+        if (entry.node->type != ast_node_type::instruction)
+        {
+            return std::nullopt;
+        }
+
+        const auto bytes = bytes_of(object, entry);
+        if (bytes.size() < 2)
+        {
+            return std::nullopt;
+        }
+
+        const auto timing = g10::cpu::timing_of(g10::read_u16_le(bytes, 0));
+        if (timing.length == 0)
+        {
+            return std::nullopt;
+        }
+
+        return timing;
+    }
+
+    auto listing::write_source (
+        std::string& out,
+        std::string_view source_file,
+        const g10::object& object,
+        std::span<const listing_entry* const> entries
+    ) -> g10::result<void>
+    {
+        std::ifstream file { fs::path { source_file } };
+        if (file.is_open() == false)
+        {
+            return g10::error("Failed to open source file '{}' for listing.",
+                source_file);
+        }
+
+        std::format_to(std::back_inserter(out),
+            "\n; Source: {}\n"
+            "; {:<8}  {:<23}  {:>6}  {:>5}  {}\n",
+            source_file, "Address", "Bytes", "Cycles", "Line", "Source");
+
+        // - Entries from a file are placed in source order, except where a
+        //   file is included more than once; those placements are listed
+        //   together, under the line they originated from.
+        std::vector<const listing_entry*> sorted { entries.begin(), entries.end() };
+        std::stable_sort(sorted.begin(), sorted.end(),
+            [] (const listing_entry* lhs, const listing_entry* rhs)
+            {
+                return lhs->node->source_line < rhs->node->source_line;
+            });
+
+        std::size_t next = 0;
+        std::size_t line_number = 0;
+        std::string line = "";
+        while (std::getline(file, line))
+        {
+            ++line_number;
+            if (line.empty() == false && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+
+            // - Lines on which nothing was placed are listed without
+            //   annotations.
+            std::size_t first = next;
+            while (next < sorted.size() &&
+                sorted[next]->node->source_line == line_number)
+            {
+                ++next;
+            }
+
+            if (first == next)
+            {
+                std::format_to(std::back_inserter(out), "  {:<8}  {:<23}  {:>6}  {:>5}  {}\n",
+                    "", "", "", line_number, line);
+                continue;
+            }
+
+            // - A label which shares its line with a statement is annotated
+            //   by the statement. Otherwise, the label's address is shown.
+            bool has_statement = false;
+            for (std::size_t i = first; i < next; ++i)
+            {
+                has_statement |= (sorted[i]->node->type !=
+                    ast_node_type::label_definition);
+            }
+
+            bool source_shown = false;
+            for (std::size_t i = first; i < next; ++i)
+            {
+                const auto& entry = *sorted[i];
+                if (has_statement == true &&
+                    entry.node->type == ast_node_type::label_definition)
+                {
+                    continue;
+                }
+
+                const auto bytes = bytes_of(object, entry);
+                const auto timing = timing_of(object, entry);
+                const std::string cycles = timing.has_value() ?
+                    format_cycles(timing->cycles, timing->taken_cycles) : "";
+
+                std::format_to(std::back_inserter(out), "  {:08X}  {:<23}  {:>6}  {:>5}  {}\n",
+                    entry.address,
+                    format_bytes(bytes.first(
+                        std::min(bytes.size(), LISTING_BYTES_PER_LINE))),
+                    cycles,
+                    (source_shown == false) ? std::format("{}", line_number) : "",
+                    (source_shown == false) ? line : "");
+                source_shown = true;
+
+                // - Continue long runs of data on the following lines.
+                for (std::size_t offset = LISTING_BYTES_PER_LINE;
+                    offset < bytes.size(); offset += LISTING_BYTES_PER_LINE)
+                {
+                    std::format_to(std::back_inserter(out), "  {:08X}  {}\n",
+                        entry.address + offset,
+                        format_bytes(bytes.subspan(offset,
+                            std::min(bytes.size() - offset, LISTING_BYTES_PER_LINE))));
+                }
+            }
+        }
+
+        return {};
+    }
+
+    auto listing::write_label_totals (
+        std::string& out,
+        const g10::object& object,
+        std::span<const listing_entry> entries
+    ) -> void
+    {
+        std::format_to(std::back_inserter(out),
+            "\n; Label Totals (straight-line code, up to the first branch)\n"
+            "; {:<32}  {:>8}  {:>6}  {:>6}  {:>8}\n",
+            "Label", "Address", "Instrs", "Bytes", "Cycles");
+
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i].node->type != ast_node_type::label_definition)
+            {
+                continue;
+            }
+
+            const auto& label = entries[i];
+            std::size_t instruction_count = 0;
+            std::uint32_t byte_count = 0;
+            std::uint32_t cycles = 0;
+            std::uint32_t taken_cycles = 0;
+
+            // - Accumulate instructions until the next label, the first
+            //   branch, or the first break in straight-line placement.
+            std::uint32_t address = label.address;
+            for (std::size_t j = i + 1; j < entries.size(); ++j)
+            {
+                const auto& entry = entries[j];
+                if (entry.node->type == ast_node_type::label_definition ||
+                    entry.section_index != label.section_index ||
+                    entry.address != address)
+                {
+                    break;
+                }
+
+                const auto timing = timing_of(object, entry);
+                if (timing.has_value() == false)
+                {
+                    break;
+                }
+
+                instruction_count += 1;
+                byte_count += entry.size;
+                address += entry.size;
+                taken_cycles = cycles + timing->taken_cycles;
+                cycles += timing->cycles;
+
+                if ((g10::read_u16_le(bytes_of(object, entry), 0) >> 12) ==
+                    LISTING_BRANCH_CATEGORY)
+                {
+                    break;
+                }
+            }
+
+            if (instruction_count == 0)
+            {
+                continue;
+            }
+
+            const auto& label_node =
+                static_cast<const ast_label_definition&>(*label.node);
+            std::format_to(std::back_inserter(out),
+                "  {:<32}  {:08X}  {:>6}  {:>6}  {:>8}\n",
+                label_node.label_name,
+                label.address,
+                instruction_count,
+                byte_count,
+                format_cycles(cycles, taken_cycles));
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/**
+ * @file    g10asm/listing.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's listing file writer.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/object.hpp>
+#include <g10asm/codegen.hpp>
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's listing
+     *          file writer.
+     *
+     * A listing reproduces each source file which contributed to the module,
+     * line by line, annotated with the address at which the line's code or
+     * data was placed, the bytes emitted for it, and - for instructions - its
+     * execution time in M-cycles, as documented in the G10 CPU specification.
+     * Branch instructions whose timing depends on whether the branch is taken
+     * are shown as `not-taken/taken`.
+     *
+     * The listing ends with a table of per-label totals: for each label which
+     * begins a run of straight-line code, the number of instructions, bytes
+     * and M-cycles up to and including the first branch instruction, or up to
+     * the next label, whichever comes first.
+     */
+    class listing final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Writes a listing of the assembled module to the given file.
+         *
+         * @param   path        The path of the listing file to write.
+         * @param   object      The object file generated for the module.
+         * @param   entries     The listing entries recorded while generating
+         *                      the object file.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto write (
+            const fs::path& path,
+            const g10::object& object,
+            std::span<const listing_entry> entries
+        ) -> g10::result<void>;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Retrieves the bytes emitted for the given listing entry.
+         *
+         * @param   object  The object file generated for the module.
+         * @param   entry   The listing entry.
+         *
+         * @return  The entry's bytes, or an empty span if the entry reserved
+         *          space in an uninitialized (BSS) section.
+         */
+        static auto bytes_of (
+            const g10::object& object,
+            const listing_entry& entry
+        ) -> std::span<const std::uint8_t>;
+
+        /**
+         * @brief   Looks up the timing of the instruction emitted for the given
+         *          listing entry.
+         *
+         * @param   object  The object file generated for the module.
+         * @param   entry   The listing entry.
+         *
+         * @return  The instruction's timing, or `std::nullopt` if the entry is
+         *          not an instruction.
+         */
+        static auto timing_of (
+            const g10::object& object,
+            const listing_entry& entry
+        ) -> std::optional<g10::instruction_timing>;
+
+        /**
+         * @brief   Writes the lines of the given source file, annotated with
+         *          the listing entries placed on them.
+         *
+         * @param   out         The string to append the listing text to.
+         * @param   source_file The path of the source file.
+         * @param   object      The object file generated for the module.
+         * @param   entries     The listing entries originating from the source
+         *                      file.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto write_source (
+            std::string& out,
+            std::string_view source_file,
+            const g10::object& object,
+            std::span<const listing_entry* const> entries
+        ) -> g10::result<void>;
+
+        /**
+         * @brief   Writes the per-label totals for straight-line code.
+         *
+         * @param   out         The string to append the listing text to.
+         * @param   object      The object file generated for the module.
+         * @param   entries     All listing entries, in placement order.
+         */
+        static auto write_label_totals (
+            std::string& out,
+            const g10::object& object,
+            std::span<const listing_entry> entries
+        ) -> void;
+
+    };
+}
@@ -0,0 +1,692 @@
+/**
+ * @file    g10asm/macro_expander.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's macro expansion
+ *          component.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10asm/macro_expander.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The maximum depth to which expansions may produce further
+     *          expansions, guarding against macros which invoke themselves.
+     */
+    constexpr std::size_t MACRO_EXPANSION_MAX_DEPTH = 64;
+}
+
+/* Private Unions and Structures **********************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   A macro's body with one set of arguments substituted into it.
+     */
+    struct macro_expansion final
+    {
+        std::vector<token>          tokens;         /** @brief The substituted tokens. */
+        std::vector<std::size_t>    local_labels;   /** @brief Indices of the tokens naming local labels. */
+    };
+
+    /**
+     * @brief   A macro defined with the `.macro` directive.
+     */
+    struct macro_definition final
+    {
+        std::vector<std::string_view>   parameters;     /** @brief The names of the macro's parameters. */
+        std::vector<token>              body;           /** @brief The tokens of the macro's body. */
+        std::vector<symbol_id>          local_labels;   /** @brief The labels defined in the macro's body. */
+
+        /**
+         * @brief   The expansions of the macro produced so far, keyed by their
+         *          arguments.
+         */
+        std::unordered_map<std::string, macro_expansion> expansions;
+    };
+
+    /**
+     * @brief   A `.macro` or `.rept` block whose body is being collected.
+     */
+    struct macro_block final
+    {
+        directive_type                  kind;           /** @brief `directive_type::macro` or `directive_type::rept`. */
+        token                           directive;      /** @brief The directive which opened the block. */
+        symbol_id                       name;           /** @brief For `.macro`, the macro's name. */
+        std::vector<std::string_view>   parameters;     /** @brief For `.macro`, the names of its parameters. */
+        std::size_t                     count;          /** @brief For `.rept`, the number of repetitions. */
+        std::vector<token>              body;           /** @brief The tokens of the block's body. */
+        std::size_t                     nesting;        /** @brief The number of nested blocks of the same kind open. */
+    };
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10asm
+{
+    static auto directive_of (const token& tk) -> std::optional<directive_type>
+    {
+        if (tk.type != token_type::keyword ||
+            tk.keyword_value.has_value() == false ||
+            tk.keyword_value->get().type != keyword_type::assembler_directive)
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<directive_type>(tk.keyword_value->get().param1);
+    }
+
+    static auto is_block_directive (const token& tk) -> bool
+    {
+        const auto dir = directive_of(tk);
+        return dir == directive_type::macro || dir == directive_type::endm ||
+            dir == directive_type::rept || dir == directive_type::endr;
+    }
+
+    static auto is_end_of_line (std::span<const token> tokens, std::size_t index)
+        -> bool
+    {
+        return index >= tokens.size() ||
+            tokens[index].type == token_type::new_line ||
+            tokens[index].type == token_type::end_of_file;
+    }
+
+    static auto make_stable (token tk) -> token
+    {
+        // - Tokens kept beyond the lexer which produced them, as when a source
+        //   file is lexed in portions, must not refer to its source code.
+        tk.lexeme = symbol_table::name_of(symbol_table::intern(tk.lexeme));
+        tk.source_file = symbol_table::name_of(
+            symbol_table::intern(tk.source_file));
+        return tk;
+    }
+
+    static auto find_local_labels (std::span<const token> body)
+        -> std::vector<symbol_id>
+    {
+        // - A label is defined by an identifier at the start of a line,
+        //   followed by a colon.
+        std::vector<symbol_id> labels;
+        for (std::size_t i = 0; i + 1 < body.size(); ++i)
+        {
+            if (body[i].type == token_type::identifier &&
+                body[i + 1].type == token_type::colon &&
+                (i == 0 || body[i - 1].type == token_type::new_line) &&
+                std::ranges::find(labels, body[i].symbol) == labels.end())
+            {
+                labels.push_back(body[i].symbol);
+            }
+        }
+
+        return labels;
+    }
+}
+
+/* Private Classes ************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The macros and open block of a single source file.
+     */
+    class macro_context final
+    {
+    public:
+
+        /**
+         * @brief   Expands the given tokens, appending the result to the given
+         *          output.
+         *
+         * @param   input       The tokens to expand.
+         * @param   output      Receives the expanded tokens.
+         * @param   depth       The depth of the expansion producing the input,
+         *                      or `0` for the source file's own tokens.
+         * @param   partial     Whether a block may be left open at the end of
+         *                      the input.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        auto process (
+            std::span<const token> input,
+            std::vector<token>& output,
+            std::size_t depth,
+            bool partial
+        ) -> g10::result<void>
+        {
+            bool statement_start = true;
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                const token& tk = input[i];
+                if (tk.type == token_type::end_of_file)
+                {
+                    if (m_block.has_value() == true && partial == false)
+                    {
+                        return unterminated_block_error();
+                    }
+
+                    output.push_back(tk);
+                    continue;
+                }
+
+                // - While a block is open, collect its body until the directive
+                //   which closes it.
+                if (m_block.has_value() == true)
+                {
+                    if (collect(tk) == false)
+                    {
+                        continue;
+                    }
+
+                    if (is_end_of_line(input, i + 1) == false)
+                    {
+                        return g10::error(
+                            " - Unexpected '{}' after '{}'.\n"
+                            " - In file '{}:{}:{}'",
+                            input[i + 1].lexeme, tk.lexeme,
+                            input[i + 1].source_file,
+                            input[i + 1].source_line,
+                            input[i + 1].source_column);
+                    }
+
+                    if (auto result = close_block(output, depth);
+                        result.has_value() == false)
+                    {
+                        return g10::error(result.error());
+                    }
+
+                    continue;
+                }
+
+                const bool defines_label = tk.type == token_type::identifier &&
+                    i + 1 < input.size() &&
+                    input[i + 1].type == token_type::colon;
+
+                if (statement_start == true)
+                {
+                    const auto dir = directive_of(tk);
+                    if (dir == directive_type::macro ||
+                        dir == directive_type::rept)
+                    {
+                        if (auto result = open_block(input, i);
+                            result.has_value() == false)
+                        {
+                            return g10::error(result.error());
+                        }
+
+                        continue;
+                    }
+                    else if (dir == directive_type::endm ||
+                        dir == directive_type::endr)
+                    {
+                        return g10::error(
+                            " - '{}' without a matching '{}'.\n"
+                            " - In file '{}:{}:{}'",
+                            tk.lexeme,
+                            (dir == directive_type::endm) ? ".macro" : ".rept",
+                            tk.source_file, tk.source_line, tk.source_column);
+                    }
+
+                    if (tk.type == token_type::identifier &&
+                        defines_label == false &&
+                        m_macros.contains(tk.symbol) == true)
+                    {
+                        if (auto result = invoke(input, i, output, depth);
+                            result.has_value() == false)
+                        {
+                            return g10::error(result.error());
+                        }
+
+                        continue;
+                    }
+                }
+
+                output.push_back(tk);
+
+                // - A statement may follow a label on the same line.
+                statement_start = tk.type == token_type::new_line ||
+                    (statement_start == true && defines_label == true);
+                if (defines_label == true)
+                {
+                    output.push_back(input[++i]);
+                }
+            }
+
+            if (m_block.has_value() == true && (depth > 0 || partial == false))
+            {
+                return unterminated_block_error();
+            }
+
+            return {};
+        }
+
+    private:
+
+        auto unterminated_block_error () -> g10::result<void>
+        {
+            const token directive = m_block->directive;
+            m_block.reset();
+            return g10::error(
+                " - Unterminated '{}' block; expected '{}'.\n"
+                " - In file '{}:{}:{}'",
+                directive.lexeme,
+                (directive_of(directive) == directive_type::macro) ?
+                    ".endm" : ".endr",
+                directive.source_file,
+                directive.source_line,
+                directive.source_column);
+        }
+
+        auto open_block (std::span<const token> input, std::size_t& index)
+            -> g10::result<void>
+        {
+            const token& directive = input[index];
+            macro_block block {
+                .kind = directive_of(directive).value(),
+                .directive = make_stable(directive),
+                .name = INVALID_SYMBOL,
+                .parameters = {},
+                .count = 0,
+                .body = {},
+                .nesting = 0
+            };
+
+            std::size_t next = index + 1;
+            const auto unexpected = [&] (std::string_view expected)
+            {
+                const token& tk = (next < input.size()) ?
+                    input[next] : directive;
+                const std::string_view found = (tk.lexeme.empty() == true) ?
+                    "the end of the line" : tk.lexeme;
+                return g10::error(
+                    " - Expected {} after '{}', found '{}'.\n"
+                    " - In file '{}:{}:{}'",
+                    expected, directive.lexeme, found,
+                    tk.source_file, tk.source_line, tk.source_column);
+            };
+
+            if (block.kind == directive_type::macro)
+            {
+                // - `.macro NAME [param[, param]...]`
+                if (next >= input.size() ||
+                    input[next].type != token_type::identifier)
+                {
+                    return unexpected("a macro name");
+                }
+
+                block.name = input[next++].symbol;
+                while (is_end_of_line(input, next) == false)
+                {
+                    if (input[next].type != token_type::identifier)
+                    {
+                        return unexpected("a parameter name");
+                    }
+
+                    const auto parameter = symbol_table::name_of(
+                        input[next].symbol);
+                    if (std::ranges::find(block.parameters, parameter) !=
+                        block.parameters.end())
+                    {
+                        return g10::error(
+                            " - Duplicate macro parameter '{}'.\n"
+                            " - In file '{}:{}:{}'",
+                            parameter, input[next].source_file,
+                            input[next].source_line, input[next].source_column);
+                    }
+
+                    block.parameters.push_back(parameter);
+                    ++next;
+
+                    if (is_end_of_line(input, next) == false &&
+                        input[next++].type != token_type::comma)
+                    {
+                        --next;
+                        return unexpected("',' or the end of the line");
+                    }
+                }
+            }
+            else
+            {
+                // - `.rept COUNT`
+                if (next >= input.size() ||
+                    input[next].type != token_type::integer_literal ||
+                    input[next].int_value.has_value() == false ||
+                    input[next].int_value.value() < 0)
+                {
+                    return unexpected("a non-negative integer repeat count");
+                }
+
+                block.count = static_cast<std::size_t>(
+                    input[next++].int_value.value());
+                if (is_end_of_line(input, next) == false)
+                {
+                    return unexpected("the end of the line");
+                }
+            }
+
+            // - Skip the header line's newline, so the body starts on the next
+            //   line. An end-of-file token is left to be seen by the caller.
+            m_block = std::move(block);
+            index = (next < input.size() &&
+                input[next].type == token_type::new_line) ? next : next - 1;
+            return {};
+        }
+
+        auto collect (const token& tk) -> bool
+        {
+            const auto dir = directive_of(tk);
+            const bool is_macro = (m_block->kind == directive_type::macro);
+            if (dir == (is_macro ? directive_type::macro : directive_type::rept))
+            {
+                ++m_block->nesting;
+            }
+            else if (dir == (is_macro ? directive_type::endm : directive_type::endr))
+            {
+                if (m_block->nesting == 0)
+                {
+                    return true;
+                }
+
+                --m_block->nesting;
+            }
+
+            m_block->body.push_back(make_stable(tk));
+            return false;
+        }
+
+        auto close_block (std::vector<token>& output, std::size_t depth)
+            -> g10::result<void>
+        {
+            macro_block block = std::move(m_block.value());
+            m_block.reset();
+
+            const auto local_labels = find_local_labels(block.body);
+            if (block.kind == directive_type::macro)
+            {
+                m_macros.insert_or_assign(block.name, macro_definition {
+                    .parameters = std::move(block.parameters),
+                    .body = std::move(block.body),
+                    .local_labels = local_labels,
+                    .expansions = {}
+                });
+
+                return {};
+            }
+
+            std::vector<std::size_t> label_indices;
+            for (std::size_t i = 0; i < block.body.size(); ++i)
+            {
+                if (block.body[i].type == token_type::identifier &&
+                    std::ranges::find(local_labels, block.body[i].symbol) !=
+                        local_labels.end())
+                {
+                    label_indices.push_back(i);
+                }
+            }
+
+            for (std::size_t i = 0; i < block.count; ++i)
+            {
+                if (auto result = instantiate(block.body, label_indices,
+                        block.directive, output, depth);
+                    result.has_value() == false)
+                {
+                    return g10::error(result.error());
+                }
+            }
+
+            return {};
+        }
+
+        auto invoke (
+            std::span<const token> input,
+            std::size_t& index,
+            std::vector<token>& output,
+            std::size_t depth
+        ) -> g10::result<void>
+        {
+            const token& origin = input[index];
+            macro_definition& definition = m_macros.find(origin.symbol)->second;
+
+            // - Split the rest of the line into arguments, at the commas which
+            //   are not enclosed in parentheses, brackets or braces.
+            std::vector<std::span<const token>> arguments;
+            std::size_t next = index + 1;
+            std::size_t start = next;
+            std::size_t nesting = 0;
+            for (; is_end_of_line(input, next) == false; ++next)
+            {
+                switch (input[next].type)
+                {
+                    case token_type::left_parenthesis:
+                    case token_type::left_bracket:
+                    case token_type::left_brace:
+                        ++nesting;
+                        break;
+
+                    case token_type::right_parenthesis:
+                    case token_type::right_bracket:
+                    case token_type::right_brace:
+                        nesting -= (nesting > 0) ? 1 : 0;
+                        break;
+
+                    case token_type::comma:
+                        if (nesting == 0)
+                        {
+                            arguments.push_back(
+                                input.subspan(start, next - start));
+                            start = next + 1;
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            if (next > index + 1)
+            {
+                arguments.push_back(input.subspan(start, next - start));
+            }
+
+            if (std::ranges::any_of(arguments, &std::span<const token>::empty))
+            {
+                return g10::error(
+                    " - Empty argument in invocation of macro '{}'.\n"
+                    " - In file '{}:{}:{}'",
+                    origin.lexeme, origin.source_file, origin.source_line,
+                    origin.source_column);
+            }
+            else if (arguments.size() != definition.parameters.size())
+            {
+                return g10::error(
+                    " - Macro '{}' expects {} argument(s), but {} were given.\n"
+                    " - In file '{}:{}:{}'",
+                    origin.lexeme, definition.parameters.size(),
+                    arguments.size(), origin.source_file, origin.source_line,
+                    origin.source_column);
+            }
+
+            // - Substitute the arguments into the macro's body, unless it has
+            //   been expanded with the same arguments before.
+            std::string key = "";
+            for (const auto& argument : arguments)
+            {
+                for (const token& tk : argument)
+                {
+                    key += tk.lexeme;
+                    key += '\x1F';
+                }
+
+                key += '\x1E';
+            }
+
+            auto [it, inserted] = definition.expansions.try_emplace(
+                std::move(key));
+            macro_expansion& expansion = it->second;
+            if (inserted == true)
+            {
+                substitute(definition, arguments, expansion);
+            }
+
+            // - Leave the line's newline to be seen by the caller.
+            index = next - 1;
+            return instantiate(expansion.tokens, expansion.local_labels,
+                origin, output, depth);
+        }
+
+        auto substitute (
+            const macro_definition& definition,
+            std::span<const std::span<const token>> arguments,
+            macro_expansion& expansion
+        ) -> void
+        {
+            for (const token& tk : definition.body)
+            {
+                if (tk.type == token_type::placeholder ||
+                    tk.type == token_type::placeholder_keyword)
+                {
+                    // - Placeholders name a parameter, or its position.
+                    const auto name = tk.lexeme.substr(1);
+                    auto parameter = std::ranges::find(definition.parameters,
+                        name);
+                    std::size_t position = static_cast<std::size_t>(
+                        parameter - definition.parameters.begin());
+                    if (parameter == definition.parameters.end())
+                    {
+                        position = 0;
+                        for (const char ch : name)
+                        {
+                            position = (std::isdigit(ch) != 0 &&
+                                position < arguments.size()) ?
+                                position * 10 + static_cast<std::size_t>(ch - '0') :
+                                arguments.size() + 1;
+                        }
+
+                        position = (position > 0) ? position - 1 : arguments.size();
+                    }
+
+                    if (position < arguments.size())
+                    {
+                        for (const token& argument_tk : arguments[position])
+                        {
+                            expansion.tokens.push_back(
+                                make_stable(argument_tk));
+                        }
+
+                        continue;
+                    }
+                }
+                else if (tk.type == token_type::identifier &&
+                    std::ranges::find(definition.local_labels, tk.symbol) !=
+                        definition.local_labels.end())
+                {
+                    expansion.local_labels.push_back(expansion.tokens.size());
+                }
+
+                expansion.tokens.push_back(tk);
+            }
+        }
+
+        auto instantiate (
+            std::vector<token> tokens,
+            std::span<const std::size_t> local_labels,
+            const token& origin,
+            std::vector<token>& output,
+            std::size_t depth
+        ) -> g10::result<void>
+        {
+            if (depth >= MACRO_EXPANSION_MAX_DEPTH)
+            {
+                return g10::error(
+                    " - Macro expansion nested more than {} levels deep.\n"
+                    " - In file '{}:{}:{}'",
+                    MACRO_EXPANSION_MAX_DEPTH, origin.source_file,
+                    origin.source_line, origin.source_column);
+            }
+
+            // - Give this expansion its own copy of each local label.
+            const std::uint64_t expansion_id = ++m_expansion_count;
+            for (const std::size_t index : local_labels)
+            {
+                token& tk = tokens[index];
+                tk.symbol = symbol_table::intern(std::format("{}.{}",
+                    symbol_table::name_of(tk.symbol), expansion_id));
+                tk.lexeme = symbol_table::name_of(tk.symbol);
+            }
+
+            for (token& tk : tokens)
+            {
+                tk.source_file = origin.source_file;
+                tk.source_line = origin.source_line;
+                tk.source_column = origin.source_column;
+            }
+
+            return process(tokens, output, depth + 1, false);
+        }
+
+        std::unordered_map<symbol_id, macro_definition> m_macros;
+        std::optional<macro_block>  m_block = std::nullopt;
+        std::uint64_t               m_expansion_count = 0;
+
+    };
+}
+
+/* Private Static Variables ***************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The macro contexts of the source files being expanded, keyed by
+     *          their paths. A context outlives a single call to `expand` only
+     *          while its source file is being lexed in portions.
+     */
+    static std::unordered_map<std::string, macro_context> s_contexts;
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto macro_expander::expand (
+        std::vector<token>& tokens,
+        std::string_view source_file,
+        bool continued,
+        bool partial
+    ) -> g10::result<void>
+    {
+        const std::string key { source_file };
+        if (continued == false)
+        {
+            s_contexts.erase(key);
+        }
+
+        // - Most sources use no macros at all; leave their tokens be.
+        if (s_contexts.contains(key) == false &&
+            std::ranges::none_of(tokens, is_block_directive) == true)
+        {
+            return {};
+        }
+
+        std::vector<token> output;
+        output.reserve(tokens.size());
+        auto result = s_contexts[key].process(tokens, output, 0, partial);
+        if (partial == false || result.has_value() == false)
+        {
+            s_contexts.erase(key);
+        }
+
+        if (result.has_value() == false)
+        {
+            return g10::error(result.error());
+        }
+
+        tokens = std::move(output);
+        return {};
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    g10asm/macro_expander.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's macro expansion
+ *          component.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10asm/token.hpp>
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's macro
+     *          expansion component.
+     *
+     * Macros are expanded at the token level, between lexing and parsing. The
+     * expander recognizes the following blocks, each of which must begin and
+     * end on a line of its own:
+     *
+     * - `.macro NAME [param[, param]...]` ... `.endm` defines a macro. Within
+     *   the macro's body, the placeholder `@param` stands for the tokens of the
+     *   corresponding argument, and `@1`, `@2`, etc. for the arguments by
+     *   position. A line beginning with `NAME arg[, arg]...` invokes the macro.
+     *
+     * - `.rept COUNT` ... `.endr` repeats its body `COUNT` times, where `COUNT`
+     *   is an integer literal (or a placeholder which expands to one).
+     *
+     * Each macro invocation and each `.rept` iteration is an expansion. Labels
+     * defined within a block's body are local to each expansion: they are
+     * renamed, in the form `label.N`, with a number unique to the expansion.
+     * The tokens of an expansion report the location of the invocation or the
+     * `.rept` directive which produced them. Expansions may contain further
+     * invocations and blocks, up to a fixed depth.
+     *
+     * The substituted body of a macro is cached per distinct set of arguments,
+     * so a macro invoked repeatedly with the same arguments is only
+     * substituted once; only the renaming of its local labels is repeated.
+     *
+     * Macros are visible from their definition to the end of the source file
+     * which defines them. A source file lexed in portions, as by the
+     * assembler's `--stream` mode, shares its macros, and any block left open
+     * at the end of one portion, with the portions which follow it.
+     */
+    class macro_expander final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Expands the macro definitions, invocations and `.rept`
+         *          blocks in the given token list, in place.
+         *
+         * @param   tokens          The tokens produced by lexing a source file,
+         *                          or a portion of one, ending with an
+         *                          end-of-file token.
+         * @param   source_file     The path of the source file, as reported by
+         *                          its tokens.
+         * @param   continued       Whether the tokens continue a portion of the
+         *                          same source file expanded previously, whose
+         *                          macros remain visible.
+         * @param   partial         Whether more portions of the source file are
+         *                          to follow the tokens, such that a block left
+         *                          open at their end is not an error.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto expand (
+            std::vector<token>& tokens,
+            std::string_view source_file,
+            bool continued,
+            bool partial
+        ) -> g10::result<void>;
+
+    };
+}
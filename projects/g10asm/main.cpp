@@ -9,9 +9,13 @@
 /* Private Includes ***********************************************************/
 
 #include <g10/common.hpp>
+#include <g10/time_report.hpp>
 #include <g10asm/lexer.hpp>
 #include <g10asm/parser.hpp>
 #include <g10asm/codegen.hpp>
+#include <g10asm/listing.hpp>
+#include <g10asm/object_cache.hpp>
+#include <g10asm/server.hpp>
 
 /* Private Static Variables ***************************************************/
 
@@ -26,6 +30,15 @@ namespace g10asm
     static std::size_t s_lexer_count = 32;  // `-l <count>`, `--lexers <count>` - Number of lexers to reserve. Minimum 32.
     static bool s_lex_only = false;         // `--lex-only` - Only perform lexical analysis on this file
     static bool s_parse_only = false;       // `--parse-only` - Only perform parsing on this file (and included files), and output the AST
+    static bool s_optimize = false;         // `-O`, `--optimize` - Run the peephole optimizer before emitting code
+    static bool s_stream = false;           // `--stream` - Assemble the source file in bounded memory, chunk by chunk
+    static std::optional<std::size_t> s_parallel_min_nodes = std::nullopt; // `--parallel-min-nodes <count>` - Emit sections concurrently in modules at least this large
+    static std::string s_listing_file = ""; // `--listing <file>` - Write an annotated listing of the assembled code to this file
+    static bool s_time_report = false;      // `--time-report` - Show the time and memory spent in each phase
+    static std::string s_cache_dir = "";    // `--cache-dir <dir>` - Enable the object cache, storing entries in this directory
+    static std::uintmax_t s_cache_size = OBJECT_CACHE_DEFAULT_SIZE; // `--cache-size <MiB>` - Maximum object cache size
+    static bool s_server = false;           // `--server` - Run assembly jobs received on stdin or a socket
+    static std::string s_socket_file = "";  // `--socket <path>` - Receive server jobs on this Unix domain socket
 }
 
 /* Private Functions **********************************************************/
@@ -97,6 +110,67 @@ namespace g10asm
                     return false;
                 }
             }
+            else if (arg == "-O" || arg == "--optimize")
+            {
+                s_optimize = true;
+            }
+            else if (arg == "--stream")
+            {
+                s_stream = true;
+            }
+            else if (arg == "--parallel-min-nodes")
+            {
+                if (i + 1 < argc)
+                {
+                    try
+                    {
+                        s_parallel_min_nodes = std::stoul(argv[++i]);
+                    }
+                    catch (const std::exception&)
+                    {
+                        std::println(stderr, "Error: Invalid node count '{}' after '{}'.",
+                            argv[i], arg);
+                        return false;
+                    }
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing node count after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--listing")
+            {
+                if (i + 1 < argc)
+                {
+                    s_listing_file = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing listing file after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--server")
+            {
+                s_server = true;
+            }
+            else if (arg == "--socket")
+            {
+                if (i + 1 < argc)
+                {
+                    s_socket_file = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing socket path after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--time-report")
+            {
+                s_time_report = true;
+            }
             else if (arg == "--lex-only")
             {
                 s_lex_only = true;
@@ -105,6 +179,39 @@ namespace g10asm
             {
                 s_parse_only = true;
             }
+            else if (arg == "--cache-dir")
+            {
+                if (i + 1 < argc)
+                {
+                    s_cache_dir = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing cache directory after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--cache-size")
+            {
+                if (i + 1 < argc)
+                {
+                    try
+                    {
+                        s_cache_size = std::stoull(argv[++i]) * 1024 * 1024;
+                    }
+                    catch (const std::exception&)
+                    {
+                        std::println(stderr, "Error: Invalid cache size '{}' after '{}'.",
+                            argv[i], arg);
+                        return false;
+                    }
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing cache size after '{}'.", arg);
+                    return false;
+                }
+            }
             else
             {
                 std::println(stderr, "Error: Unknown argument '{}'.", arg);
@@ -118,6 +225,28 @@ namespace g10asm
             return true;
         }
 
+        // - The server receives its source and output files with each job.
+        if (s_server == true)
+        {
+            return true;
+        }
+        else if (s_socket_file.empty() == false)
+        {
+            std::println(stderr, "Error: '--socket' requires '--server'.");
+            return false;
+        }
+
+        // - Streaming mode never holds the whole module, so it cannot show
+        //   it, list it, or hash it for the object cache.
+        if (s_stream == true && (s_lex_only == true || s_parse_only == true ||
+            s_listing_file.empty() == false || s_cache_dir.empty() == false))
+        {
+            std::println(stderr,
+                "Error: '--stream' cannot be combined with '--lex-only', '--parse-only', "
+                "'--listing' or '--cache-dir'.");
+            return false;
+        }
+
         // - Validate required arguments.
         if (s_source_file.empty() == true)
         {
@@ -139,6 +268,30 @@ namespace g10asm
         return true;
     }
 
+    static auto reset_arguments () -> void
+    {
+        s_source_file = "";
+        s_output_file = "";
+        s_help = false;
+        s_version = false;
+        s_verbose = false;
+        s_lex_only = false;
+        s_parse_only = false;
+        s_optimize = false;
+        s_stream = false;
+        s_parallel_min_nodes = std::nullopt;
+        s_listing_file = "";
+        s_time_report = false;
+        s_cache_dir = "";
+        s_cache_size = OBJECT_CACHE_DEFAULT_SIZE;
+        s_server = false;
+        s_socket_file = "";
+
+        // - Undo the effects of the previous job's options.
+        object_cache::disable();
+        g10::time_report::reset();
+    }
+
     static auto show_version () -> void
     {
         std::println(
@@ -158,12 +311,54 @@ namespace g10asm
             "  -v, --version           Show version information and exit.\n"
             "      --verbose           Enable verbose output during assembly.\n"
             "  -l, --lexers <count>    Specify the number of lexers to reserve (minimum 32).\n"
+            "  -O, --optimize          Rewrite instructions into cheaper equivalents before emitting code.\n"
+            "                          Each rewrite is reported if '--verbose' is also specified.\n"
+            "      --stream            Read, assemble and discard the source file a chunk at a time, keeping\n"
+            "                          only symbols, unresolved references and the generated code in\n"
+            "                          memory. Forward 'JP' branches always use their long form in this\n"
+            "                          mode.\n"
+            "      --parallel-min-nodes <count>\n"
+            "                          Emit the sections of a module spanning several sections on\n"
+            "                          separate threads if it has at least this many top-level\n"
+            "                          statements (default 4096 on multi-core machines; 0 disables).\n"
+            "      --listing <file>    Write a listing of each source line with its address, bytes and\n"
+            "                          M-cycle cost, followed by per-label totals, to this file.\n"
+            "      --time-report       Show the wall time and heap allocations of each assembly phase,\n"
+            "                          and the peak memory usage.\n"
             "      --lex-only          Only perform lexical analysis on the source file and display the tokens.\n"
             "      --parse-only        Only perform parsing on the source file and display the AST.\n"
             "                          Ignored if '--lex-only' is also specified.\n"
+            "      --cache-dir <dir>   Reuse previously assembled objects stored in this directory,\n"
+            "                          and store newly assembled objects there.\n"
+            "      --cache-size <MiB>  Specify the maximum size of the object cache (default 256).\n"
+            "      --server            Stay running, and assemble each job received on standard input.\n"
+            "                          A job is its arguments, one per line, followed by an empty line;\n"
+            "                          each is answered with 'status <code> <length>' and its output.\n"
+            "      --socket <path>     With '--server', receive jobs over this Unix domain socket instead.\n"
         );
     }
 
+    static auto cache_options () -> std::string
+    {
+        // - Any option which affects the generated object file must be
+        //   described here, so that it contributes to the object cache key.
+        std::string options = "";
+        if (s_optimize == true) { options += "-O "; }
+
+        return options;
+    }
+
+    static auto save_object (g10::object& object_file) -> g10::result<bool>
+    {
+        // - An earlier run with the object cache enabled may have left the
+        //   output file as a hard link to a cache entry. Remove it rather than
+        //   writing through the link, whether or not the cache is enabled now.
+        std::error_code ec;
+        fs::remove(s_output_file, ec);
+
+        return object_file.save_to_file(s_output_file);
+    }
+
     static auto show_lexer_output (const lexer& lex) -> void
     {   
         const auto& tokens = lex.get_tokens();
@@ -181,6 +376,237 @@ namespace g10asm
         std::println("AST output for file '{}':", s_source_file);
         std::println("{}", g10asm::ast_to_string(ast_root));
     }
+
+    static auto assemble_stream () -> int
+    {
+        // - Assemble the source file, a chunk at a time.
+        auto codegen_result = codegen::process_stream(s_source_file, {
+            .optimize = s_optimize,
+            .verbose = s_verbose
+        });
+        if (codegen_result.has_value() == false)
+        {
+            return 1;
+        }
+
+        // - Save the object file to the specified output file.
+        auto save_result = [&codegen_result] ()
+        {
+            g10::time_report::phase timer { "Save object" };
+            return save_object(codegen_result.value());
+        }();
+        if (save_result.has_value() == false)
+        {
+            return 1;
+        }
+
+        // - Show the time report, if requested.
+        if (g10::time_report::is_enabled() == true)
+        {
+            g10::time_report::print(stdout);
+        }
+
+        return 0;
+    }
+
+    static auto assemble (const char* executable) -> int
+    {
+        // - Enable the time report, if requested.
+        if (s_time_report == true)
+        {
+            g10::time_report::enable();
+        }
+
+        // - In streaming mode, the source file is lexed, parsed and assembled
+        //   a chunk at a time, bypassing the lexer cache.
+        if (s_stream == true)
+        {
+            return assemble_stream();
+        }
+
+        // - Reserve lexers as specified.
+        lexer::reserve_lexers(s_lexer_count);
+
+        // - Create a lexer for the source file.
+        auto lex_result = [] ()
+        {
+            g10::time_report::phase timer { "Lexing" };
+            return lexer::from_file(s_source_file);
+        }();
+        if (lex_result.has_value() == false)
+        {
+            return 1;
+        }
+
+        // - Get the lexer. If `--lex-only` is specified, show the lexer output
+        //   and exit early.
+        auto& lex = lex_result.value().get();
+        if (s_lex_only == true)
+        {
+            show_lexer_output(lex);
+            return 0;
+        }
+
+        // - If the object cache is enabled, and this module has been assembled
+        //   before, reuse the cached object file and skip the remaining stages.
+        std::string cache_key = "";
+        if (s_cache_dir.empty() == false && s_parse_only == false)
+        {
+            auto enable_result = object_cache::enable(
+                s_cache_dir,
+                s_cache_size,
+                executable
+            );
+            if (enable_result.has_value() == false)
+            {
+                std::println(stderr, "Error: {}", enable_result.error());
+                return 1;
+            }
+
+            // - A listing can only be produced by generating code, so the cache
+            //   is not consulted if one is requested.
+            auto lookup_result = [&lex, &cache_key] ()
+            {
+                g10::time_report::phase timer { "Object cache lookup" };
+                cache_key = object_cache::compute_key(lex,
+                    cache_options());
+                return s_listing_file.empty() ?
+                    object_cache::lookup(cache_key, s_output_file) :
+                    g10::result<bool> { false };
+            }();
+            if (lookup_result.has_value() == false)
+            {
+                std::println(stderr, "Error: {}", lookup_result.error());
+                return 1;
+            }
+            else if (lookup_result.value() == true)
+            {
+                if (s_verbose == true)
+                {
+                    std::println("Object cache hit: '{}' ({}).",
+                        s_output_file, cache_key);
+                }
+
+                if (g10::time_report::is_enabled() == true)
+                {
+                    g10::time_report::print(stdout);
+                }
+
+                return 0;
+            }
+        }
+
+        // - Parse the source file into an AST.
+        auto parse_result = [&lex] ()
+        {
+            g10::time_report::phase timer { "Parsing" };
+            return parser::parse(lex);
+        }();
+        if (parse_result.has_value() == false)
+        {
+            return 1;
+        }
+        auto& ast_root = parse_result.value();
+
+        // - If `--parse-only` is specified, show the AST output and exit early.
+        if (s_parse_only == true)
+        {
+            show_ast_output(ast_root);
+            return 0;
+        }
+
+        // - Generate machine code from the AST.
+        std::vector<listing_entry> listing_entries;
+        auto codegen_result = codegen::process(ast_root, {
+            .optimize = s_optimize,
+            .verbose = s_verbose,
+            .listing = s_listing_file.empty() ? nullptr : &listing_entries,
+            .parallel_min_nodes = s_parallel_min_nodes
+        });
+        if (codegen_result.has_value() == false)
+        {
+            return 1;
+        }
+
+        // - Get the generated object file.
+        auto& object_file = codegen_result.value();
+
+        // - Save the object file to the specified output file.
+        auto save_result = [&object_file] ()
+        {
+            g10::time_report::phase timer { "Save object" };
+            return save_object(object_file);
+        }();
+        if (save_result.has_value() == false)
+        {
+            return 1;
+        }
+
+        // - Write the listing file, if requested.
+        if (s_listing_file.empty() == false)
+        {
+            g10::time_report::phase timer { "Write listing" };
+            auto listing_result = listing::write(s_listing_file,
+                object_file, listing_entries);
+            if (listing_result.has_value() == false)
+            {
+                std::println(stderr, "Error: {}", listing_result.error());
+                return 1;
+            }
+        }
+
+        // - Store the new object file in the cache, if enabled. A failure here
+        //   is not fatal, as the object file itself was written successfully.
+        if (object_cache::is_enabled() == true)
+        {
+            auto store_result = object_cache::store(cache_key,
+                s_output_file);
+            if (store_result.has_value() == false)
+            {
+                std::println(stderr, "Warning: {}", store_result.error());
+            }
+        }
+
+        // - Show the time report, if requested.
+        if (g10::time_report::is_enabled() == true)
+        {
+            g10::time_report::print(stdout);
+        }
+
+        return 0;
+    }
+
+    static auto run_job (const char* executable,
+        std::span<const std::string> arguments) -> int
+    {
+        // - Parse the job's arguments as if they were given on the command
+        //   line, starting from the default options.
+        reset_arguments();
+
+        std::vector<const char*> job_argv { executable };
+        for (const auto& argument : arguments)
+        {
+            job_argv.push_back(argument.c_str());
+        }
+
+        if (parse_arguments(static_cast<int>(job_argv.size()), job_argv.data()) == false)
+        {
+            return 1;
+        }
+        else if (s_server == true)
+        {
+            std::println(stderr, "Error: '--server' cannot be given to a server job.");
+            return 1;
+        }
+        else if (s_help == true || s_version == true)
+        {
+            show_version();
+            if (s_help == true) { show_help(); }
+            return 0;
+        }
+
+        return assemble(executable);
+    }
 }
 
 /* Main Function **************************************************************/
@@ -206,56 +632,23 @@ auto main (int argc, const char** argv) -> int
         return 0;
     }
 
-    // - Reserve lexers as specified.
-    g10asm::lexer::reserve_lexers(g10asm::s_lexer_count);
-
-    // - Create a lexer for the source file.
-    auto lex_result = g10asm::lexer::from_file(g10asm::s_source_file);
-    if (lex_result.has_value() == false)
+    // - Run the assembler server, if requested.
+    if (g10asm::s_server == true)
     {
-        return 1;
-    }
-
-    // - Get the lexer. If `--lex-only` is specified, show the lexer output and
-    //   exit early.
-    auto& lex = lex_result.value().get();
-    if (g10asm::s_lex_only == true)
-    {
-        g10asm::show_lexer_output(lex);
-        return 0;
-    }
-
-    // - Parse the source file into an AST.
-    auto parse_result = g10asm::parser::parse(lex);
-    if (parse_result.has_value() == false)
-    {
-        return 1;
-    }
-    auto& ast_root = parse_result.value();
+        const char* executable = (argc > 0) ? argv[0] : "";
+        auto server_result = g10asm::server::run(g10asm::s_socket_file,
+            [executable] (std::span<const std::string> arguments)
+            {
+                return g10asm::run_job(executable, arguments);
+            });
+        if (server_result.has_value() == false)
+        {
+            std::println(stderr, "Error: {}", server_result.error());
+            return 1;
+        }
 
-    // - If `--parse-only` is specified, show the AST output and exit early.
-    if (g10asm::s_parse_only == true)
-    {
-        g10asm::show_ast_output(ast_root);
         return 0;
     }
 
-    // - Generate machine code from the AST.
-    auto codegen_result = g10asm::codegen::process(ast_root);
-    if (codegen_result.has_value() == false)
-    {
-        return 1;
-    }
-
-    // - Get the generated object file.
-    auto& object_file = codegen_result.value();
-
-    // - Save the object file to the specified output file.
-    auto save_result = object_file.save_to_file(g10asm::s_output_file);
-    if (save_result.has_value() == false)
-    {
-        return 1;
-    }
-
-    return 0;
+    return g10asm::assemble((argc > 0) ? argv[0] : "");
 }
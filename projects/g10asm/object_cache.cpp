@@ -0,0 +1,332 @@
+/**
+ * @file    g10asm/object_cache.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the G10 assembler's content-addressed
+ *          object file cache.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10/object.hpp>
+#include <g10asm/object_cache.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    // - FNV-1a 64-bit parameters. The second offset basis seeds the stream
+    //   producing the upper half of the cache key.
+    constexpr std::uint64_t FNV_PRIME           = 0x00000100000001B3ull;
+    constexpr std::uint64_t FNV_OFFSET_BASIS_LO = 0xCBF29CE484222325ull;
+    constexpr std::uint64_t FNV_OFFSET_BASIS_HI = 0x84222325CBF29CE4ull;
+}
+
+/* Private Unions and Structures **********************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Accumulates a 128-bit cache key from two FNV-1a 64-bit streams.
+     *
+     * Both streams hash the same bytes, differing only in their offset basis
+     * and in a constant mixed into each byte of the upper stream. They are not
+     * independent hashes, so the key is not much stronger than a single 64-bit
+     * FNV-1a hash; it is meant to tell apart the sources of one project, not
+     * to withstand inputs crafted to collide.
+     */
+    struct cache_hasher final
+    {
+        std::uint64_t lo = FNV_OFFSET_BASIS_LO;
+        std::uint64_t hi = FNV_OFFSET_BASIS_HI;
+
+        auto update (const void* data, std::size_t size) -> void
+        {
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                lo = (lo ^ bytes[i]) * FNV_PRIME;
+                hi = (hi ^ bytes[i] ^ 0x5A) * FNV_PRIME;
+            }
+        }
+
+        auto update (std::string_view str) -> void
+        {
+            // - Length-prefix strings so that adjacent fields cannot alias.
+            const std::uint64_t length = str.size();
+            update(&length, sizeof(length));
+            update(str.data(), str.size());
+        }
+
+        template <typename T>
+            requires std::is_integral_v<T> || std::is_enum_v<T>
+        auto update (T value) -> void
+        {
+            update(&value, sizeof(value));
+        }
+
+        auto to_string () const -> std::string
+        {
+            return std::format("{:016x}{:016x}", hi, lo);
+        }
+    };
+}
+
+/* Private Static Members *****************************************************/
+
+namespace g10asm
+{
+    fs::path        object_cache::s_cache_dir;
+    std::uintmax_t  object_cache::s_max_size = OBJECT_CACHE_DEFAULT_SIZE;
+    std::string     object_cache::s_tool_identity;
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto object_cache::enable (
+        const fs::path& cache_dir,
+        std::uintmax_t max_size,
+        const fs::path& executable
+    ) -> g10::result<void>
+    {
+        // - Create the cache directory if it does not exist.
+        std::error_code ec;
+        fs::create_directories(cache_dir, ec);
+        if (ec || fs::is_directory(cache_dir) == false)
+        {
+            return g10::error(
+                "Could not create object cache directory '{}': {}",
+                cache_dir.string(),
+                ec ? ec.message() : "Path is not a directory."
+            );
+        }
+
+        s_cache_dir = cache_dir;
+        s_max_size = max_size;
+
+        // - Identify the running assembler build by its executable's size and
+        //   modification time. If the executable cannot be found, fall back to
+        //   the build date of this translation unit.
+        s_tool_identity = std::format("{} {}", __DATE__, __TIME__);
+        if (executable.empty() == false && fs::is_regular_file(executable, ec))
+        {
+            const auto size = fs::file_size(executable, ec);
+            const auto mtime = fs::last_write_time(executable, ec);
+            if (!ec)
+            {
+                s_tool_identity = std::format("{}:{}",
+                    size, mtime.time_since_epoch().count());
+            }
+        }
+
+        return {};
+    }
+
+    auto object_cache::disable () -> void
+    {
+        s_cache_dir.clear();
+    }
+
+    auto object_cache::is_enabled () -> bool
+    {
+        return s_cache_dir.empty() == false;
+    }
+
+    auto object_cache::compute_key (
+        const lexer& lex,
+        std::string_view options
+    ) -> std::string
+    {
+        cache_hasher hasher;
+
+        // - Assembler build, object format version and options.
+        hasher.update(s_tool_identity);
+        hasher.update(g10::OBJECT_VERSION);
+        hasher.update(options);
+
+        // - The primary source file's token stream, followed by those of any
+        //   other files lexed for the same module, in the order they were
+        //   lexed. Only the tokens' types and lexemes are hashed; source
+        //   locations do not affect the generated object file.
+        auto hash_tokens = [&] (const lexer& l)
+        {
+            const auto& tokens = l.get_tokens();
+            hasher.update(static_cast<std::uint64_t>(tokens.size()));
+            for (const auto& tok : tokens)
+            {
+                hasher.update(tok.type);
+                hasher.update(tok.lexeme);
+            }
+        };
+
+        hash_tokens(lex);
+        for (const auto& other : lexer::get_cached_lexers())
+        {
+            if (other.get() != &lex && other->is_in_current_module() == true)
+            {
+                hash_tokens(*other);
+            }
+        }
+
+        return hasher.to_string();
+    }
+
+    auto object_cache::lookup (
+        const std::string& key,
+        const fs::path& output_path
+    ) -> g10::result<bool>
+    {
+        if (is_enabled() == false)
+        {
+            return false;
+        }
+
+        std::error_code ec;
+        const fs::path cached = entry_path(key);
+        if (fs::is_regular_file(cached, ec) == false)
+        {
+            return false;
+        }
+
+        // - Remove any existing output file first, so that a hard link can be
+        //   created in its place.
+        fs::remove(output_path, ec);
+
+        // - Prefer a hard link; fall back to copying the file if the output
+        //   path is on another filesystem, or links are unsupported.
+        fs::create_hard_link(cached, output_path, ec);
+        if (ec)
+        {
+            ec.clear();
+            fs::copy_file(cached, output_path,
+                fs::copy_options::overwrite_existing, ec);
+            if (ec)
+            {
+                return g10::error(
+                    "Could not copy cached object '{}' to '{}': {}",
+                    cached.string(),
+                    output_path.string(),
+                    ec.message()
+                );
+            }
+        }
+
+        // - Refresh the entry's modification time, marking it as recently
+        //   used for the purposes of eviction.
+        fs::last_write_time(cached, fs::file_time_type::clock::now(), ec);
+
+        return true;
+    }
+
+    auto object_cache::store (
+        const std::string& key,
+        const fs::path& output_path
+    ) -> g10::result<void>
+    {
+        if (is_enabled() == false)
+        {
+            return {};
+        }
+
+        // - Copy the object file into a temporary file in the cache directory,
+        //   then rename it into place. Renaming is atomic, so concurrent
+        //   assembler processes sharing the cache never observe a partially
+        //   written entry.
+        std::error_code ec;
+        const fs::path cached = entry_path(key);
+        const fs::path temporary = cached.string() +
+            std::format(".{:x}.tmp", std::random_device{}());
+
+        fs::copy_file(output_path, temporary,
+            fs::copy_options::overwrite_existing, ec);
+        if (!ec)
+        {
+            fs::rename(temporary, cached, ec);
+        }
+
+        if (ec)
+        {
+            std::error_code ignored;
+            fs::remove(temporary, ignored);
+            return g10::error(
+                "Could not store object '{}' in cache: {}",
+                output_path.string(),
+                ec.message()
+            );
+        }
+
+        evict();
+        return {};
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10asm
+{
+    auto object_cache::evict () -> void
+    {
+        struct cache_entry
+        {
+            fs::path            path;
+            std::uintmax_t      size;
+            fs::file_time_type  last_used;
+        };
+
+        // - Gather all cache entries and their total size.
+        std::error_code ec;
+        std::vector<cache_entry> entries;
+        std::uintmax_t total_size = 0;
+        for (const auto& dirent : fs::directory_iterator { s_cache_dir, ec })
+        {
+            if (dirent.is_regular_file(ec) == false ||
+                dirent.path().extension() != OBJECT_CACHE_EXTENSION)
+            {
+                continue;
+            }
+
+            const auto size = dirent.file_size(ec);
+            const auto last_used = dirent.last_write_time(ec);
+            if (ec)
+            {
+                ec.clear();
+                continue;
+            }
+
+            entries.push_back({ dirent.path(), size, last_used });
+            total_size += size;
+        }
+
+        if (total_size <= s_max_size)
+        {
+            return;
+        }
+
+        // - Remove the least-recently-used entries first, until the cache fits
+        //   within its size limit.
+        std::sort(entries.begin(), entries.end(),
+            [] (const cache_entry& a, const cache_entry& b)
+                { return a.last_used < b.last_used; });
+
+        for (const auto& entry : entries)
+        {
+            if (total_size <= s_max_size)
+            {
+                break;
+            }
+
+            if (fs::remove(entry.path, ec) == true)
+            {
+                total_size -= entry.size;
+            }
+        }
+    }
+
+    auto object_cache::entry_path (const std::string& key) -> fs::path
+    {
+        return s_cache_dir / (key + std::string { OBJECT_CACHE_EXTENSION });
+    }
+}
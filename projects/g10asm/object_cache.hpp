@@ -0,0 +1,188 @@
+/**
+ * @file    g10asm/object_cache.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the G10 assembler's content-addressed
+ *          object file cache.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10asm/lexer.hpp>
+
+/* Public Constants and Enumerations ******************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The default maximum size of the object cache directory, in
+     *          bytes, if no size limit is specified (256 MiB).
+     */
+    constexpr std::uintmax_t OBJECT_CACHE_DEFAULT_SIZE = 256ull * 1024 * 1024;
+
+    /**
+     * @brief   The file extension given to object files stored in the cache.
+     */
+    constexpr std::string_view OBJECT_CACHE_EXTENSION = ".g10obj";
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's
+     *          content-addressed object file cache.
+     *
+     * The object cache allows the assembler to skip code generation entirely
+     * when a source module has already been assembled, with the same options
+     * and the same assembler build, at some point in the past. Cache entries
+     * are keyed by a hash of the following:
+     *
+     * - The token streams of the source file and every file lexed alongside it
+     *   (whitespace and comments do not affect the key);
+     *
+     * - The identity of the assembler executable (its size and modification
+     *   time), and the object file format version;
+     *
+     * - A string describing any command-line options which affect the
+     *   generated object file.
+     *
+     * On a cache hit, the cached object file is hard-linked (or copied, if
+     * hard-linking is not possible) to the output path, so the assembler must
+     * remove an existing output file before writing it. The cache directory is
+     * kept under a configurable size limit by evicting its least-recently-used
+     * entries, as determined by their modification times, which are refreshed
+     * whenever an entry is hit.
+     */
+    class object_cache final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Enables the object cache, storing its entries in the given
+         *          directory, which is created if it does not exist.
+         *
+         * @param   cache_dir       The directory in which to store cached
+         *                          object files.
+         * @param   max_size        The maximum total size of the cached object
+         *                          files, in bytes.
+         * @param   executable      The path to the running assembler executable,
+         *                          used to invalidate entries produced by other
+         *                          assembler builds.
+         *
+         * @return  If successful, returns void;
+         *          Otherwise, returns an error if the cache directory could not
+         *          be created.
+         */
+        static auto enable (
+            const fs::path& cache_dir,
+            std::uintmax_t max_size,
+            const fs::path& executable
+        ) -> g10::result<void>;
+
+        /**
+         * @brief   Disables the object cache, as between the jobs of the
+         *          assembler's server mode.
+         */
+        static auto disable () -> void;
+
+        /**
+         * @brief   Checks whether the object cache has been enabled.
+         *
+         * @return  `true` if the cache is enabled; `false` otherwise.
+         */
+        static auto is_enabled () -> bool;
+
+        /**
+         * @brief   Computes the cache key for the given lexed source module and
+         *          assembler options.
+         *
+         * @param   lex         The lexer of the primary source file.
+         * @param   options     A string describing all command-line options
+         *                      which affect the generated object file.
+         *
+         * @return  The cache key, as a 32-character hexadecimal string.
+         */
+        static auto compute_key (
+            const lexer& lex,
+            std::string_view options
+        ) -> std::string;
+
+        /**
+         * @brief   Looks up the given key in the cache, and if found, links or
+         *          copies the cached object file to the given output path.
+         *
+         * @param   key             The cache key to look up.
+         * @param   output_path     The path to which the cached object file
+         *                          should be written.
+         *
+         * @return  If successful, returns `true` on a cache hit, or `false` on
+         *          a cache miss;
+         *          Otherwise, returns an error if the cached object could not
+         *          be written to the output path.
+         */
+        static auto lookup (
+            const std::string& key,
+            const fs::path& output_path
+        ) -> g10::result<bool>;
+
+        /**
+         * @brief   Stores a freshly-assembled object file in the cache under the
+         *          given key, then evicts old entries as needed to keep the
+         *          cache under its size limit.
+         *
+         * @param   key             The cache key under which to store the
+         *                          object file.
+         * @param   output_path     The path of the freshly-written object file.
+         *
+         * @return  If successful, returns void;
+         *          Otherwise, returns an error if the object file could not be
+         *          stored in the cache.
+         */
+        static auto store (
+            const std::string& key,
+            const fs::path& output_path
+        ) -> g10::result<void>;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Removes the least-recently-used entries from the cache
+         *          directory until its total size is within the size limit.
+         */
+        static auto evict () -> void;
+
+        /**
+         * @brief   Retrieves the path of the cache entry with the given key.
+         *
+         * @param   key     The cache key.
+         *
+         * @return  The path of the cache entry.
+         */
+        static auto entry_path (const std::string& key) -> fs::path;
+
+    private: /* Private Members ***********************************************/
+
+        /**
+         * @brief   The directory in which cache entries are stored. Empty if the
+         *          cache is disabled.
+         */
+        static fs::path s_cache_dir;
+
+        /**
+         * @brief   The maximum total size of the cache entries, in bytes.
+         */
+        static std::uintmax_t s_max_size;
+
+        /**
+         * @brief   A string identifying the running assembler build, which is
+         *          mixed into every cache key.
+         */
+        static std::string s_tool_identity;
+
+    };
+}
@@ -11,6 +11,62 @@
 
 #include <g10asm/parser.hpp>
 
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Describes a binary expression operator.
+     */
+    struct binary_operator final
+    {
+        token_type      type;               /** @brief The operator's token type. */
+        std::uint8_t    precedence;         /** @brief The operator's precedence; higher binds more tightly. */
+        bool            right_associative;  /** @brief Whether the operator groups from the right. */
+    };
+
+    /**
+     * @brief   The binary expression operators, from lowest to highest
+     *          precedence. Unary operators bind more tightly than all of
+     *          these.
+     */
+    constexpr binary_operator BINARY_OPERATORS[] = {
+        { token_type::bitwise_or,           0, false },
+        { token_type::bitwise_xor,          1, false },
+        { token_type::bitwise_and,          2, false },
+        { token_type::bitwise_shift_left,   3, false },
+        { token_type::bitwise_shift_right,  3, false },
+        { token_type::plus,                 4, false },
+        { token_type::minus,                4, false },
+        { token_type::times,                5, false },
+        { token_type::divide,               5, false },
+        { token_type::modulo,               5, false },
+        { token_type::exponent,             6, true  }
+    };
+
+    /**
+     * @brief   Looks up the binary operator for the given token type.
+     *
+     * @param   type    The token type.
+     *
+     * @return  A pointer to the operator's entry in `BINARY_OPERATORS`, or
+     *          `nullptr` if the token is not a binary operator.
+     */
+    constexpr auto find_binary_operator (token_type type)
+        -> const binary_operator*
+    {
+        for (const auto& op : BINARY_OPERATORS)
+        {
+            if (op.type == type)
+            {
+                return &op;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
 /* Private Static Members *****************************************************/
 
 namespace g10asm
@@ -844,6 +900,7 @@ namespace g10asm
 
             const token& symbol_tk = symbol_tk_result.value();
             global_node->symbols.push_back(symbol_tk.lexeme);
+            global_node->symbol_ids.push_back(symbol_tk.symbol);
 
             // - Peek at the next token to see if it's a comma.
             auto comma_peek_result = lex.peek_token(0);
@@ -934,6 +991,7 @@ namespace g10asm
 
             const token& symbol_tk = symbol_tk_result.value();
             extern_node->symbols.push_back(symbol_tk.lexeme);
+            extern_node->symbol_ids.push_back(symbol_tk.symbol);
 
             // - Peek at the next token to see if it's a comma.
             auto comma_peek_result = lex.peek_token(0);
@@ -1014,6 +1072,7 @@ namespace g10asm
 
         // - Store the variable name (without the '$' prefix).
         let_node->variable_name = var_tk.lexeme.substr(1);
+        let_node->variable_symbol = var_tk.symbol;
 
         // - Consume the '=' assignment operator.
         auto assign_tk_result = lex.consume_token(
@@ -1093,6 +1152,7 @@ namespace g10asm
 
         // - Store the constant name (without the '$' prefix).
         const_node->constant_name = var_tk.lexeme.substr(1);
+        const_node->constant_symbol = var_tk.symbol;
 
         // - Consume the '=' assignment operator.
         auto assign_tk_result = lex.consume_token(
@@ -1172,6 +1232,7 @@ namespace g10asm
 
         // - Store the variable name (without the '$' prefix).
         assign_node->variable_name = var_tk.lexeme.substr(1);
+        assign_node->variable_symbol = var_tk.symbol;
 
         // - Peek at the next token, which should be an assignment operator.
         auto op_peek_result = lex.peek_token(0);
@@ -1524,333 +1585,32 @@ namespace g10asm
     /**
      * @brief   Entry point for expression parsing.
      * 
-     * This method delegates to the lowest-precedence binary operator parser,
-     * which chains upward through the precedence hierarchy. The precedence
-     * order (lowest to highest) is:
-     * 
-     *   1. Bitwise OR (`|`)
-     *   2. Bitwise XOR (`^`)
-     *   3. Bitwise AND (`&`)
-     *   4. Shift (`<<`, `>>`)
-     *   5. Additive (`+`, `-`)
-     *   6. Multiplicative (`*`, `/`, `%`)
-     *   7. Exponentiation (`**`) - right-associative
-     *   8. Unary (`-`, `~`, `!`)
-     *   9. Primary (literals, identifiers, grouped expressions)
+     * Binary expressions are parsed by precedence climbing, driven by the
+     * `BINARY_OPERATORS` table, starting from the lowest precedence.
      */
     auto parser::parse_expression (lexer& lex) 
         -> g10::result_uptr<ast_expression>
     {
-        return parse_bitwise_or_expression(lex);
-    }
-
-    /**
-     * @brief   Parses bitwise OR expressions (`|`).
-     * 
-     * This is the lowest-precedence binary operator. The grammar is:
-     *   bitwise_or_expr := bitwise_xor_expr ( '|' bitwise_xor_expr )*
-     * 
-     * Left-associative: `a | b | c` parses as `(a | b) | c`.
-     */
-    auto parser::parse_bitwise_or_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_bitwise_xor_expression(lex);
-        if (left_result.has_value() == false)
-        {
-            return g10::error(left_result.error());
-        }
-
-        auto left = std::move(left_result.value());
-
-        // - While we see a bitwise OR operator, consume it and parse the
-        //   right operand, building a left-associative binary expression tree.
-        while (true)
-        {
-            auto peek_result = lex.peek_token(0);
-            if (peek_result.has_value() == false)
-            {
-                break;
-            }
-
-            const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::bitwise_or)
-            {
-                break;
-            }
-
-            // - Consume the operator token.
-            lex.skip_tokens(1);
-
-            // - Parse the right operand.
-            auto right_result = parse_bitwise_xor_expression(lex);
-            if (right_result.has_value() == false)
-            {
-                return g10::error(right_result.error());
-            }
-
-            // - Create the binary expression node.
-            auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-            binary_node->operator_type = op_tk.type;
-            binary_node->left_operand = std::move(left);
-            binary_node->right_operand = std::move(right_result.value());
-
-            // - The new binary node becomes the left operand for the next
-            //   iteration (left-associativity).
-            left = std::move(binary_node);
-        }
-
-        return left;
-    }
-
-    /**
-     * @brief   Parses bitwise XOR expressions (`^`).
-     * 
-     * Higher precedence than bitwise OR. The grammar is:
-     *   bitwise_xor_expr := bitwise_and_expr ( '^' bitwise_and_expr )*
-     * 
-     * Left-associative: `a ^ b ^ c` parses as `(a ^ b) ^ c`.
-     */
-    auto parser::parse_bitwise_xor_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_bitwise_and_expression(lex);
-        if (left_result.has_value() == false)
-        {
-            return g10::error(left_result.error());
-        }
-
-        auto left = std::move(left_result.value());
-
-        // - While we see a bitwise XOR operator, consume it and parse the
-        //   right operand.
-        while (true)
-        {
-            auto peek_result = lex.peek_token(0);
-            if (peek_result.has_value() == false)
-            {
-                break;
-            }
-
-            const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::bitwise_xor)
-            {
-                break;
-            }
-
-            // - Consume the operator token.
-            lex.skip_tokens(1);
-
-            // - Parse the right operand.
-            auto right_result = parse_bitwise_and_expression(lex);
-            if (right_result.has_value() == false)
-            {
-                return g10::error(right_result.error());
-            }
-
-            // - Create the binary expression node.
-            auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-            binary_node->operator_type = op_tk.type;
-            binary_node->left_operand = std::move(left);
-            binary_node->right_operand = std::move(right_result.value());
-
-            left = std::move(binary_node);
-        }
-
-        return left;
+        return parse_binary_expression(lex, 0);
     }
 
     /**
-     * @brief   Parses bitwise AND expressions (`&`).
+     * @brief   Parses binary expressions by precedence climbing.
      * 
-     * Higher precedence than bitwise XOR. The grammar is:
-     *   bitwise_and_expr := shift_expr ( '&' shift_expr )*
-     * 
-     * Left-associative: `a & b & c` parses as `(a & b) & c`.
-     */
-    auto parser::parse_bitwise_and_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_shift_expression(lex);
-        if (left_result.has_value() == false)
-        {
-            return g10::error(left_result.error());
-        }
-
-        auto left = std::move(left_result.value());
-
-        // - While we see a bitwise AND operator, consume it and parse the
-        //   right operand.
-        while (true)
-        {
-            auto peek_result = lex.peek_token(0);
-            if (peek_result.has_value() == false)
-            {
-                break;
-            }
-
-            const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::bitwise_and)
-            {
-                break;
-            }
-
-            // - Consume the operator token.
-            lex.skip_tokens(1);
-
-            // - Parse the right operand.
-            auto right_result = parse_shift_expression(lex);
-            if (right_result.has_value() == false)
-            {
-                return g10::error(right_result.error());
-            }
-
-            // - Create the binary expression node.
-            auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-            binary_node->operator_type = op_tk.type;
-            binary_node->left_operand = std::move(left);
-            binary_node->right_operand = std::move(right_result.value());
-
-            left = std::move(binary_node);
-        }
-
-        return left;
-    }
-
-    /**
-     * @brief   Parses shift expressions (`<<`, `>>`).
-     * 
-     * Higher precedence than bitwise AND. The grammar is:
-     *   shift_expr := additive_expr ( ('<<' | '>>') additive_expr )*
-     * 
-     * Left-associative: `a << b >> c` parses as `(a << b) >> c`.
-     */
-    auto parser::parse_shift_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_additive_expression(lex);
-        if (left_result.has_value() == false)
-        {
-            return g10::error(left_result.error());
-        }
-
-        auto left = std::move(left_result.value());
-
-        // - While we see a shift operator, consume it and parse the
-        //   right operand.
-        while (true)
-        {
-            auto peek_result = lex.peek_token(0);
-            if (peek_result.has_value() == false)
-            {
-                break;
-            }
-
-            const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::bitwise_shift_left &&
-                op_tk.type != token_type::bitwise_shift_right)
-            {
-                break;
-            }
-
-            // - Consume the operator token.
-            lex.skip_tokens(1);
-
-            // - Parse the right operand.
-            auto right_result = parse_additive_expression(lex);
-            if (right_result.has_value() == false)
-            {
-                return g10::error(right_result.error());
-            }
-
-            // - Create the binary expression node.
-            auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-            binary_node->operator_type = op_tk.type;
-            binary_node->left_operand = std::move(left);
-            binary_node->right_operand = std::move(right_result.value());
-
-            left = std::move(binary_node);
-        }
-
-        return left;
-    }
-
-    /**
-     * @brief   Parses additive expressions (`+`, `-`).
-     * 
-     * Higher precedence than shift operators. The grammar is:
-     *   additive_expr := multiplicative_expr ( ('+' | '-') multiplicative_expr )*
-     * 
-     * Left-associative: `a + b - c` parses as `(a + b) - c`.
-     */
-    auto parser::parse_additive_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_multiplicative_expression(lex);
-        if (left_result.has_value() == false)
-        {
-            return g10::error(left_result.error());
-        }
-
-        auto left = std::move(left_result.value());
-
-        // - While we see an additive operator, consume it and parse the
-        //   right operand.
-        while (true)
-        {
-            auto peek_result = lex.peek_token(0);
-            if (peek_result.has_value() == false)
-            {
-                break;
-            }
-
-            const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::plus &&
-                op_tk.type != token_type::minus)
-            {
-                break;
-            }
-
-            // - Consume the operator token.
-            lex.skip_tokens(1);
-
-            // - Parse the right operand.
-            auto right_result = parse_multiplicative_expression(lex);
-            if (right_result.has_value() == false)
-            {
-                return g10::error(right_result.error());
-            }
-
-            // - Create the binary expression node.
-            auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-            binary_node->operator_type = op_tk.type;
-            binary_node->left_operand = std::move(left);
-            binary_node->right_operand = std::move(right_result.value());
-
-            left = std::move(binary_node);
-        }
-
-        return left;
-    }
-
-    /**
-     * @brief   Parses multiplicative expressions (`*`, `/`, `%`).
-     * 
-     * Higher precedence than additive operators. The grammar is:
-     *   multiplicative_expr := exponent_expr ( ('*' | '/' | '%') exponent_expr )*
+     * The grammar is:
+     *   binary_expr(p) := unary_expr ( OP binary_expr(q) )*
      * 
-     * Left-associative: `a * b / c` parses as `(a * b) / c`.
+     * where `OP` is any binary operator with precedence of at least `p`, and
+     * `q` is one above the operator's precedence for left-associative
+     * operators (`a - b - c` parses as `(a - b) - c`), or the operator's own
+     * precedence for right-associative ones (`2 ** 3 ** 4` parses as
+     * `2 ** (3 ** 4)`).
      */
-    auto parser::parse_multiplicative_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
+    auto parser::parse_binary_expression (lexer& lex,
+        std::uint8_t min_precedence) -> g10::result_uptr<ast_expression>
     {
-        // - Parse the left operand (higher precedence expression).
-        auto left_result = parse_exponent_expression(lex);
+        // - Parse the left operand.
+        auto left_result = parse_unary_expression(lex);
         if (left_result.has_value() == false)
         {
             return g10::error(left_result.error());
@@ -1858,8 +1618,8 @@ namespace g10asm
 
         auto left = std::move(left_result.value());
 
-        // - While we see a multiplicative operator, consume it and parse the
-        //   right operand.
+        // - While we see a binary operator which binds at least as tightly as
+        //   the minimum precedence, consume it and parse its right operand.
         while (true)
         {
             auto peek_result = lex.peek_token(0);
@@ -1869,9 +1629,8 @@ namespace g10asm
             }
 
             const token& op_tk = peek_result.value();
-            if (op_tk.type != token_type::times &&
-                op_tk.type != token_type::divide &&
-                op_tk.type != token_type::modulo)
+            const binary_operator* op = find_binary_operator(op_tk.type);
+            if (op == nullptr || op->precedence < min_precedence)
             {
                 break;
             }
@@ -1879,8 +1638,12 @@ namespace g10asm
             // - Consume the operator token.
             lex.skip_tokens(1);
 
-            // - Parse the right operand.
-            auto right_result = parse_exponent_expression(lex);
+            // - Parse the right operand, which may only contain operators
+            //   binding more tightly than this one (or as tightly, if this
+            //   operator is right-associative).
+            auto right_result = parse_binary_expression(lex,
+                op->right_associative ? op->precedence :
+                    static_cast<std::uint8_t>(op->precedence + 1));
             if (right_result.has_value() == false)
             {
                 return g10::error(right_result.error());
@@ -1892,65 +1655,14 @@ namespace g10asm
             binary_node->left_operand = std::move(left);
             binary_node->right_operand = std::move(right_result.value());
 
+            // - The new binary node becomes the left operand of the next
+            //   operator, if any.
             left = std::move(binary_node);
         }
 
         return left;
     }
 
-    /**
-     * @brief   Parses exponentiation expressions (`**`).
-     * 
-     * Higher precedence than multiplicative operators. The grammar is:
-     *   exponent_expr := unary_expr ( '**' exponent_expr )?
-     * 
-     * Right-associative: `2 ** 3 ** 4` parses as `2 ** (3 ** 4)`.
-     * This is achieved by recursively calling parse_exponent_expression
-     * for the right operand instead of a higher-precedence parser.
-     */
-    auto parser::parse_exponent_expression (lexer& lex)
-        -> g10::result_uptr<ast_expression>
-    {
-        // - Parse the base (left operand) as a unary expression.
-        auto base_result = parse_unary_expression(lex);
-        if (base_result.has_value() == false)
-        {
-            return g10::error(base_result.error());
-        }
-
-        // - Check if the next token is an exponentiation operator.
-        auto peek_result = lex.peek_token(0);
-        if (peek_result.has_value() == false)
-        {
-            return base_result;
-        }
-
-        const token& op_tk = peek_result.value();
-        if (op_tk.type != token_type::exponent)
-        {
-            return base_result;
-        }
-
-        // - Consume the exponentiation operator.
-        lex.skip_tokens(1);
-
-        // - Recursively parse the exponent (right operand) as another
-        //   exponent expression to achieve right-associativity.
-        auto exponent_result = parse_exponent_expression(lex);
-        if (exponent_result.has_value() == false)
-        {
-            return g10::error(exponent_result.error());
-        }
-
-        // - Create the binary expression node.
-        auto binary_node = std::make_unique<ast_expr_binary>(op_tk);
-        binary_node->operator_type = op_tk.type;
-        binary_node->left_operand = std::move(base_result.value());
-        binary_node->right_operand = std::move(exponent_result.value());
-
-        return binary_node;
-    }
-
     /**
      * @brief   Parses unary expressions (`-`, `~`, `!`).
      * 
@@ -0,0 +1,439 @@
+/**
+ * @file    g10asm/peephole.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's peephole optimizer.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10asm/peephole.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    // - Masks of the CPU flags, as tracked by the peephole optimizer.
+    constexpr std::uint8_t PEEPHOLE_FLAG_Z      = 0b00001;
+    constexpr std::uint8_t PEEPHOLE_FLAG_N      = 0b00010;
+    constexpr std::uint8_t PEEPHOLE_FLAG_H      = 0b00100;
+    constexpr std::uint8_t PEEPHOLE_FLAG_C      = 0b01000;
+    constexpr std::uint8_t PEEPHOLE_FLAG_V      = 0b10000;
+    constexpr std::uint8_t PEEPHOLE_FLAGS_ALL   = 0b11111;
+}
+
+/* Private Unions and Structures **********************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Describes how an instruction interacts with the CPU flags.
+     */
+    struct peephole_flag_effects final
+    {
+        bool            known;      /** @brief If false, the instruction's effects are not modelled, and must be assumed to read every flag. */
+        std::uint8_t    reads;      /** @brief The flags read by the instruction. */
+        std::uint8_t    writes;     /** @brief The flags unconditionally written by the instruction. */
+    };
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10asm
+{
+    static auto flag_effects (g10::instruction instruction)
+        -> peephole_flag_effects
+    {
+        switch (instruction)
+        {
+            // - Loads, stores, moves and stack operations leave the flags
+            //   untouched.
+            case g10::instruction::nop:
+            case g10::instruction::di:
+            case g10::instruction::ei:
+            case g10::instruction::eii:
+            case g10::instruction::ld:
+            case g10::instruction::ldq:
+            case g10::instruction::ldp:
+            case g10::instruction::st:
+            case g10::instruction::stq:
+            case g10::instruction::stp:
+            case g10::instruction::mv:
+            case g10::instruction::mwh:
+            case g10::instruction::mwl:
+            case g10::instruction::lsp:
+            case g10::instruction::pop:
+            case g10::instruction::ssp:
+            case g10::instruction::push:
+            case g10::instruction::spo:
+            case g10::instruction::spi:
+                return { true, 0, 0 };
+
+            // - Arithmetic, logic and comparison instructions overwrite every
+            //   flag; those with carry read the Carry flag first.
+            case g10::instruction::add:
+            case g10::instruction::sub:
+            case g10::instruction::and_:
+            case g10::instruction::or_:
+            case g10::instruction::xor_:
+            case g10::instruction::cmp:
+            case g10::instruction::cp:
+                return { true, 0, PEEPHOLE_FLAGS_ALL };
+
+            case g10::instruction::adc:
+            case g10::instruction::sbc:
+                return { true, PEEPHOLE_FLAG_C, PEEPHOLE_FLAGS_ALL };
+
+            // - Increments and decrements leave the Carry flag untouched.
+            case g10::instruction::inc:
+            case g10::instruction::dec:
+                return { true, 0,
+                    PEEPHOLE_FLAG_Z | PEEPHOLE_FLAG_N | PEEPHOLE_FLAG_H };
+
+            default:
+                return { false, PEEPHOLE_FLAGS_ALL, 0 };
+        }
+    }
+
+    static auto register_class (g10::register_type reg) -> std::uint8_t
+    {
+        // - The upper bits of the register type: `0` for `Dn`, `1` for `Wn`,
+        //   `2` for `Hn` and `4` for `Ln`.
+        return (std::to_underlying(reg) >> 4) & 0x07;
+    }
+
+    static auto register_operand (const ast_node& operand)
+        -> std::optional<g10::register_type>
+    {
+        if (operand.type != ast_node_type::opr_register)
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<const ast_opr_register&>(operand).reg;
+    }
+
+    static auto mnemonic (g10::instruction instruction) -> std::string_view
+    {
+        switch (instruction)
+        {
+            case g10::instruction::ld:      return "LD";
+            case g10::instruction::ldq:     return "LDQ";
+            case g10::instruction::ldp:     return "LDP";
+            case g10::instruction::st:      return "ST";
+            case g10::instruction::stq:     return "STQ";
+            case g10::instruction::stp:     return "STP";
+            case g10::instruction::mv:      return "MV";
+            case g10::instruction::add:     return "ADD";
+            case g10::instruction::sub:     return "SUB";
+            case g10::instruction::inc:     return "INC";
+            case g10::instruction::dec:     return "DEC";
+            case g10::instruction::xor_:    return "XOR";
+            default:                        return "???";
+        }
+    }
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto peephole::optimize (ast_module& module, bool verbose) -> std::size_t
+    {
+        std::size_t rewrites = 0;
+        auto& children = module.children;
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            if (!children[i] || !children[i]->valid ||
+                children[i]->type != ast_node_type::instruction)
+            {
+                continue;
+            }
+
+            const std::string_view source_file = children[i]->source_file;
+            const std::size_t source_line = children[i]->source_line;
+            const std::string description = rewrite(children, i);
+            if (description.empty() == true)
+            {
+                continue;
+            }
+
+            ++rewrites;
+            if (verbose == true)
+            {
+                std::println("Peephole: {}:{}: {}",
+                    source_file, source_line, description);
+            }
+        }
+
+        // - Drop any instructions which were removed outright.
+        std::erase(children, nullptr);
+
+        if (verbose == true)
+        {
+            std::println("Peephole: {} rewrite(s) made.", rewrites);
+        }
+
+        return rewrites;
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10asm
+{
+    auto peephole::rewrite (
+        std::vector<std::unique_ptr<ast_node>>& children,
+        std::size_t index
+    ) -> std::string
+    {
+        auto& instr = static_cast<ast_instruction&>(*children[index]);
+        auto& operands = instr.operands;
+        if (operands.size() != 2 || !operands[0] || !operands[1])
+        {
+            return "";
+        }
+
+        const std::string before = describe(instr);
+        const auto dest_reg = register_operand(*operands[0]);
+        const auto src_reg = register_operand(*operands[1]);
+        const auto src_value = constant_operand(*operands[1]);
+
+        switch (instr.instruction)
+        {
+            case g10::instruction::ld:
+            {
+                if (dest_reg.has_value() == false)
+                {
+                    break;
+                }
+
+                // - `LD R0, 0` -> `XOR L0, L0` / `SUB W0, W0` / `SUB D0, D0`.
+                if (operands[1]->type == ast_node_type::opr_immediate &&
+                    src_value == 0 &&
+                    (
+                        *dest_reg == g10::register_type::l0 ||
+                        *dest_reg == g10::register_type::w0 ||
+                        *dest_reg == g10::register_type::d0
+                    ) &&
+                    flags_dead_after(children, index, PEEPHOLE_FLAGS_ALL))
+                {
+                    auto source = std::make_unique<ast_opr_register>(token {
+                        .type = token_type::keyword,
+                        .lexeme = operands[0]->lexeme,
+                        .source_file = operands[1]->source_file,
+                        .source_line = operands[1]->source_line,
+                        .source_column = operands[1]->source_column
+                    });
+                    source->reg = *dest_reg;
+
+                    instr.instruction = (*dest_reg == g10::register_type::l0) ?
+                        g10::instruction::xor_ : g10::instruction::sub;
+                    operands[1] = std::move(source);
+                    return std::format("'{}' -> '{}'", before, describe(instr));
+                }
+
+                // - `LD R, [ADDR32]` -> `LDP` / `LDQ`, for high addresses.
+                if (operands[1]->type == ast_node_type::opr_direct &&
+                    src_value.has_value() &&
+                    *src_value >= 0xFFFF0000 && *src_value <= 0xFFFFFFFF)
+                {
+                    instr.instruction =
+                        (*src_value >= 0xFFFFFF00 &&
+                            register_class(*dest_reg) == 4) ?
+                        g10::instruction::ldp : g10::instruction::ldq;
+                    return std::format("'{}' -> '{}'", before, describe(instr));
+                }
+            } break;
+
+            case g10::instruction::st:
+            {
+                // - `ST [ADDR32], R` -> `STP` / `STQ`, for high addresses.
+                const auto dest_value = constant_operand(*operands[0]);
+                if (operands[0]->type == ast_node_type::opr_direct &&
+                    src_reg.has_value() && dest_value.has_value() &&
+                    *dest_value >= 0xFFFF0000 && *dest_value <= 0xFFFFFFFF)
+                {
+                    instr.instruction =
+                        (*dest_value >= 0xFFFFFF00 &&
+                            register_class(*src_reg) == 4) ?
+                        g10::instruction::stp : g10::instruction::stq;
+                    return std::format("'{}' -> '{}'", before, describe(instr));
+                }
+            } break;
+
+            case g10::instruction::add:
+            case g10::instruction::sub:
+            {
+                // - `ADD R0, 1` -> `INC R0`, and `SUB R0, 1` -> `DEC R0`.
+                //   `INC` and `DEC` leave the Carry flag untouched, as well as
+                //   the Overflow flag for word and double-word registers.
+                if (dest_reg.has_value() == false || src_value != 1)
+                {
+                    break;
+                }
+
+                const std::uint8_t preserved =
+                    (*dest_reg == g10::register_type::l0) ?
+                        PEEPHOLE_FLAG_C :
+                    (
+                        *dest_reg == g10::register_type::w0 ||
+                        *dest_reg == g10::register_type::d0
+                    ) ?
+                        (PEEPHOLE_FLAG_C | PEEPHOLE_FLAG_V) : 0;
+                if (preserved == 0 ||
+                    flags_dead_after(children, index, preserved) == false)
+                {
+                    break;
+                }
+
+                instr.instruction = (instr.instruction == g10::instruction::add) ?
+                    g10::instruction::inc : g10::instruction::dec;
+                operands.pop_back();
+                return std::format("'{}' -> '{}'", before, describe(instr));
+            }
+
+            case g10::instruction::mv:
+            {
+                if (dest_reg.has_value() == false || src_reg.has_value() == false)
+                {
+                    break;
+                }
+
+                // - `MV X, X` does nothing.
+                if (*dest_reg == *src_reg)
+                {
+                    children[index].reset();
+                    return std::format("'{}' removed", before);
+                }
+
+                // - `MV Y, X` directly after `MV X, Y` does nothing.
+                if (index == 0 || !children[index - 1] ||
+                    children[index - 1]->type != ast_node_type::instruction)
+                {
+                    break;
+                }
+
+                const auto& prev =
+                    static_cast<const ast_instruction&>(*children[index - 1]);
+                if (prev.instruction == g10::instruction::mv &&
+                    prev.operands.size() == 2 &&
+                    register_operand(*prev.operands[0]) == src_reg &&
+                    register_operand(*prev.operands[1]) == dest_reg)
+                {
+                    children[index].reset();
+                    return std::format("'{}' removed", before);
+                }
+            } break;
+
+            default:
+                break;
+        }
+
+        return "";
+    }
+
+    auto peephole::flags_dead_after (
+        const std::vector<std::unique_ptr<ast_node>>& children,
+        std::size_t index,
+        std::uint8_t flags
+    ) -> bool
+    {
+        for (std::size_t i = index + 1; i < children.size() && flags != 0; ++i)
+        {
+            if (!children[i])
+            {
+                continue;
+            }
+
+            switch (children[i]->type)
+            {
+                // - These have already been processed, and emit nothing.
+                case ast_node_type::dir_let:
+                case ast_node_type::dir_const:
+                case ast_node_type::stmt_var_assignment:
+                case ast_node_type::dir_global:
+                case ast_node_type::dir_extern:
+                    continue;
+
+                case ast_node_type::instruction:
+                {
+                    const auto& instr =
+                        static_cast<const ast_instruction&>(*children[i]);
+                    const auto effects = flag_effects(instr.instruction);
+                    if (effects.known == false || (effects.reads & flags) != 0)
+                    {
+                        return false;
+                    }
+
+                    flags &= ~effects.writes;
+                } break;
+
+                // - Labels may be jumped to with live flags; data, section
+                //   changes and anything else end the run of instructions.
+                default:
+                    return false;
+            }
+        }
+
+        return flags == 0;
+    }
+
+    auto peephole::constant_operand (const ast_node& operand)
+        -> std::optional<std::int64_t>
+    {
+        const ast_expression* expr = nullptr;
+        if (operand.type == ast_node_type::opr_immediate)
+        {
+            expr = static_cast<const ast_opr_immediate&>(operand).value.get();
+        }
+        else if (operand.type == ast_node_type::opr_direct)
+        {
+            expr = static_cast<const ast_opr_direct&>(operand).address.get();
+        }
+
+        // - Constant expressions have already been folded into integer
+        //   literals.
+        if (expr == nullptr || expr->type != ast_node_type::expr_primary)
+        {
+            return std::nullopt;
+        }
+
+        const auto& primary = static_cast<const ast_expr_primary&>(*expr);
+        if (primary.expr_type != ast_expr_primary::primary_type::integer_literal ||
+            std::holds_alternative<std::int64_t>(primary.value) == false)
+        {
+            return std::nullopt;
+        }
+
+        return std::get<std::int64_t>(primary.value);
+    }
+
+    auto peephole::describe (const ast_instruction& instr) -> std::string
+    {
+        std::string text { mnemonic(instr.instruction) };
+        for (std::size_t i = 0; i < instr.operands.size(); ++i)
+        {
+            const auto& operand = *instr.operands[i];
+            text += (i == 0) ? " " : ", ";
+
+            const auto value = constant_operand(operand);
+            if (operand.type == ast_node_type::opr_direct)
+            {
+                text += value.has_value() ?
+                    std::format("[${:08X}]", *value) : "[...]";
+            }
+            else if (value.has_value())
+            {
+                text += std::format("{}", *value);
+            }
+            else
+            {
+                text += operand.lexeme;
+            }
+        }
+
+        return text;
+    }
+}
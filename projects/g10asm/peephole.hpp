@@ -0,0 +1,115 @@
+/**
+ * @file    g10asm/peephole.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's peephole optimizer.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10asm/ast.hpp>
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's
+     *          peephole optimizer.
+     *
+     * The peephole optimizer makes a single pass over the module's instruction
+     * stream, after constant folding and before code is emitted, rewriting
+     * instructions into cheaper equivalents:
+     *
+     * - `LD L0, 0`, `LD W0, 0` and `LD D0, 0` become `XOR L0, L0`,
+     *   `SUB W0, W0` and `SUB D0, D0`, if the flags are dead afterwards;
+     *
+     * - `ADD R0, 1` and `SUB R0, 1` become `INC R0` and `DEC R0`, if the flags
+     *   left untouched by `INC` and `DEC` are dead afterwards;
+     *
+     * - `LD` and `ST` with a constant address at or above `$FFFF0000` become
+     *   `LDQ` and `STQ`, and byte accesses at or above `$FFFFFF00` become `LDP`
+     *   and `STP`;
+     *
+     * - `MV X, X`, and `MV Y, X` directly following `MV X, Y`, are removed.
+     *
+     * The flags are considered dead after an instruction if, within the same
+     * straight-line run of instructions, they are overwritten before they are
+     * read. Labels, data, section changes and control transfers all end such
+     * a run, so no rewrite is made across them.
+     */
+    class peephole final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Optimizes the instructions in the given AST module in place.
+         *
+         * @param   module      The AST module to optimize.
+         * @param   verbose     If true, each rewrite is reported on stdout.
+         *
+         * @return  The number of rewrites made.
+         */
+        static auto optimize (ast_module& module, bool verbose) -> std::size_t;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Attempts to rewrite the instruction at the given index of the
+         *          module's children.
+         *
+         * @param   children    The module's child nodes.
+         * @param   index       The index of the instruction to rewrite.
+         *
+         * @return  A description of the rewrite if one was made, or an empty
+         *          string otherwise. If the instruction was removed, the child
+         *          at `index` is set to null.
+         */
+        static auto rewrite (
+            std::vector<std::unique_ptr<ast_node>>& children,
+            std::size_t index
+        ) -> std::string;
+
+        /**
+         * @brief   Checks whether the given flags are dead after the child at
+         *          the given index - that is, overwritten before being read.
+         *
+         * @param   children    The module's child nodes.
+         * @param   index       The index of the instruction to check after.
+         * @param   flags       A mask of the flags to check.
+         *
+         * @return  True if every flag in the mask is dead.
+         */
+        static auto flags_dead_after (
+            const std::vector<std::unique_ptr<ast_node>>& children,
+            std::size_t index,
+            std::uint8_t flags
+        ) -> bool;
+
+        /**
+         * @brief   Retrieves the constant value of an immediate operand or the
+         *          address of a direct operand, if it is an integer literal.
+         *
+         * @param   operand     The operand AST node.
+         *
+         * @return  The operand's constant value, or `std::nullopt` if it is
+         *          not constant.
+         */
+        static auto constant_operand (const ast_node& operand)
+            -> std::optional<std::int64_t>;
+
+        /**
+         * @brief   Describes the given instruction as it will be assembled, for
+         *          reporting rewrites.
+         *
+         * @param   instr   The AST instruction node.
+         *
+         * @return  A string describing the instruction.
+         */
+        static auto describe (const ast_instruction& instr) -> std::string;
+
+    };
+}
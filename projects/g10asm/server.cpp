@@ -0,0 +1,337 @@
+/**
+ * @file    g10asm/server.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's persistent server mode.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10asm/lexer.hpp>
+#include <g10asm/server.hpp>
+
+#if defined(G10_LINUX)
+    #include <cerrno>
+    #include <csignal>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   The request which stops the server.
+     */
+    constexpr std::string_view SERVER_SHUTDOWN_REQUEST = "--shutdown";
+
+    /**
+     * @brief   The number of pending connections the server's socket queues.
+     */
+    constexpr int SERVER_BACKLOG = 16;
+}
+
+/* Private Classes ************************************************************/
+
+#if defined(G10_LINUX)
+
+namespace g10asm
+{
+    /**
+     * @brief   Reads requests from a file descriptor, one line at a time.
+     */
+    class request_reader final
+    {
+    public:
+
+        explicit request_reader (int fd) :
+            m_fd { fd }
+        {
+        }
+
+        /**
+         * @brief   Reads the next request's arguments.
+         *
+         * @param   arguments   Receives the request's arguments.
+         *
+         * @return  `true` if a complete request was read;
+         *          `false` if the stream ended first.
+         */
+        auto read_request (std::vector<std::string>& arguments) -> bool
+        {
+            arguments.clear();
+
+            std::string line = "";
+            while (read_line(line) == true)
+            {
+                if (line.empty() == true)
+                {
+                    // - Blank lines before a request's first argument are
+                    //   ignored.
+                    if (arguments.empty() == false)
+                    {
+                        return true;
+                    }
+
+                    continue;
+                }
+
+                arguments.push_back(std::move(line));
+            }
+
+            return false;
+        }
+
+    private:
+
+        auto read_line (std::string& line) -> bool
+        {
+            line.clear();
+            while (true)
+            {
+                const auto newline = m_buffer.find('\n', m_position);
+                if (newline != std::string::npos)
+                {
+                    line.assign(m_buffer, m_position, newline - m_position);
+                    m_position = newline + 1;
+                    if (line.empty() == false && line.back() == '\r')
+                    {
+                        line.pop_back();
+                    }
+
+                    return true;
+                }
+
+                m_buffer.erase(0, m_position);
+                m_position = 0;
+
+                char chunk[4096];
+                const auto count = ::read(m_fd, chunk, sizeof(chunk));
+                if (count < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                else if (count <= 0)
+                {
+                    return false;
+                }
+
+                m_buffer.append(chunk, static_cast<std::size_t>(count));
+            }
+        }
+
+        int         m_fd;
+        std::string m_buffer = "";
+        std::size_t m_position = 0;
+
+    };
+}
+
+#endif
+
+/* Private Functions **********************************************************/
+
+#if defined(G10_LINUX)
+
+namespace g10asm
+{
+    static auto write_all (int fd, std::string_view data) -> bool
+    {
+        while (data.empty() == false)
+        {
+            const auto count = ::write(fd, data.data(), data.size());
+            if (count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else if (count <= 0)
+            {
+                return false;
+            }
+
+            data.remove_prefix(static_cast<std::size_t>(count));
+        }
+
+        return true;
+    }
+}
+
+#endif
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto server::run (
+        const fs::path& socket_path,
+        const server_job_handler& handler
+    ) -> g10::result<void>
+    {
+    #if defined(G10_LINUX)
+        // - A client which disconnects before reading its response must not
+        //   bring the server down with it.
+        std::signal(SIGPIPE, SIG_IGN);
+
+        if (socket_path.empty() == true)
+        {
+            serve(STDIN_FILENO, STDOUT_FILENO, handler);
+            return {};
+        }
+
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        const std::string path = socket_path.string();
+        if (path.size() >= sizeof(address.sun_path))
+        {
+            return g10::error("Socket path '{}' is too long.", path);
+        }
+
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        const int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0)
+        {
+            return g10::error("Failed to create socket: {}",
+                std::strerror(errno));
+        }
+
+        // - Replace any socket left behind by a previous server.
+        ::unlink(path.c_str());
+        if (::bind(listener, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) < 0 ||
+            ::listen(listener, SERVER_BACKLOG) < 0)
+        {
+            const std::string reason = std::strerror(errno);
+            ::close(listener);
+            return g10::error("Failed to listen on socket '{}': {}",
+                path, reason);
+        }
+
+        bool running = true;
+        while (running == true)
+        {
+            const int connection = ::accept(listener, nullptr, nullptr);
+            if (connection < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                const std::string reason = std::strerror(errno);
+                ::close(listener);
+                ::unlink(path.c_str());
+                return g10::error("Failed to accept connection: {}", reason);
+            }
+
+            running = serve(connection, connection, handler);
+            ::close(connection);
+        }
+
+        ::close(listener);
+        ::unlink(path.c_str());
+        return {};
+    #else
+        return g10::error("Server mode is only supported on Linux.");
+    #endif
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10asm
+{
+    auto server::serve (
+        int in_fd,
+        int out_fd,
+        const server_job_handler& handler
+    ) -> bool
+    {
+    #if defined(G10_LINUX)
+        request_reader reader { in_fd };
+        std::vector<std::string> arguments;
+        while (reader.read_request(arguments) == true)
+        {
+            if (arguments.size() == 1 && arguments[0] == SERVER_SHUTDOWN_REQUEST)
+            {
+                write_all(out_fd, "status 0 0\n");
+                return false;
+            }
+
+            std::string output = "";
+            const int status = run_job(arguments, handler, output);
+            if (write_all(out_fd, std::format("status {} {}\n{}", status,
+                output.size(), output)) == false)
+            {
+                break;
+            }
+        }
+    #endif
+
+        return true;
+    }
+
+    auto server::run_job (
+        std::span<const std::string> arguments,
+        const server_job_handler& handler,
+        std::string& output
+    ) -> int
+    {
+    #if defined(G10_LINUX)
+        // - Drop the lexers of source files which have changed since the last
+        //   job, and detach the rest from it.
+        lexer::refresh_cache();
+
+        // - Redirect standard output and standard error into a temporary file
+        //   for the duration of the job.
+        std::FILE* capture = std::tmpfile();
+        if (capture == nullptr)
+        {
+            output = std::format("Error: Failed to capture job output: {}\n",
+                std::strerror(errno));
+            return 1;
+        }
+
+        std::fflush(stdout);
+        std::fflush(stderr);
+        const int saved_out = ::dup(STDOUT_FILENO);
+        const int saved_err = ::dup(STDERR_FILENO);
+        ::dup2(::fileno(capture), STDOUT_FILENO);
+        ::dup2(::fileno(capture), STDERR_FILENO);
+
+        int status = 1;
+        try
+        {
+            status = handler(arguments);
+        }
+        catch (const std::exception& ex)
+        {
+            std::println(stderr, "Error: {}", ex.what());
+        }
+
+        std::fflush(stdout);
+        std::fflush(stderr);
+        ::dup2(saved_out, STDOUT_FILENO);
+        ::dup2(saved_err, STDERR_FILENO);
+        ::close(saved_out);
+        ::close(saved_err);
+
+        // - Collect the captured output.
+        std::rewind(capture);
+        char chunk[4096];
+        std::size_t count = 0;
+        while ((count = std::fread(chunk, 1, sizeof(chunk), capture)) > 0)
+        {
+            output.append(chunk, count);
+        }
+
+        std::fclose(capture);
+        return status;
+    #else
+        return handler(arguments);
+    #endif
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file    g10asm/server.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's persistent server mode.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/common.hpp>
+
+/* Public Types ***************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   A function which runs a single assembly job, given the job's
+     *          command-line arguments (excluding the program name), and
+     *          returns the job's exit status.
+     */
+    using server_job_handler =
+        std::function<int (std::span<const std::string>)>;
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's
+     *          persistent server mode.
+     *
+     * In server mode, a single long-lived assembler process runs many
+     * assembly jobs, sparing each job the cost of process startup, and
+     * keeping the keyword table, interned symbol names and the lexers of
+     * unchanged source files warm from one job to the next.
+     *
+     * Jobs are received either on standard input, or over connections to a
+     * Unix domain socket. A job request consists of the job's command-line
+     * arguments, one per line, followed by an empty line. The arguments are
+     * those accepted by `g10asm` itself; relative paths are resolved against
+     * the server's working directory. Object files are written to the paths
+     * named by the job's `-o` argument, as usual.
+     *
+     * Each job is answered, on standard output or over its connection, with
+     * a header line of the form `status <exit status> <length>`, followed by
+     * `<length>` bytes containing everything the job wrote to standard output
+     * and standard error: its diagnostics. A request consisting of the single
+     * argument `--shutdown` stops the server.
+     *
+     * Jobs share the assembler's process-wide state, and so are run one at a
+     * time, in the order they are received.
+     */
+    class server final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Runs the server until it is shut down, or until standard
+         *          input is closed.
+         *
+         * @param   socket_path The path of the Unix domain socket on which to
+         *                      accept connections, or an empty path to receive
+         *                      jobs on standard input.
+         * @param   handler     The function which runs each job.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto run (
+            const fs::path& socket_path,
+            const server_job_handler& handler
+        ) -> g10::result<void>;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Receives and runs jobs from a single connection, until the
+         *          connection is closed or the server is shut down.
+         *
+         * @param   in_fd       The file descriptor from which requests are
+         *                      read.
+         * @param   out_fd      The file descriptor to which responses are
+         *                      written.
+         * @param   handler     The function which runs each job.
+         *
+         * @return  `true` if the server should keep running;
+         *          `false` if a shutdown was requested.
+         */
+        static auto serve (
+            int in_fd,
+            int out_fd,
+            const server_job_handler& handler
+        ) -> bool;
+
+        /**
+         * @brief   Runs a single job, capturing everything it writes to
+         *          standard output and standard error.
+         *
+         * @param   arguments   The job's command-line arguments.
+         * @param   handler     The function which runs the job.
+         * @param   output      Receives the job's captured output.
+         *
+         * @return  The job's exit status.
+         */
+        static auto run_job (
+            std::span<const std::string> arguments,
+            const server_job_handler& handler,
+            std::string& output
+        ) -> int;
+
+    };
+}
@@ -0,0 +1,115 @@
+/**
+ * @file    g10asm/symbol_table.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's identifier interning
+ *          table.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10asm/symbol_table.hpp>
+
+/* Private Static Members *****************************************************/
+
+namespace g10asm
+{
+    std::deque<std::string>     symbol_table::s_names;
+    std::vector<std::uint64_t>  symbol_table::s_hashes;
+    std::vector<symbol_id>      symbol_table::s_slots;
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10asm
+{
+    auto symbol_table::intern (std::string_view name) -> symbol_id
+    {
+        // - Keep the slot table at most half full.
+        if ((s_names.size() + 1) * 2 > s_slots.size())
+        {
+            grow();
+        }
+
+        const std::uint64_t name_hash = hash(name);
+        const std::size_t mask = s_slots.size() - 1;
+        for (std::size_t slot = name_hash & mask; ; slot = (slot + 1) & mask)
+        {
+            const symbol_id id = s_slots[slot];
+            if (id == INVALID_SYMBOL)
+            {
+                // - Not yet interned; assign the next ID.
+                const auto new_id = static_cast<symbol_id>(s_names.size());
+                s_names.emplace_back(name);
+                s_hashes.push_back(name_hash);
+                s_slots[slot] = new_id;
+                return new_id;
+            }
+            else if (s_hashes[id] == name_hash && s_names[id] == name)
+            {
+                return id;
+            }
+        }
+    }
+
+    auto symbol_table::find (std::string_view name) -> symbol_id
+    {
+        if (s_slots.empty())
+        {
+            return INVALID_SYMBOL;
+        }
+
+        const std::uint64_t name_hash = hash(name);
+        const std::size_t mask = s_slots.size() - 1;
+        for (std::size_t slot = name_hash & mask; ; slot = (slot + 1) & mask)
+        {
+            const symbol_id id = s_slots[slot];
+            if (id == INVALID_SYMBOL ||
+                (s_hashes[id] == name_hash && s_names[id] == name))
+            {
+                return id;
+            }
+        }
+    }
+
+    auto symbol_table::name_of (symbol_id id) -> std::string_view
+    {
+        return (id < s_names.size()) ? std::string_view { s_names[id] } : "";
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10asm
+{
+    auto symbol_table::hash (std::string_view name) -> std::uint64_t
+    {
+        std::uint64_t result = 0xCBF29CE484222325ull;
+        for (const char ch : name)
+        {
+            result = (result ^ static_cast<std::uint8_t>(ch)) *
+                0x00000100000001B3ull;
+        }
+
+        return result;
+    }
+
+    auto symbol_table::grow () -> void
+    {
+        const std::size_t capacity = s_slots.empty() ? 256 : s_slots.size() * 2;
+        s_slots.assign(capacity, INVALID_SYMBOL);
+
+        const std::size_t mask = capacity - 1;
+        for (std::size_t id = 0; id < s_names.size(); ++id)
+        {
+            std::size_t slot = s_hashes[id] & mask;
+            while (s_slots[slot] != INVALID_SYMBOL)
+            {
+                slot = (slot + 1) & mask;
+            }
+
+            s_slots[slot] = static_cast<symbol_id>(id);
+        }
+    }
+}
@@ -0,0 +1,301 @@
+/**
+ * @file    g10asm/symbol_table.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 assembler's identifier interning
+ *          table, and the flat maps keyed by interned symbol IDs.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/common.hpp>
+
+/* Public Types ***************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   A 32-bit ID uniquely identifying an interned identifier, label
+     *          or variable name.
+     */
+    using symbol_id = std::uint32_t;
+}
+
+/* Public Constants and Enumerations ******************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   A symbol ID which does not refer to any interned name.
+     */
+    constexpr symbol_id INVALID_SYMBOL = 0xFFFFFFFF;
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10asm
+{
+    /**
+     * @brief   Defines a static class representing the G10 assembler's
+     *          identifier interning table.
+     *
+     * Identifier and variable names are interned by the lexer as their tokens
+     * are produced, so that each distinct name is hashed and stored exactly
+     * once. Every later stage of the assembler refers to names by their
+     * 32-bit symbol IDs instead, which can be compared and hashed trivially.
+     *
+     * Interned names persist for the lifetime of the process, alongside the
+     * lexers which produced them.
+     */
+    class symbol_table final
+    {
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Interns the given name, if it has not been interned already.
+         *
+         * @param   name    The name to intern.
+         *
+         * @return  The symbol ID of the interned name.
+         */
+        static auto intern (std::string_view name) -> symbol_id;
+
+        /**
+         * @brief   Looks up the symbol ID of an already-interned name, without
+         *          interning it.
+         *
+         * @param   name    The name to look up.
+         *
+         * @return  The symbol ID of the name if it has been interned;
+         *          `INVALID_SYMBOL` otherwise.
+         */
+        static auto find (std::string_view name) -> symbol_id;
+
+        /**
+         * @brief   Retrieves the name of the given interned symbol ID.
+         *
+         * @param   id      The symbol ID.
+         *
+         * @return  The interned name, or an empty string if the ID is invalid.
+         */
+        static auto name_of (symbol_id id) -> std::string_view;
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Computes the hash of the given name.
+         *
+         * @param   name    The name to hash.
+         *
+         * @return  The name's 64-bit FNV-1a hash.
+         */
+        static auto hash (std::string_view name) -> std::uint64_t;
+
+        /**
+         * @brief   Doubles the size of the open-addressing slot table, and
+         *          re-inserts every interned name.
+         */
+        static auto grow () -> void;
+
+    private: /* Private Members ***********************************************/
+
+        /**
+         * @brief   The interned names, indexed by symbol ID. A deque is used so
+         *          that views of existing names remain valid as it grows.
+         */
+        static std::deque<std::string> s_names;
+
+        /**
+         * @brief   The hashes of the interned names, indexed by symbol ID.
+         */
+        static std::vector<std::uint64_t> s_hashes;
+
+        /**
+         * @brief   The open-addressing slot table, mapping name hashes to
+         *          symbol IDs. Empty slots hold `INVALID_SYMBOL`.
+         */
+        static std::vector<symbol_id> s_slots;
+
+    };
+
+    /**
+     * @brief   Defines a flat hash map keyed by interned symbol IDs.
+     *
+     * Entries are stored contiguously, in insertion order, and are located
+     * through a power-of-two sized open-addressing index with linear probing.
+     * Entries cannot be removed individually; the map can only be cleared.
+     *
+     * @tparam  T   The type of value stored in the map.
+     */
+    template <typename T>
+    class symbol_map final
+    {
+    public: /* Public Types ***************************************************/
+
+        using entry_type = std::pair<symbol_id, T>;
+
+    public: /* Public Methods *************************************************/
+
+        /**
+         * @brief   Retrieves a pointer to the value mapped to the given ID.
+         *
+         * @param   id      The symbol ID to look up.
+         *
+         * @return  A pointer to the mapped value, or `nullptr` if not found.
+         */
+        auto find (symbol_id id) -> T*
+        {
+            const std::size_t index = locate(id);
+            return (index != EMPTY_SLOT) ? &m_entries[index].second : nullptr;
+        }
+
+        auto find (symbol_id id) const -> const T*
+        {
+            const std::size_t index = locate(id);
+            return (index != EMPTY_SLOT) ? &m_entries[index].second : nullptr;
+        }
+
+        /**
+         * @brief   Checks whether a value is mapped to the given ID.
+         *
+         * @param   id      The symbol ID to check.
+         *
+         * @return  `true` if the ID is present in the map; `false` otherwise.
+         */
+        auto contains (symbol_id id) const -> bool
+        {
+            return locate(id) != EMPTY_SLOT;
+        }
+
+        /**
+         * @brief   Maps the given value to the given ID, if the ID is not
+         *          already present in the map.
+         *
+         * @param   id      The symbol ID.
+         * @param   value   The value to map to the ID.
+         *
+         * @return  `true` if the value was inserted; `false` if the ID was
+         *          already present, in which case the map is unchanged.
+         */
+        auto insert (symbol_id id, T value = {}) -> bool
+        {
+            if ((m_entries.size() + 1) * 2 > m_slots.size())
+            {
+                rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+            }
+
+            const std::size_t mask = m_slots.size() - 1;
+            for (std::size_t slot = bucket_of(id); ; slot = (slot + 1) & mask)
+            {
+                if (m_slots[slot] == EMPTY_SLOT)
+                {
+                    m_slots[slot] = static_cast<std::uint32_t>(m_entries.size());
+                    m_entries.emplace_back(id, std::move(value));
+                    return true;
+                }
+                else if (m_entries[m_slots[slot]].first == id)
+                {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * @brief   Retrieves the value mapped to the given ID, inserting a
+         *          default-constructed value if it is not present.
+         *
+         * @param   id      The symbol ID.
+         *
+         * @return  A reference to the mapped value.
+         */
+        auto operator[] (symbol_id id) -> T&
+        {
+            if (T* existing = find(id); existing != nullptr)
+            {
+                return *existing;
+            }
+
+            insert(id);
+            return m_entries.back().second;
+        }
+
+        auto size () const -> std::size_t  { return m_entries.size(); }
+        auto empty () const -> bool        { return m_entries.empty(); }
+        auto begin () const                { return m_entries.begin(); }
+        auto end () const                  { return m_entries.end(); }
+        auto begin ()                      { return m_entries.begin(); }
+        auto end ()                        { return m_entries.end(); }
+
+        /**
+         * @brief   Removes all entries from the map.
+         */
+        auto clear () -> void
+        {
+            m_entries.clear();
+            m_slots.clear();
+        }
+
+    private: /* Private Constants *********************************************/
+
+        static constexpr std::uint32_t EMPTY_SLOT = 0xFFFFFFFF;
+
+    private: /* Private Methods ***********************************************/
+
+        auto bucket_of (symbol_id id) const -> std::size_t
+        {
+            // - Fibonacci hashing spreads the sequentially-assigned IDs
+            //   across the table.
+            return (static_cast<std::uint32_t>(id * 0x9E3779B9u) >> 8) &
+                (m_slots.size() - 1);
+        }
+
+        auto locate (symbol_id id) const -> std::size_t
+        {
+            if (m_slots.empty())
+            {
+                return EMPTY_SLOT;
+            }
+
+            const std::size_t mask = m_slots.size() - 1;
+            for (std::size_t slot = bucket_of(id); ; slot = (slot + 1) & mask)
+            {
+                if (m_slots[slot] == EMPTY_SLOT ||
+                    m_entries[m_slots[slot]].first == id)
+                {
+                    return m_slots[slot];
+                }
+            }
+        }
+
+        auto rehash (std::size_t capacity) -> void
+        {
+            m_slots.assign(capacity, EMPTY_SLOT);
+
+            const std::size_t mask = capacity - 1;
+            for (std::size_t i = 0; i < m_entries.size(); ++i)
+            {
+                std::size_t slot = bucket_of(m_entries[i].first);
+                while (m_slots[slot] != EMPTY_SLOT)
+                {
+                    slot = (slot + 1) & mask;
+                }
+
+                m_slots[slot] = static_cast<std::uint32_t>(i);
+            }
+        }
+
+    private: /* Private Members ***********************************************/
+
+        std::vector<entry_type>     m_entries;  /** @brief The map's entries, in insertion order. */
+        std::vector<std::uint32_t>  m_slots;    /** @brief The open-addressing index into `m_entries`. */
+
+    };
+
+    /**
+     * @brief   A flat hash set of interned symbol IDs.
+     */
+    using symbol_set = symbol_map<std::monostate>;
+}
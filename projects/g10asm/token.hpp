@@ -11,6 +11,7 @@
 /* Public Includes ************************************************************/
 
 #include <g10asm/keyword_table.hpp>
+#include <g10asm/symbol_table.hpp>
 
 /* Public Constants and Enumerations ******************************************/
 
@@ -127,6 +128,12 @@ namespace g10asm
          */
         g10::optional_cref<keyword> keyword_value = std::nullopt;
 
+        /**
+         * @brief   For identifier and variable tokens, holds the interned ID of
+         *          its name (without the `$` prefix, for variables).
+         */
+        symbol_id symbol = INVALID_SYMBOL;
+
     public:
 
         /**
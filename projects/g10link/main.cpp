@@ -8,21 +8,34 @@
 
 /* Private Includes ***********************************************************/
 
+#include <g10/archive.hpp>
 #include <g10/program.hpp>
+#include <g10/time_report.hpp>
 
 /* Private Static Variables ***************************************************/
 
 namespace g10link
 {
     // Usage: `g10link [options] <input files> -o <output file>`
-    // - `<input files>` - One or more object files to link (required)
+    // - `<input files>` - One or more object files to link, and any archives to search (required)
     // - `-o <output file>`, `--output <output file>` - Specify the output file name (required)
     // - `-h`, `--help` - Show help message
     // - `-v`, `--version` - Show version info
+    // - `--time-report` - Show the time and memory spent in each phase
+    // - `--incremental` - Patch the previous output in place, where possible
+    // - `--gc-sections` - Drop the sections unreachable from the program's roots
+    // - `--keep <symbol>` - Keep the section defining a symbol with `--gc-sections`
+    // - `--icf` - Fold identical read-only sections into a single copy
+    // - `--order <file>` - Place the sections of hot code first, and of cold code last, in ROM
     static std::vector<std::string> s_input_files;  // Input object files to link
+    static std::vector<std::string> s_archive_files;// Input archive files to search
     static std::string s_output_file = "";          // `-o <file>`, `--output <file>` - Output file name
     static bool s_help = false;                     // `-h`, `--help` - Show help message
     static bool s_version = false;                  // `-v`, `--version` - Show version info
+    static bool s_time_report = false;              // `--time-report` - Show time and memory spent per phase
+    static bool s_incremental = false;              // `--incremental` - Relink the previous output in place
+    static std::string s_order_file = "";           // `--order <file>` - Section ordering file name
+    static g10::link_options s_link_options;        // `--gc-sections`, `--keep <symbol>`, `--icf`, `--order <file>` - Layout options
 }
 
 /* Private Functions **********************************************************/
@@ -56,11 +69,55 @@ namespace g10link
             {
                 s_version = true;
             }
+            else if (arg == "--time-report")
+            {
+                s_time_report = true;
+            }
+            else if (arg == "--incremental")
+            {
+                s_incremental = true;
+            }
+            else if (arg == "--gc-sections")
+            {
+                s_link_options.gc_sections = true;
+            }
+            else if (arg == "--icf")
+            {
+                s_link_options.fold_identical = true;
+            }
+            else if (arg == "--keep")
+            {
+                if (i + 1 < argc)
+                {
+                    s_link_options.keep_symbols.push_back(argv[++i]);
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing symbol after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--order")
+            {
+                if (i + 1 < argc)
+                {
+                    s_order_file = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing ordering file after '{}'.", arg);
+                    return false;
+                }
+            }
             else if (arg.starts_with("-"))
             {
                 std::println(stderr, "Error: Unknown argument '{}'.", arg);
                 return false;
             }
+            else if (g10::archive::is_archive(arg) == true)
+            {
+                s_archive_files.push_back(arg);
+            }
             else
             {
                 s_input_files.push_back(arg);
@@ -102,12 +159,416 @@ namespace g10link
     {
         std::println(
             "Usage: g10link [options] <input files> -o <output file>\n\n"
+            "Input files are object files, which are always linked, and archive files, whose\n"
+            "members are linked only if they define a symbol needed by another linked object.\n\n"
             "Options:\n"
             "  -o, --output <file>     Specify the output file name (required).\n"
             "  -h, --help              Show this help message and exit.\n"
             "  -v, --version           Show version information and exit.\n"
+            "      --time-report       Show the wall time and heap allocations of each linking phase,\n"
+            "                          and the peak memory usage.\n"
+            "      --incremental       Record the program's layout next to the output file, and\n"
+            "                          on later links, patch the output in place when only some\n"
+            "                          objects have changed and their sections still fit.\n"
+            "      --gc-sections       Drop the sections not reachable, through relocations, from\n"
+            "                          the entry point, the interrupt vectors or a kept symbol.\n"
+            "      --keep <symbol>     With '--gc-sections', always keep the section defining the\n"
+            "                          given symbol. May be given more than once.\n"
+            "      --icf               Fold identical read-only sections, whose relocations resolve\n"
+            "                          to the same targets, into a single copy.\n"
+            "      --order <file>      Lay out ROM by the given section ordering: each line names\n"
+            "                          a symbol, optionally followed by its execution count. The\n"
+            "                          sections defining the symbols are packed at the start of\n"
+            "                          ROM, by descending count, with uncounted symbols first in\n"
+            "                          the order listed; those with a count of zero are cold, and\n"
+            "                          packed at the end of ROM. Lines starting with '#' are\n"
+            "                          comments.\n"
         );
     }
+
+    static auto load_order_file () -> bool
+    {
+        std::ifstream file { s_order_file };
+        if (file.is_open() == false)
+        {
+            std::println(stderr,
+                "Error: Failed to open ordering file '{}'.", s_order_file);
+            return false;
+        }
+
+        // - Each line names a symbol, optionally followed by a count.
+        std::string line;
+        for (std::size_t line_number = 1; std::getline(file, line); ++line_number)
+        {
+            std::istringstream fields { line };
+            g10::link_order_entry entry;
+            if (!(fields >> entry.symbol) || entry.symbol.starts_with("#"))
+            {
+                continue;
+            }
+
+            std::string count, extra;
+            if (fields >> count)
+            {
+                std::uint64_t value = 0;
+                const auto [end, ec] = std::from_chars(count.data(),
+                    count.data() + count.size(), value);
+                if (ec != std::errc {} || end != count.data() + count.size() ||
+                    (fields >> extra))
+                {
+                    std::println(stderr,
+                        "Error: Invalid entry on line {} of ordering file '{}'.",
+                        line_number, s_order_file);
+                    return false;
+                }
+
+                entry.count = value;
+            }
+
+            s_link_options.section_order.push_back(std::move(entry));
+        }
+
+        return true;
+    }
+
+    static auto load_objects (
+        std::span<const std::string> paths,
+        std::vector<g10::object>& objects
+    ) -> bool
+    {
+        // - Load the object files on a pool of worker threads, each taking the
+        //   next file not yet claimed. Every file is loaded into its own slot,
+        //   so the objects stay in command-line order.
+        const std::size_t count = paths.size();
+        std::vector<std::string> errors(count);
+        std::atomic<std::size_t> next = 0;
+        auto worker = [&] ()
+        {
+            for (std::size_t i = next++; i < count; i = next++)
+            {
+                auto result = objects[i].load_from_file(paths[i]);
+                if (result.has_value() == false)
+                {
+                    errors[i] = std::move(result.error());
+                }
+            }
+        };
+
+        objects.resize(count);
+        const std::size_t worker_count = std::min<std::size_t>(count,
+            std::max(1u, std::thread::hardware_concurrency()));
+        if (worker_count <= 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(worker_count);
+            for (std::size_t i = 0; i < worker_count; ++i)
+            {
+                workers.emplace_back(worker);
+            }
+        }
+
+        // - Report the first failure in command-line order.
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (objects[i].is_good() == false)
+            {
+                std::println(stderr,
+                    "Error: Failed to load object file '{}': '{}'.",
+                    paths[i], errors[i]);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static auto load_archive_members (std::vector<g10::object>& objects)
+        -> bool
+    {
+        // - Load the archives' member tables and symbol indices. The members
+        //   themselves are only parsed if they are needed.
+        std::vector<g10::archive> archives(s_archive_files.size());
+        for (std::size_t i = 0; i < archives.size(); ++i)
+        {
+            auto result = archives[i].load_from_file(s_archive_files[i]);
+            if (result.has_value() == false)
+            {
+                std::println(stderr,
+                    "Error: Failed to load archive file '{}': '{}'.",
+                    s_archive_files[i], result.error());
+                return false;
+            }
+        }
+
+        // - Gather the symbols defined by the linked objects, and queue the
+        //   undefined symbols they reference, in order of first appearance.
+        std::unordered_set<std::string> defined;
+        std::deque<std::string> undefined;
+        auto add_symbols = [&] (const g10::object& obj)
+        {
+            for (const auto& sym : obj.get_symbols())
+            {
+                if (sym.binding == g10::symbol_binding::global ||
+                    sym.binding == g10::symbol_binding::weak)
+                {
+                    defined.insert(sym.name);
+                }
+            }
+
+            for (const auto& sym : obj.get_symbols())
+            {
+                if (sym.binding == g10::symbol_binding::extern_ &&
+                    defined.contains(sym.name) == false)
+                {
+                    undefined.push_back(sym.name);
+                }
+            }
+        };
+
+        for (const auto& obj : objects)
+        {
+            add_symbols(obj);
+        }
+
+        // - Resolve each undefined symbol from the first archive, in
+        //   command-line order, whose index names it. A member pulled in this
+        //   way may reference further undefined symbols, which are queued in
+        //   turn; symbols no archive defines are left for the linker to report.
+        std::set<std::pair<std::size_t, std::size_t>> loaded;
+        while (undefined.empty() == false)
+        {
+            const std::string name = std::move(undefined.front());
+            undefined.pop_front();
+            if (defined.contains(name) == true)
+            {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < archives.size(); ++i)
+            {
+                const auto member = archives[i].find_symbol(name);
+                if (member.has_value() == false)
+                {
+                    continue;
+                }
+                else if (loaded.emplace(i, member.value()).second == true)
+                {
+                    g10::object obj;
+                    auto result = archives[i].load_member(member.value(), obj);
+                    if (result.has_value() == false)
+                    {
+                        std::println(stderr,
+                            "Error: Failed to load object file '{}({})': '{}'.",
+                            s_archive_files[i],
+                            archives[i].get_members()[member.value()].name,
+                            result.error());
+                        return false;
+                    }
+
+                    add_symbols(obj);
+                    objects.push_back(std::move(obj));
+                }
+
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    static auto state_path () -> std::string
+    {
+        return s_output_file + std::string { g10::LINK_STATE_EXTENSION };
+    }
+
+    static auto hash_objects (std::vector<std::uint64_t>& hashes) -> bool
+    {
+        hashes.resize(s_input_files.size());
+        for (std::size_t i = 0; i < s_input_files.size(); ++i)
+        {
+            auto result = g10::link_state::hash_file(s_input_files[i]);
+            if (result.has_value() == false)
+            {
+                std::println(stderr,
+                    "Error: Failed to load object file '{}': '{}'.",
+                    s_input_files[i], result.error());
+                return false;
+            }
+
+            hashes[i] = result.value();
+        }
+
+        return true;
+    }
+
+    static auto hash_link_options () -> std::uint64_t
+    {
+        // - Serialize every option which shapes the program's layout. The
+        //   section ordering is hashed as parsed, so that only changes to its
+        //   entries, not to its comments, force a full link.
+        std::vector<std::uint8_t> buffer;
+        auto put_string = [&buffer] (std::string_view str)
+        {
+            buffer.insert(buffer.end(), str.begin(), str.end());
+            buffer.push_back(0);
+        };
+        auto put_u64 = [&buffer] (std::uint64_t value)
+        {
+            for (std::size_t i = 0; i < 8; ++i)
+            {
+                buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+            }
+        };
+
+        buffer.push_back(s_link_options.gc_sections ? 1 : 0);
+        buffer.push_back(s_link_options.fold_identical ? 1 : 0);
+        put_u64(s_link_options.keep_symbols.size());
+        for (const auto& symbol : s_link_options.keep_symbols)
+        {
+            put_string(symbol);
+        }
+
+        put_u64(s_link_options.section_order.size());
+        for (const auto& entry : s_link_options.section_order)
+        {
+            put_string(entry.symbol);
+            buffer.push_back(entry.count.has_value() ? 1 : 0);
+            put_u64(entry.count.value_or(0));
+        }
+
+        return g10::link_state::hash_bytes(buffer);
+    }
+
+    static auto relink (
+        g10::link_state& state,
+        std::vector<std::uint64_t>& hashes
+    ) -> std::optional<bool>
+    {
+        // - A full link is needed if there is no link state from a previous
+        //   link of the same objects, with the same layout options.
+        if (state.load_from_file(state_path()).has_value() == false ||
+            state.objects.size() != s_input_files.size() ||
+            state.options_hash != hash_link_options())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < s_input_files.size(); ++i)
+        {
+            if (state.objects[i].path != s_input_files[i])
+            {
+                return false;
+            }
+        }
+
+        // - Find the objects which have changed since the previous link, and
+        //   load only those.
+        std::vector<std::size_t> changed;
+        std::vector<std::string> changed_paths;
+        std::vector<g10::object> changed_objects;
+        {
+            g10::time_report::phase timer { "Load objects" };
+            if (hash_objects(hashes) == false)
+            {
+                return std::nullopt;
+            }
+
+            for (std::size_t i = 0; i < s_input_files.size(); ++i)
+            {
+                if (hashes[i] != state.objects[i].content_hash)
+                {
+                    changed.push_back(i);
+                    changed_paths.push_back(s_input_files[i]);
+                }
+            }
+
+            if (load_objects(changed_paths, changed_objects) == false)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // - Patch the previous output in place.
+        g10::program program;
+        {
+            g10::time_report::phase timer { "Relink program" };
+            auto relink_result = program.relink_in_place(s_output_file, state,
+                changed, changed_objects);
+            if (relink_result.has_value() == false)
+            {
+                std::println(stderr,
+                    "Error: Failed to relink program '{}': '{}'.",
+                    s_output_file, relink_result.error());
+                return std::nullopt;
+            }
+            else if (relink_result.value() == false)
+            {
+                return false;
+            }
+        }
+
+        for (const std::size_t i : changed)
+        {
+            state.objects[i].content_hash = hashes[i];
+        }
+
+        auto save_result = state.save_to_file(state_path());
+        if (save_result.has_value() == false)
+        {
+            std::println(stderr,
+                "Error: Failed to save link state to file '{}': '{}'.",
+                state_path(), save_result.error());
+            return std::nullopt;
+        }
+
+        return true;
+    }
+
+    static auto save_link_state (
+        g10::link_state& state,
+        std::vector<std::uint64_t>& hashes
+    ) -> bool
+    {
+        // - Reuse the objects' content hashes if they were computed by a
+        //   failed attempt to relink.
+        if (hashes.size() != s_input_files.size() &&
+            hash_objects(hashes) == false)
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < s_input_files.size(); ++i)
+        {
+            state.objects[i].path = s_input_files[i];
+            state.objects[i].content_hash = hashes[i];
+        }
+
+        auto output_hash = g10::link_state::hash_file(s_output_file);
+        if (output_hash.has_value() == false)
+        {
+            std::println(stderr,
+                "Error: Failed to save link state to file '{}': '{}'.",
+                state_path(), output_hash.error());
+            return false;
+        }
+
+        state.output_hash = output_hash.value();
+        state.options_hash = hash_link_options();
+        auto save_result = state.save_to_file(state_path());
+        if (save_result.has_value() == false)
+        {
+            std::println(stderr,
+                "Error: Failed to save link state to file '{}': '{}'.",
+                state_path(), save_result.error());
+            return false;
+        }
+
+        return true;
+    }
 }
 
 /* Main Function **************************************************************/
@@ -133,22 +594,67 @@ auto main (int argc, const char** argv) -> int
         return 0;
     }
 
+    if (g10link::s_time_report == true)
+    {
+        g10::time_report::enable();
+    }
+
+    // - Load the section ordering file, if given.
+    if (g10link::s_order_file.empty() == false &&
+        g10link::load_order_file() == false)
+    {
+        return 1;
+    }
+
+    // - The objects pulled in from archives can change from one link to the
+    //   next, so programs linked with archives are not relinked in place.
+    if (g10link::s_incremental == true &&
+        g10link::s_archive_files.empty() == false)
+    {
+        std::println(stderr,
+            "Warning: '--incremental' is not supported with archive files; "
+            "performing a full link.");
+        g10link::s_incremental = false;
+    }
+
+    // - With `--incremental`, first try to patch the previous output in
+    //   place, falling back to a full link.
+    g10::link_state state;
+    std::vector<std::uint64_t> hashes;
+    if (g10link::s_incremental == true)
+    {
+        const auto relinked = g10link::relink(state, hashes);
+        if (relinked.has_value() == false)
+        {
+            return 1;
+        }
+        else if (relinked.value() == true)
+        {
+            if (g10::time_report::is_enabled() == true)
+            {
+                g10::time_report::print(stdout);
+            }
+
+            return 0;
+        }
+    }
+
     // - Load input object files.
     std::vector<g10::object> objects;
-    for (const auto& input_path : g10link::s_input_files)
     {
-        const auto& obj = objects.emplace_back(input_path);
-        if (obj.is_good() == false)
+        g10::time_report::phase timer { "Load objects" };
+        if (g10link::load_objects(g10link::s_input_files, objects) == false ||
+            g10link::load_archive_members(objects) == false)
         {
-            std::println(stderr, 
-                "Error: Failed to load object file '{}'.", input_path);
             return 1;
         }
     }
 
     // - Link object files into a program.
     g10::program program;
-    auto link_result = program.link_from_objects(objects);
+    auto link_result = program.link_from_objects(objects,
+        (g10link::s_incremental == true) ? &state : nullptr,
+        g10link::s_link_options);
     if (link_result.has_value() == false)
     {
         std::println(stderr, 
@@ -158,14 +664,30 @@ auto main (int argc, const char** argv) -> int
     }
 
     // - Save the linked program to the output file.
-    auto save_result = program.save_to_file(g10link::s_output_file);
-    if (save_result.has_value() == false)
     {
-        std::println(stderr, 
-            "Error: Failed to save program to file '{}': '{}'.",
-            g10link::s_output_file, save_result.error());
+        g10::time_report::phase timer { "Save program" };
+        auto save_result = program.save_to_file(g10link::s_output_file);
+        if (save_result.has_value() == false)
+        {
+            std::println(stderr, 
+                "Error: Failed to save program to file '{}': '{}'.",
+                g10link::s_output_file, save_result.error());
+            return 1;
+        }
+    }
+
+    // - Record the link state next to the output file, if requested.
+    if (g10link::s_incremental == true &&
+        g10link::save_link_state(state, hashes) == false)
+    {
         return 1;
     }
 
+    // - Show the time report, if requested.
+    if (g10::time_report::is_enabled() == true)
+    {
+        g10::time_report::print(stdout);
+    }
+
     return 0;
 }
@@ -0,0 +1,690 @@
+/**
+ * @file    g10wcet/analyzer.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 worst-case execution time
+ *          analyzer's control-flow analysis component.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10wcet/analyzer.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10wcet
+{
+    // - The upper bytes of the opcodes which affect control flow.
+    constexpr std::uint8_t OP_STOP      = 0x01;
+    constexpr std::uint8_t OP_HALT      = 0x02;
+    constexpr std::uint8_t OP_JMP       = 0x40;
+    constexpr std::uint8_t OP_JMP_REG   = 0x41;
+    constexpr std::uint8_t OP_JPB       = 0x42;
+    constexpr std::uint8_t OP_CALL      = 0x43;
+    constexpr std::uint8_t OP_INT       = 0x44;
+    constexpr std::uint8_t OP_RET       = 0x45;
+    constexpr std::uint8_t OP_RETI      = 0x46;
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10wcet
+{
+    static auto parse_number (std::string_view text) -> std::optional<std::uint32_t>
+    {
+        int base = 10;
+        if (text.starts_with("$"))
+        {
+            text.remove_prefix(1);
+            base = 16;
+        }
+        else if (text.starts_with("0x") || text.starts_with("0X"))
+        {
+            text.remove_prefix(2);
+            base = 16;
+        }
+
+        try
+        {
+            std::size_t consumed = 0;
+            const std::string digits { text };
+            const auto value = std::stoull(digits, &consumed, base);
+            if (consumed != digits.size() || value > 0xFFFFFFFF)
+            {
+                return std::nullopt;
+            }
+
+            return static_cast<std::uint32_t>(value);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+}
+
+/* Public Methods *************************************************************/
+
+namespace g10wcet
+{
+    analyzer::analyzer (
+        const g10::program& program,
+        std::unordered_map<std::uint32_t, std::uint32_t> loop_bounds
+    ) :
+        m_program       { program },
+        m_loop_bounds   { std::move(loop_bounds) }
+    {
+    }
+
+    auto analyzer::analyze (std::uint32_t address) -> const routine_report&
+    {
+        // - Return the memoized report, if this routine was analyzed already.
+        if (auto it = m_reports.find(address); it != m_reports.end())
+        {
+            return it->second;
+        }
+
+        // - The map's references remain valid as further routines are added
+        //   to it while this one is analyzed.
+        auto& report = m_reports[address];
+        report.address = address;
+        m_in_progress.insert(address);
+
+        if (auto result = build_blocks(report); !result.has_value())
+        {
+            report.problem = result.error();
+        }
+        else if (auto wcet = compute_wcet(report); !wcet.has_value())
+        {
+            report.problem = wcet.error();
+        }
+        else
+        {
+            report.wcet = wcet.value();
+        }
+
+        m_in_progress.erase(address);
+        return report;
+    }
+
+    auto analyzer::parse_annotations (const fs::path& path)
+        -> g10::result<std::unordered_map<std::uint32_t, std::uint32_t>>
+    {
+        std::ifstream file { path };
+        if (file.is_open() == false)
+        {
+            return g10::error("Failed to open annotation file '{}' for reading.",
+                path.string());
+        }
+
+        std::unordered_map<std::uint32_t, std::uint32_t> loop_bounds;
+        std::string line = "";
+        std::size_t line_number = 0;
+        while (std::getline(file, line))
+        {
+            ++line_number;
+
+            // - Strip the line's comment, if any, then split what remains into
+            //   whitespace-separated words.
+            std::vector<std::string_view> words;
+            std::string_view rest { line };
+            rest = rest.substr(0, rest.find_first_of("#;"));
+            while (rest.empty() == false)
+            {
+                const auto start = rest.find_first_not_of(" \t\r");
+                if (start == std::string_view::npos)
+                {
+                    break;
+                }
+
+                rest.remove_prefix(start);
+                const auto end = std::min(rest.find_first_of(" \t\r"), rest.size());
+                words.push_back(rest.substr(0, end));
+                rest.remove_prefix(end);
+            }
+
+            if (words.empty() == true)
+            {
+                continue;
+            }
+
+            if (words[0] != "loop" || words.size() != 3)
+            {
+                return g10::error("Expected 'loop <header-address> <iterations>' "
+                    "({}:{})", path.string(), line_number);
+            }
+
+            // - Header addresses are written in hexadecimal, as the analyzer
+            //   reports them. A bare number is rejected rather than read as
+            //   decimal, which would silently name the wrong address.
+            const bool prefixed = words[1].starts_with("$") ||
+                words[1].starts_with("0x") || words[1].starts_with("0X");
+            const auto header = prefixed ?
+                parse_number(words[1]) : std::nullopt;
+            const auto bound = parse_number(words[2]);
+            if (header.has_value() == false)
+            {
+                return g10::error("Invalid loop header address '{}'; expected a "
+                    "hexadecimal address prefixed with '$' or '0x' ({}:{})",
+                    words[1], path.string(), line_number);
+            }
+            else if (bound.has_value() == false || bound.value() == 0)
+            {
+                return g10::error("Invalid loop iteration count '{}' ({}:{})",
+                    words[2], path.string(), line_number);
+            }
+
+            loop_bounds[header.value()] = bound.value();
+        }
+
+        return loop_bounds;
+    }
+}
+
+/* Private Methods ************************************************************/
+
+namespace g10wcet
+{
+    auto analyzer::decode (std::uint32_t address) const -> instruction
+    {
+        const std::uint16_t opcode = static_cast<std::uint16_t>(
+            m_program.read_byte(address) |
+            (m_program.read_byte(address + 1) << 8));
+
+        return { .opcode = opcode, .timing = g10::cpu::timing_of(opcode) };
+    }
+
+    auto analyzer::read_dword (std::uint32_t address) const -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(m_program.read_byte(address)) |
+            (static_cast<std::uint32_t>(m_program.read_byte(address + 1)) << 8) |
+            (static_cast<std::uint32_t>(m_program.read_byte(address + 2)) << 16) |
+            (static_cast<std::uint32_t>(m_program.read_byte(address + 3)) << 24);
+    }
+
+    auto analyzer::build_blocks (routine_report& report) -> g10::result<void>
+    {
+        // - Discover every instruction reachable from the routine's first
+        //   instruction, noting those which begin a basic block: branch
+        //   targets, and the instructions following conditional branches.
+        std::set<std::uint32_t> visited;
+        std::set<std::uint32_t> leaders { report.address };
+        std::vector<std::uint32_t> pending { report.address };
+        while (pending.empty() == false)
+        {
+            const std::uint32_t address = pending.back();
+            pending.pop_back();
+            if (visited.insert(address).second == false)
+            {
+                continue;
+            }
+
+            const auto instr = decode(address);
+            if (instr.timing.length == 0)
+            {
+                return g10::error("invalid opcode ${:04X} at ${:08X}",
+                    instr.opcode, address);
+            }
+
+            const std::uint32_t next = address + instr.timing.length;
+            const bool conditional = (g10::cond(instr.opcode) !=
+                g10::CC_NO_CONDITION);
+            switch (instr.opcode >> 8)
+            {
+                case OP_JMP:
+                case OP_JPB:
+                {
+                    const std::uint32_t target = ((instr.opcode >> 8) == OP_JMP) ?
+                        read_dword(address + 2) :
+                        next + static_cast<std::int16_t>(read_dword(address + 2) & 0xFFFF);
+                    leaders.insert(target);
+                    pending.push_back(target);
+                    if (conditional == true)
+                    {
+                        leaders.insert(next);
+                        pending.push_back(next);
+                    }
+                } break;
+
+                case OP_JMP_REG:
+                    return g10::error("indirect jump at ${:08X} cannot be "
+                        "followed", address);
+
+                case OP_STOP:
+                case OP_HALT:
+                    return g10::error("{} at ${:08X} waits indefinitely",
+                        ((instr.opcode >> 8) == OP_STOP) ? "STOP" : "HALT",
+                        address);
+
+                case OP_RET:
+                    if (conditional == true)
+                    {
+                        leaders.insert(next);
+                        pending.push_back(next);
+                    }
+                    break;
+
+                case OP_RETI:
+                    break;
+
+                default:
+                    pending.push_back(next);
+                    break;
+            }
+        }
+
+        // - Group the instructions into basic blocks, in address order. Edge
+        //   targets are recorded as addresses, then resolved to block indices
+        //   once every block is known.
+        auto& blocks = report.blocks;
+        std::unordered_map<std::uint32_t, std::size_t> block_of;
+        bool block_open = false;
+        for (const std::uint32_t address : visited)
+        {
+            if (block_open == true && blocks.back().end > address)
+            {
+                return g10::error("instructions overlap at ${:08X}", address);
+            }
+            else if (block_open == true && leaders.contains(address) == true)
+            {
+                blocks.back().successors.push_back({ address, 0 });
+                block_open = false;
+            }
+
+            if (block_open == false)
+            {
+                block_of[address] = blocks.size();
+                blocks.push_back({ .start = address, .end = address, .cycles = 0,
+                    .successors = {} });
+                block_open = true;
+            }
+
+            auto& block = blocks.back();
+            const auto instr = decode(address);
+            const std::uint32_t next = address + instr.timing.length;
+            const bool conditional = (g10::cond(instr.opcode) !=
+                g10::CC_NO_CONDITION);
+            block.end = next;
+
+            switch (instr.opcode >> 8)
+            {
+                case OP_JMP:
+                case OP_JPB:
+                {
+                    const std::uint32_t target = ((instr.opcode >> 8) == OP_JMP) ?
+                        read_dword(address + 2) :
+                        next + static_cast<std::int16_t>(read_dword(address + 2) & 0xFFFF);
+                    if (conditional == true)
+                    {
+                        block.successors.push_back({ next, instr.timing.cycles });
+                    }
+
+                    block.successors.push_back({ target, instr.timing.taken_cycles });
+                    block_open = false;
+                } break;
+
+                case OP_RET:
+                    if (conditional == true)
+                    {
+                        block.successors.push_back({ next, instr.timing.cycles });
+                    }
+
+                    block.successors.push_back({ EXIT_BLOCK, instr.timing.taken_cycles });
+                    block_open = false;
+                    break;
+
+                case OP_RETI:
+                    block.successors.push_back({ EXIT_BLOCK, instr.timing.cycles });
+                    block_open = false;
+                    break;
+
+                case OP_CALL:
+                case OP_INT:
+                {
+                    // - Charge the called subroutine's worst case to this
+                    //   block, as though the call were always taken.
+                    const std::uint32_t target = ((instr.opcode >> 8) == OP_CALL) ?
+                        read_dword(address + 2) :
+                        IVT_START + (instr.opcode & 0xFF) * IVT_VECTOR_SIZE;
+                    if (m_in_progress.contains(target) == true)
+                    {
+                        return g10::error("recursive call to ${:08X} at ${:08X}",
+                            target, address);
+                    }
+
+                    const auto& callee = analyze(target);
+                    if (callee.wcet.has_value() == false)
+                    {
+                        return g10::error("call at ${:08X}: {}",
+                            address, callee.problem);
+                    }
+
+                    block.cycles += instr.timing.taken_cycles +
+                        callee.wcet.value();
+                } break;
+
+                default:
+                    block.cycles += instr.timing.cycles;
+                    break;
+            }
+        }
+
+        for (auto& block : blocks)
+        {
+            for (auto& edge : block.successors)
+            {
+                if (edge.target != EXIT_BLOCK)
+                {
+                    edge.target = block_of.at(static_cast<std::uint32_t>(edge.target));
+                }
+            }
+        }
+
+        return {};
+    }
+
+    auto analyzer::compute_wcet (routine_report& report)
+        -> g10::result<std::uint64_t>
+    {
+        const auto& blocks = report.blocks;
+        const std::size_t count = blocks.size();
+        const std::size_t entry = static_cast<std::size_t>(
+            std::ranges::find(blocks, report.address, &basic_block::start) -
+            blocks.begin());
+
+        // - Number the blocks in depth-first postorder from the entry block,
+        //   noting retreating edges: those to a block still being visited.
+        std::vector<std::size_t> postorder_index(count, 0);
+        std::vector<std::size_t> postorder;
+        std::vector<std::pair<std::size_t, std::size_t>> retreating_edges;
+        {
+            std::vector<std::uint8_t> state(count, 0);    // 0: unvisited, 1: on stack, 2: done
+            std::vector<std::pair<std::size_t, std::size_t>> stack { { entry, 0 } };
+            state[entry] = 1;
+            while (stack.empty() == false)
+            {
+                auto& [block, next_edge] = stack.back();
+                if (next_edge < blocks[block].successors.size())
+                {
+                    const std::size_t target = blocks[block].successors[next_edge++].target;
+                    if (target == EXIT_BLOCK)
+                    {
+                        continue;
+                    }
+                    else if (state[target] == 1)
+                    {
+                        retreating_edges.push_back({ block, target });
+                    }
+                    else if (state[target] == 0)
+                    {
+                        state[target] = 1;
+                        stack.push_back({ target, 0 });
+                    }
+
+                    continue;
+                }
+
+                state[block] = 2;
+                postorder_index[block] = postorder.size();
+                postorder.push_back(block);
+                stack.pop_back();
+            }
+        }
+
+        // - Compute each block's immediate dominator.
+        std::vector<std::vector<std::size_t>> predecessors(count);
+        for (std::size_t block = 0; block < count; ++block)
+        {
+            for (const auto& edge : blocks[block].successors)
+            {
+                if (edge.target != EXIT_BLOCK)
+                {
+                    predecessors[edge.target].push_back(block);
+                }
+            }
+        }
+
+        std::vector<std::size_t> idom(count, EXIT_BLOCK);
+        idom[entry] = entry;
+        for (bool changed = true; changed == true; )
+        {
+            changed = false;
+            for (auto it = postorder.rbegin(); it != postorder.rend(); ++it)
+            {
+                if (*it == entry)
+                {
+                    continue;
+                }
+
+                std::size_t new_idom = EXIT_BLOCK;
+                for (std::size_t pred : predecessors[*it])
+                {
+                    if (idom[pred] == EXIT_BLOCK)
+                    {
+                        continue;
+                    }
+                    else if (new_idom == EXIT_BLOCK)
+                    {
+                        new_idom = pred;
+                        continue;
+                    }
+
+                    std::size_t a = pred, b = new_idom;
+                    while (a != b)
+                    {
+                        while (postorder_index[a] < postorder_index[b]) { a = idom[a]; }
+                        while (postorder_index[b] < postorder_index[a]) { b = idom[b]; }
+                    }
+
+                    new_idom = a;
+                }
+
+                if (idom[*it] != new_idom)
+                {
+                    idom[*it] = new_idom;
+                    changed = true;
+                }
+            }
+        }
+
+        const auto dominates = [&] (std::size_t dominator, std::size_t block)
+        {
+            while (block != dominator && block != entry)
+            {
+                block = idom[block];
+            }
+
+            return block == dominator;
+        };
+
+        // - Every retreating edge must be a back edge - one whose target
+        //   dominates its source - for the loops to be well-nested. Gather
+        //   each loop's body: the blocks which reach a back edge's source
+        //   without passing through its header.
+        std::map<std::size_t, std::set<std::size_t>> loop_bodies;
+        for (const auto& [latch, header] : retreating_edges)
+        {
+            if (dominates(header, latch) == false)
+            {
+                return g10::error("loop entered other than through its "
+                    "header at ${:08X}", blocks[header].start);
+            }
+
+            auto& body = loop_bodies[header];
+            body.insert(header);
+            std::vector<std::size_t> pending { latch };
+            while (pending.empty() == false)
+            {
+                const std::size_t block = pending.back();
+                pending.pop_back();
+                if (body.insert(block).second == true)
+                {
+                    pending.insert(pending.end(), predecessors[block].begin(),
+                        predecessors[block].end());
+                }
+            }
+        }
+
+        // - Collapse each loop, innermost first, into its header node. The
+        //   working graph's nodes are the blocks which are not (yet) part of
+        //   a collapsed loop.
+        std::vector<std::size_t> representative(count);
+        std::vector<std::uint64_t> cycles(count);
+        std::vector<std::vector<block_edge>> successors(count);
+        for (std::size_t block = 0; block < count; ++block)
+        {
+            representative[block] = block;
+            cycles[block] = blocks[block].cycles;
+            successors[block] = blocks[block].successors;
+        }
+
+        const auto find = [&] (std::size_t block)
+        {
+            while (block != EXIT_BLOCK && representative[block] != block)
+            {
+                block = representative[block];
+            }
+
+            return block;
+        };
+
+        // - Computes the longest paths from `start` through the given nodes,
+        //   ignoring edges back into `start`. Returns the longest path back
+        //   into `start`, the longest path leaving the nodes, and the nodes
+        //   (or `EXIT_BLOCK`) left to.
+        struct region_costs final
+        {
+            std::uint64_t iteration = 0;
+            std::uint64_t exit = 0;
+            bool exits = false;
+            std::set<std::size_t> exit_targets;
+        };
+
+        const auto longest_paths = [&] (std::size_t start,
+            const std::set<std::size_t>& nodes) -> region_costs
+        {
+            // - Order the nodes topologically, by reverse postorder.
+            std::vector<std::size_t> order;
+            std::set<std::size_t> seen { start };
+            std::vector<std::pair<std::size_t, std::size_t>> stack { { start, 0 } };
+            while (stack.empty() == false)
+            {
+                auto& [node, next_edge] = stack.back();
+                if (next_edge < successors[node].size())
+                {
+                    const std::size_t target = find(successors[node][next_edge++].target);
+                    if (target != EXIT_BLOCK && target != start &&
+                        nodes.contains(target) && seen.insert(target).second)
+                    {
+                        stack.push_back({ target, 0 });
+                    }
+
+                    continue;
+                }
+
+                order.push_back(node);
+                stack.pop_back();
+            }
+
+            region_costs costs {};
+            std::map<std::size_t, std::uint64_t> distance { { start, 0 } };
+            for (auto it = order.rbegin(); it != order.rend(); ++it)
+            {
+                const std::uint64_t base = distance[*it] + cycles[*it];
+                for (const auto& edge : successors[*it])
+                {
+                    const std::size_t target = find(edge.target);
+                    const std::uint64_t length = base + edge.cycles;
+                    if (target == start)
+                    {
+                        costs.iteration = std::max(costs.iteration, length);
+                    }
+                    else if (target != EXIT_BLOCK && nodes.contains(target))
+                    {
+                        distance[target] = std::max(distance[target], length);
+                    }
+                    else
+                    {
+                        costs.exit = std::max(costs.exit, length);
+                        costs.exits = true;
+                        costs.exit_targets.insert(target);
+                    }
+                }
+            }
+
+            return costs;
+        };
+
+        std::vector<std::pair<std::size_t, std::set<std::size_t>>> loops {
+            loop_bodies.begin(), loop_bodies.end() };
+        std::ranges::stable_sort(loops, {},
+            [] (const auto& loop) { return loop.second.size(); });
+
+        std::string problem = "";
+        for (const auto& [header, body] : loops)
+        {
+            std::set<std::size_t> nodes;
+            for (std::size_t block : body)
+            {
+                nodes.insert(find(block));
+            }
+
+            const auto costs = longest_paths(header, nodes);
+            const auto bound = m_loop_bounds.find(blocks[header].start);
+            report.loops.push_back({
+                .header = blocks[header].start,
+                .bound = (bound != m_loop_bounds.end()) ? bound->second : 0,
+                .iteration_cycles = costs.iteration,
+                .exit_cycles = costs.exit
+            });
+
+            if (bound == m_loop_bounds.end() && problem.empty() == true)
+            {
+                problem = std::format("loop at ${:08X} has no iteration bound",
+                    blocks[header].start);
+            }
+
+            // - The loop's header is passed through at most `bound` times:
+            //   `bound - 1` full iterations, then a final pass to an exit.
+            const std::uint64_t passes = (bound != m_loop_bounds.end()) ?
+                bound->second : 1;
+            cycles[header] = (passes - 1) * costs.iteration + costs.exit;
+            successors[header].clear();
+            for (std::size_t target : costs.exit_targets)
+            {
+                successors[header].push_back({ target, 0 });
+            }
+
+            for (std::size_t node : nodes)
+            {
+                if (node != header)
+                {
+                    representative[node] = header;
+                }
+            }
+        }
+
+        if (problem.empty() == false)
+        {
+            return g10::error("{}", problem);
+        }
+
+        // - With every loop collapsed, the longest path from the entry block
+        //   to a return is the routine's worst-case execution time.
+        std::set<std::size_t> nodes;
+        for (std::size_t block = 0; block < count; ++block)
+        {
+            nodes.insert(find(block));
+        }
+
+        const auto costs = longest_paths(find(entry), nodes);
+        if (costs.exits == false)
+        {
+            return g10::error("routine at ${:08X} never returns",
+                report.address);
+        }
+
+        return costs.exit;
+    }
+}
@@ -0,0 +1,273 @@
+/**
+ * @file    g10wcet/analyzer.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains definitions for the G10 worst-case execution time
+ *          analyzer's control-flow analysis component.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <g10/cpu.hpp>
+#include <g10/program.hpp>
+
+/* Public Constants and Enumerations ******************************************/
+
+namespace g10wcet
+{
+    /**
+     * @brief   The starting address of the CPU's Interrupt Vector Table (IVT).
+     */
+    constexpr std::uint32_t IVT_START = 0x00001000;
+
+    /**
+     * @brief   The size, in bytes, of each interrupt vector subroutine's slot
+     *          in the Interrupt Vector Table.
+     */
+    constexpr std::uint32_t IVT_VECTOR_SIZE = 0x80;
+
+    /**
+     * @brief   The number of interrupt vectors supported by the CPU.
+     */
+    constexpr std::uint32_t IVT_VECTOR_COUNT = 32;
+
+    /**
+     * @brief   The number of M-cycles consumed by the CPU to service an
+     *          interrupt, before the first instruction of its handler is
+     *          fetched: two for a wait state, four to push `PC`, and one to
+     *          move `PC` to the handler.
+     */
+    constexpr std::uint64_t INTERRUPT_ENTRY_CYCLES = 7;
+
+    /**
+     * @brief   A successor block index denoting that control leaves the
+     *          routine, via `RET` or `RETI`.
+     */
+    constexpr std::size_t EXIT_BLOCK = static_cast<std::size_t>(-1);
+}
+
+/* Public Unions and Structures ***********************************************/
+
+namespace g10wcet
+{
+    /**
+     * @brief   Defines a structure representing a control-flow edge leaving a
+     *          basic block.
+     */
+    struct block_edge final
+    {
+        std::size_t     target;             /** @brief Index of the successor block, or `EXIT_BLOCK`. */
+        std::uint64_t   cycles;             /** @brief M-cycles consumed by the block's final branch when leaving via this edge. */
+    };
+
+    /**
+     * @brief   Defines a structure representing a basic block: a run of
+     *          instructions which is only entered at its first instruction,
+     *          and only branches at its last.
+     */
+    struct basic_block final
+    {
+        std::uint32_t   start;              /** @brief Address of the block's first instruction. */
+        std::uint32_t   end;                /** @brief Address just past the block's last instruction. */
+        std::uint64_t   cycles;             /** @brief M-cycles consumed by the block, excluding its final branch, including called subroutines. */
+        std::vector<block_edge> successors; /** @brief The edges leaving the block. */
+    };
+
+    /**
+     * @brief   Defines a structure describing a loop found in a routine.
+     */
+    struct loop_report final
+    {
+        std::uint32_t   header;             /** @brief Address of the loop's header block. */
+        std::uint32_t   bound;              /** @brief The loop's iteration bound, or `0` if it has not been annotated. */
+        std::uint64_t   iteration_cycles;   /** @brief Worst-case M-cycles of one iteration, from the header back to the header. */
+        std::uint64_t   exit_cycles;        /** @brief Worst-case M-cycles of the final iteration, from the header to an exit. */
+    };
+
+    /**
+     * @brief   Defines a structure describing the analysis of a routine: the
+     *          program's entry point, an interrupt handler, or a subroutine.
+     */
+    struct routine_report final
+    {
+        std::uint32_t   address;            /** @brief Address of the routine's first instruction. */
+        std::vector<basic_block> blocks;    /** @brief The routine's basic blocks, in address order. */
+        std::vector<loop_report> loops;     /** @brief The routine's loops, innermost first. */
+
+        /**
+         * @brief   The routine's worst-case execution time in M-cycles, from
+         *          its first instruction up to and including its return, or
+         *          `std::nullopt` if it cannot be bounded.
+         */
+        std::optional<std::uint64_t> wcet;
+
+        /**
+         * @brief   If `wcet` is not available, describes why.
+         */
+        std::string problem;
+    };
+}
+
+/* Public Classes *************************************************************/
+
+namespace g10wcet
+{
+    /**
+     * @brief   Defines a class representing the G10 worst-case execution time
+     *          analyzer.
+     *
+     * The analyzer decodes a linked program, starting from a routine's first
+     * instruction, and builds the routine's control-flow graph of basic
+     * blocks. Each block is costed using the instruction timings documented
+     * in the G10 CPU specification; conditional branches are costed by the
+     * edge taken. Subroutines reached by `CALL` and `INT` are analyzed in
+     * turn, and their worst-case execution times are charged to the calling
+     * block.
+     *
+     * Loops are found as the back edges of the graph, and must be annotated
+     * with an iteration bound. Each loop is collapsed, innermost first, into
+     * a single node costing `(bound - 1)` worst-case iterations plus its
+     * worst-case final pass to an exit; the worst-case execution time is then
+     * the longest path through the resulting loop-free graph.
+     *
+     * Routines containing indirect jumps, recursion, irreducible loops,
+     * `HALT` or `STOP` cannot be bounded, and are reported as such.
+     */
+    class analyzer final
+    {
+    public:
+
+        /**
+         * @brief   Constructs an analyzer for the given program.
+         *
+         * @param   program     The linked program to analyze.
+         * @param   loop_bounds The iteration bounds of the program's loops,
+         *                      keyed by the address of each loop's header.
+         */
+        analyzer (
+            const g10::program& program,
+            std::unordered_map<std::uint32_t, std::uint32_t> loop_bounds
+        );
+
+        /**
+         * @brief   Analyzes the routine starting at the given address, and any
+         *          subroutines it calls. Results are memoized.
+         *
+         * @param   address     The address of the routine's first instruction.
+         *
+         * @return  A constant reference to the routine's report.
+         */
+        auto analyze (std::uint32_t address) -> const routine_report&;
+
+        /**
+         * @brief   Retrieves the reports of all routines analyzed so far.
+         *
+         * @return  The reports, keyed by routine address.
+         */
+        inline auto get_reports () const
+            -> const std::map<std::uint32_t, routine_report>&
+            { return m_reports; }
+
+        /**
+         * @brief   Parses a loop bound annotation file.
+         *
+         * Comments begin with `#` or `;` and run to the end of the line.
+         * Each remaining non-empty line must be of the form
+         * `loop <header-address> <iterations>`, where `<header-address>` is
+         * the address of the loop's first instruction - the target of its
+         * backward branch - and `<iterations>` is the maximum number of times
+         * that instruction is executed, each time the loop is entered. Numbers may be written in decimal, or in
+         * hexadecimal with a `$` or `0x` prefix.
+         *
+         * @param   path    The path of the annotation file.
+         *
+         * @return  If successful, returns the loop bounds keyed by header
+         *          address;
+         *          Otherwise, returns an error message describing the failure.
+         */
+        static auto parse_annotations (const fs::path& path)
+            -> g10::result<std::unordered_map<std::uint32_t, std::uint32_t>>;
+
+    private: /* Private Types *************************************************/
+
+        /**
+         * @brief   Describes a single decoded instruction.
+         */
+        struct instruction final
+        {
+            std::uint16_t           opcode;
+            g10::instruction_timing timing;
+        };
+
+    private: /* Private Methods ***********************************************/
+
+        /**
+         * @brief   Decodes the instruction at the given address.
+         *
+         * @param   address     The instruction's address.
+         *
+         * @return  The decoded instruction. Its length is `0` if the opcode
+         *          is invalid.
+         */
+        auto decode (std::uint32_t address) const -> instruction;
+
+        /**
+         * @brief   Reads a little-endian 32-bit value from the program.
+         *
+         * @param   address     The address of the value.
+         *
+         * @return  The value read.
+         */
+        auto read_dword (std::uint32_t address) const -> std::uint32_t;
+
+        /**
+         * @brief   Discovers the instructions reachable from the routine's
+         *          first instruction, and groups them into basic blocks.
+         *
+         * @param   report  The routine's report, to which blocks are added.
+         *
+         * @return  If successful, returns `void`;
+         *          Otherwise, returns a description of why the routine cannot
+         *          be analyzed.
+         */
+        auto build_blocks (routine_report& report) -> g10::result<void>;
+
+        /**
+         * @brief   Finds and collapses the routine's loops, then computes its
+         *          worst-case execution time.
+         *
+         * @param   report  The routine's report, whose blocks have been built.
+         *
+         * @return  If successful, returns the routine's worst-case execution
+         *          time in M-cycles;
+         *          Otherwise, returns a description of why it is unbounded.
+         */
+        auto compute_wcet (routine_report& report) -> g10::result<std::uint64_t>;
+
+    private: /* Private Members ***********************************************/
+
+        const g10::program& m_program;  /** @brief The program being analyzed. */
+
+        /**
+         * @brief   The iteration bounds of the program's loops, keyed by the
+         *          address of each loop's header.
+         */
+        std::unordered_map<std::uint32_t, std::uint32_t> m_loop_bounds;
+
+        /**
+         * @brief   The reports of the routines analyzed so far, keyed by the
+         *          routine's address.
+         */
+        std::map<std::uint32_t, routine_report> m_reports;
+
+        /**
+         * @brief   The addresses of the routines currently being analyzed,
+         *          used to detect recursion.
+         */
+        std::unordered_set<std::uint32_t> m_in_progress;
+
+    };
+}
@@ -0,0 +1,379 @@
+/**
+ * @file    g10wcet/main.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-18
+ *
+ * @brief   Contains the primary entry point for the G10 Worst-Case Execution
+ *          Time Analyzer Tool.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <g10wcet/analyzer.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace g10wcet
+{
+    /**
+     * @brief   Describes one of the testbed timer's clock speed settings,
+     *          selected by bits 0-1 of its `TAC` register.
+     */
+    struct timer_clock final
+    {
+        std::uint8_t        tac;                /** @brief The `TAC` clock select value. */
+        std::string_view    name;               /** @brief The clock's frequency. */
+        std::uint64_t       cycles_per_tick;    /** @brief M-cycles between increments of `TIMA`. */
+    };
+
+    /**
+     * @brief   The testbed timer's clock speed settings.
+     */
+    constexpr timer_clock TIMER_CLOCKS[] = {
+        { 0b00, "4096 Hz",   256 },
+        { 0b01, "262144 Hz", 4   },
+        { 0b10, "65536 Hz",  16  },
+        { 0b11, "16384 Hz",  64  }
+    };
+}
+
+/* Private Static Variables ***************************************************/
+
+namespace g10wcet
+{
+    // Usage: `g10wcet [options] <program file>`
+    static std::string s_program_file = "";     // `<program file>` - Required: Linked program to analyze
+    static std::string s_annotation_file = "";  // `-a <file>`, `--annotations <file>` - Loop bound annotations
+    static std::uint32_t s_timer_vector = 3;    // `--timer-vector <n>` - Interrupt vector of the timer's handler
+    static std::uint32_t s_timer_modulo = 0;    // `--tma <value>` - Value the timer's `TIMA` is reloaded with on overflow
+    static bool s_help = false;                 // `-h`, `--help` - Show help message
+    static bool s_version = false;              // `-v`, `--version` - Show version info
+    static bool s_verbose = false;              // `--verbose` - Show every routine's blocks and loops
+}
+
+/* Private Functions **********************************************************/
+
+namespace g10wcet
+{
+    static auto parse_arguments (int argc, const char** argv) -> bool
+    {
+        // - Iterate through command-line arguments and parse them.
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "-a" || arg == "--annotations")
+            {
+                if (i + 1 < argc)
+                {
+                    s_annotation_file = argv[++i];
+                }
+                else
+                {
+                    std::println(stderr, "Error: Missing annotation file after '{}'.", arg);
+                    return false;
+                }
+            }
+            else if (arg == "--timer-vector" || arg == "--tma")
+            {
+                if (i + 1 >= argc)
+                {
+                    std::println(stderr, "Error: Missing value after '{}'.", arg);
+                    return false;
+                }
+
+                try
+                {
+                    const auto value = std::stoul(argv[++i], nullptr, 0);
+                    if (arg == "--timer-vector" && value >= IVT_VECTOR_COUNT)
+                    {
+                        throw std::out_of_range { "vector" };
+                    }
+                    else if (arg == "--tma" && value > 0xFF)
+                    {
+                        throw std::out_of_range { "tma" };
+                    }
+
+                    ((arg == "--tma") ? s_timer_modulo : s_timer_vector) =
+                        static_cast<std::uint32_t>(value);
+                }
+                catch (const std::exception&)
+                {
+                    std::println(stderr, "Error: Invalid value '{}' after '{}'.",
+                        argv[i], arg);
+                    return false;
+                }
+            }
+            else if (arg == "-h" || arg == "--help")
+            {
+                s_help = true;
+            }
+            else if (arg == "-v" || arg == "--version")
+            {
+                s_version = true;
+            }
+            else if (arg == "--verbose")
+            {
+                s_verbose = true;
+            }
+            else if (arg.starts_with("-"))
+            {
+                std::println(stderr, "Error: Unknown argument '{}'.", arg);
+                return false;
+            }
+            else
+            {
+                s_program_file = arg;
+            }
+        }
+
+        // - Check for `--help` or `--version` flags.
+        if (s_help == true || s_version == true)
+        {
+            return true;
+        }
+
+        // - Validate required arguments.
+        if (s_program_file.empty() == true)
+        {
+            std::println(stderr, "Error: A program file is required.");
+            return false;
+        }
+
+        return true;
+    }
+
+    static auto show_version () -> void
+    {
+        std::println(
+            "'g10wcet' - G10 Worst-Case Execution Time Analyzer Tool\n"
+            "By: Dennis W. Griffin <dgdev1024@gmail.com>\n"
+        );
+    }
+
+    static auto show_help () -> void
+    {
+        std::println(
+            "Usage: g10wcet [options] <program file>\n\n"
+            "Analyzes the worst-case execution time, in M-cycles, of a linked program's\n"
+            "entry point and interrupt handlers, and checks the timer's interrupt\n"
+            "handler against the timer's period at each clock speed.\n\n"
+            "Options:\n"
+            "  -a, --annotations <file> Read loop bounds from this file. Each line is of the form\n"
+            "                           'loop <header-address> <iterations>', where the address is\n"
+            "                           hexadecimal, prefixed with '$' or '0x'.\n"
+            "      --timer-vector <n>   Specify the timer's interrupt vector (default 3).\n"
+            "      --tma <value>        Specify the timer modulo reloaded on overflow (default 0).\n"
+            "      --verbose            Show the basic blocks and loops of every routine.\n"
+            "  -h, --help               Show this help message and exit.\n"
+            "  -v, --version            Show version information and exit.\n"
+        );
+    }
+
+    static auto is_loaded (const g10::program& program, std::uint32_t address)
+        -> bool
+    {
+        return std::ranges::any_of(program.get_segments(),
+            [address] (const g10::program_segment& segment)
+            {
+                return segment.type != g10::segment_type::bss &&
+                    address >= segment.load_address &&
+                    address - segment.load_address < segment.memory_size;
+            });
+    }
+
+    static auto show_routine (std::string_view title,
+        const routine_report& report, std::uint64_t entry_cycles) -> void
+    {
+        if (report.wcet.has_value() == true)
+        {
+            std::println("{} (${:08X}): {} M-cycles{}", title, report.address,
+                report.wcet.value() + entry_cycles,
+                (entry_cycles > 0) ?
+                    std::format(" ({} for the handler, {} to enter it)",
+                        report.wcet.value(), entry_cycles) : "");
+        }
+        else
+        {
+            std::println("{} (${:08X}): unbounded - {}", title, report.address,
+                report.problem);
+        }
+
+        for (const auto& loop : report.loops)
+        {
+            std::println("  Loop at ${:08X}: {} M-cycles per iteration, {} to exit, {}",
+                loop.header, loop.iteration_cycles, loop.exit_cycles,
+                (loop.bound > 0) ?
+                    std::format("at most {} passes", loop.bound) :
+                    std::string { "no bound annotated" });
+        }
+
+        if (s_verbose == true)
+        {
+            for (const auto& block : report.blocks)
+            {
+                std::string successors = "";
+                for (const auto& edge : block.successors)
+                {
+                    successors += (edge.target == EXIT_BLOCK) ?
+                        std::format(" return(+{})", edge.cycles) :
+                        std::format(" ${:08X}(+{})",
+                            report.blocks[edge.target].start, edge.cycles);
+                }
+
+                std::println("  Block ${:08X}-${:08X}: {} M-cycles ->{}",
+                    block.start, block.end - 1, block.cycles, successors);
+            }
+        }
+    }
+
+    static auto show_timer_budget (const routine_report& handler) -> void
+    {
+        std::println("\nTimer (vector {}, TMA = ${:02X}):", s_timer_vector,
+            s_timer_modulo);
+        for (const auto& clock : TIMER_CLOCKS)
+        {
+            const std::uint64_t period =
+                (0x100 - s_timer_modulo) * clock.cycles_per_tick;
+            if (handler.wcet.has_value() == false)
+            {
+                std::println("  TAC clock {:>9}: period {:>6} M-cycles; handler unbounded",
+                    clock.name, period);
+                continue;
+            }
+
+            const std::uint64_t total = handler.wcet.value() + INTERRUPT_ENTRY_CYCLES;
+            std::println("  TAC clock {:>9}: period {:>6} M-cycles; handler {:>6} M-cycles; {}",
+                clock.name, period, total,
+                (total < period) ?
+                    std::format("OK, {} M-cycles to spare", period - total) :
+                    std::format("OVERRUN by {} M-cycles", total - period));
+        }
+    }
+}
+
+/* Main Function **************************************************************/
+
+auto main (int argc, const char** argv) -> int
+{
+    // - Parse command-line arguments.
+    if (g10wcet::parse_arguments(argc, argv) == false)
+    {
+        return 1;
+    }
+
+    // - Handle `--help` and `--version` flags.
+    if (g10wcet::s_help == true)
+    {
+        g10wcet::show_version();
+        g10wcet::show_help();
+        return 0;
+    }
+    else if (g10wcet::s_version == true)
+    {
+        g10wcet::show_version();
+        return 0;
+    }
+
+    // - Load the program file.
+    g10::program program;
+    if (auto result = program.load_from_file(g10wcet::s_program_file);
+        !result.has_value())
+    {
+        std::println(stderr, "Error: Failed to load program file '{}': '{}'.",
+            g10wcet::s_program_file, result.error());
+        return 1;
+    }
+
+    // - Load the loop bound annotations, if any.
+    std::unordered_map<std::uint32_t, std::uint32_t> loop_bounds;
+    if (g10wcet::s_annotation_file.empty() == false)
+    {
+        auto result = g10wcet::analyzer::parse_annotations(
+            g10wcet::s_annotation_file);
+        if (result.has_value() == false)
+        {
+            std::println(stderr, "Error: {}", result.error());
+            return 1;
+        }
+
+        loop_bounds = std::move(result.value());
+    }
+
+    std::set<std::uint32_t> annotated_headers;
+    for (const auto& [header, _] : loop_bounds)
+    {
+        annotated_headers.insert(header);
+    }
+
+    // - Analyze the entry point, and the handler of every interrupt vector
+    //   present in the program.
+    g10wcet::analyzer analyzer { program, std::move(loop_bounds) };
+    if (program.has_entry() == true)
+    {
+        g10wcet::show_routine("Entry point",
+            analyzer.analyze(program.get_entry_point()), 0);
+    }
+
+    const g10wcet::routine_report* timer_handler = nullptr;
+    for (std::uint32_t vector = 0; vector < g10wcet::IVT_VECTOR_COUNT; ++vector)
+    {
+        const std::uint32_t address = g10wcet::IVT_START +
+            vector * g10wcet::IVT_VECTOR_SIZE;
+        if (g10wcet::is_loaded(program, address) == false)
+        {
+            continue;
+        }
+
+        const auto& report = analyzer.analyze(address);
+        g10wcet::show_routine(std::format("Interrupt vector {}", vector),
+            report, g10wcet::INTERRUPT_ENTRY_CYCLES);
+        if (vector == g10wcet::s_timer_vector)
+        {
+            timer_handler = &report;
+        }
+    }
+
+    // - Report the subroutines reached along the way.
+    for (const auto& [address, report] : analyzer.get_reports())
+    {
+        const bool is_vector = (address >= g10wcet::IVT_START &&
+            address < g10wcet::IVT_START + g10wcet::IVT_VECTOR_COUNT * g10wcet::IVT_VECTOR_SIZE &&
+            (address - g10wcet::IVT_START) % g10wcet::IVT_VECTOR_SIZE == 0);
+        const bool is_entry = (program.has_entry() == true &&
+            address == program.get_entry_point());
+        if (is_entry == false && is_vector == false)
+        {
+            g10wcet::show_routine("Subroutine", report, 0);
+        }
+    }
+
+    if (timer_handler != nullptr)
+    {
+        g10wcet::show_timer_budget(*timer_handler);
+    }
+
+    // - An annotation which bounds no loop was most likely meant for another
+    //   address; the loop it was meant for would otherwise go unbounded, or
+    //   be bounded by a stale annotation, without notice.
+    for (const auto& [address, report] : analyzer.get_reports())
+    {
+        for (const auto& loop : report.loops)
+        {
+            annotated_headers.erase(loop.header);
+        }
+    }
+
+    if (annotated_headers.empty() == false)
+    {
+        for (const auto header : annotated_headers)
+        {
+            std::println(stderr, "Error: Loop bound annotated at ${:08X}, which "
+                "is not the header of any loop analyzed.", header);
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -34,6 +34,15 @@ for TEST_DIR in "${TEST_DIRS[@]}"; do
                 exit 1
             fi
 
+            # Assemble the file again with its sections emitted concurrently,
+            # however few statements it has; the object file must not change
+            parallel_file="${output_file%.*}.parallel.g10obj"
+            "$G10_ASM_TOOL" -s "$test_file" -o "$parallel_file" --parallel-min-nodes 1
+            if [[ $? -ne 0 ]] || ! cmp "$output_file" "$parallel_file"; then
+                echo "Concurrent section emission changed the object file for file: $test_file"
+                exit 1
+            fi
+
             # Hex dump the output object file for inspection
             echo "Hex dump of generated object file: $output_file"
             hexdump -C "$output_file"
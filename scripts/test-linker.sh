@@ -3,9 +3,10 @@
 # Test the G10 linker by linking sample programs and inspecting the output 
 # executable files.
 
-# Define the paths to the G10 Assembler and Linker executables
+# Define the paths to the G10 Assembler, Linker and Archiver executables
 G10_ASM_TOOL="./build/bin/linux-debug/g10asm"
 G10_LINKER_TOOL="./build/bin/linux-debug/g10link"
+G10_ARCHIVER_TOOL="./build/bin/linux-debug/g10ar"
 
 # Define the directory containing test assembly files for linking
 TEST_DIR="./examples/linker"
@@ -81,4 +82,213 @@ for entry in "$TEST_DIR"/*; do
     fi
 done
 
+# Define the directory containing the modules for the incremental linking
+# tests, and the directories to contain their object files and executables
+INCREMENTAL_DIR="./examples/linker-incremental"
+
+INCREMENTAL_OBJ_DIR="$OBJ_OUTPUT_DIR/incremental"
+mkdir -p "$INCREMENTAL_OBJ_DIR"
+
+INCREMENTAL_EXE_DIR="$EXE_OUTPUT_DIR/incremental"
+mkdir -p "$INCREMENTAL_EXE_DIR"
+
+# Links `app.asm` and `bias.asm` with `--incremental`, replaces `bias.asm` with
+# the given edited version, and relinks with `--incremental`.
+# - The second argument is how the relink is expected to go: `in-place` if the
+#   previous output should be patched, or `full` if the linker should fall
+#   back to a full link. A full link is told apart by the "Save program" phase
+#   in its time report.
+# - If the third argument is `tamper`, the previous output is altered before
+#   relinking, so that it no longer matches its recorded link state.
+# - Either way, the relinked program must match a full link of the edits.
+test_incremental () {
+    local edited_file="$INCREMENTAL_DIR/$1"
+    local expected_link="$2"
+    local name="$(basename "${1%.*}")"
+    local app_obj="$INCREMENTAL_OBJ_DIR/app.g10obj"
+    local bias_obj="$INCREMENTAL_OBJ_DIR/bias.g10obj"
+    local exe_file="$INCREMENTAL_EXE_DIR/$name.g10"
+    local full_file="$INCREMENTAL_EXE_DIR/$name-full.g10"
+    echo "Relinking incrementally with file: $edited_file"
+
+    # - Start from a full link of the original modules.
+    rm -f "$exe_file" "$exe_file.g10inc"
+    "$G10_ASM_TOOL" -s "$INCREMENTAL_DIR/app.asm" -o "$app_obj" &&
+        "$G10_ASM_TOOL" -s "$INCREMENTAL_DIR/bias.asm" -o "$bias_obj" &&
+        "$G10_LINKER_TOOL" "$app_obj" "$bias_obj" -o "$exe_file" --incremental
+    if [[ $? -ne 0 ]]; then
+        echo "Initial link failed for file: $edited_file"
+        exit 1
+    fi
+
+    if [[ "$3" == "tamper" ]]; then
+        printf '\x00' >> "$exe_file"
+    fi
+
+    # - Relink with the edited module.
+    "$G10_ASM_TOOL" -s "$edited_file" -o "$bias_obj"
+    if [[ $? -ne 0 ]]; then
+        echo "Assembly failed for file: $edited_file"
+        exit 1
+    fi
+
+    local report
+    report="$("$G10_LINKER_TOOL" "$app_obj" "$bias_obj" -o "$exe_file" \
+        --incremental --time-report)"
+    if [[ $? -ne 0 ]]; then
+        echo "Incremental relink failed for file: $edited_file"
+        exit 1
+    fi
+
+    local actual_link="in-place"
+    if grep -q "Save program" <<< "$report"; then
+        actual_link="full"
+    fi
+
+    if [[ "$actual_link" != "$expected_link" ]]; then
+        echo "Expected a $expected_link relink, but got a $actual_link relink, for file: $edited_file"
+        exit 1
+    fi
+
+    # - Compare against a full link of the same objects.
+    "$G10_LINKER_TOOL" "$app_obj" "$bias_obj" -o "$full_file"
+    if [[ $? -ne 0 ]]; then
+        echo "Full link failed for file: $edited_file"
+        exit 1
+    fi
+
+    if ! cmp "$exe_file" "$full_file"; then
+        echo "Incremental relink differs from a full link for file: $edited_file"
+        exit 1
+    fi
+
+    echo "Relinked ($actual_link) to match a full link, for file: $edited_file"
+    echo ""
+}
+
+# An edit which keeps the module's layout is patched in place; edits which
+# outgrow a section or change the exported symbols, and outputs which were
+# altered since their last link, fall back to a full link.
+test_incremental "bias-patched.asm" "in-place"
+test_incremental "bias-grown.asm" "full"
+test_incremental "bias-interface.asm" "full"
+test_incremental "bias-patched.asm" "full" "tamper"
+
+# Define the directory containing the archive linking test, and the
+# directories to contain its object files, archive and executables
+ARCHIVE_DIR="./examples/linker-archive"
+
+ARCHIVE_OBJ_DIR="$OBJ_OUTPUT_DIR/archive"
+mkdir -p "$ARCHIVE_OBJ_DIR"
+
+ARCHIVE_EXE_DIR="$EXE_OUTPUT_DIR/archive"
+mkdir -p "$ARCHIVE_EXE_DIR"
+
+# Archive the library modules in `lib`, and link `app.asm` against the archive.
+# - The archive's listing must match `list.expected`.
+# - Only the members `app.asm` needs, directly or through another member, may
+#   be linked, so the program must match a link of those members' objects.
+echo "Linking against archive in directory: $ARCHIVE_DIR"
+lib_objs=()
+for asm_file in "$ARCHIVE_DIR"/lib/*.asm; do
+    obj_file="$ARCHIVE_OBJ_DIR/$(basename "${asm_file%.*}.g10obj")"
+
+    "$G10_ASM_TOOL" -s "$asm_file" -o "$obj_file"
+    if [[ $? -ne 0 ]]; then
+        echo "Assembly failed for file: $asm_file"
+        exit 1
+    fi
+
+    lib_objs+=("$obj_file")
+done
+
+app_obj="$ARCHIVE_OBJ_DIR/app.g10obj"
+lib_archive="$ARCHIVE_OBJ_DIR/lib.g10a"
+"$G10_ASM_TOOL" -s "$ARCHIVE_DIR/app.asm" -o "$app_obj" &&
+    "$G10_ARCHIVER_TOOL" "${lib_objs[@]}" -o "$lib_archive"
+if [[ $? -ne 0 ]]; then
+    echo "Archiving failed for directory: $ARCHIVE_DIR"
+    exit 1
+fi
+
+if ! diff <("$G10_ARCHIVER_TOOL" --list "$lib_archive" | tail -n +2) \
+    "$ARCHIVE_DIR/list.expected"; then
+    echo "Archive listing differs from '$ARCHIVE_DIR/list.expected'"
+    exit 1
+fi
+
+"$G10_LINKER_TOOL" "$app_obj" "$lib_archive" -o "$ARCHIVE_EXE_DIR/archive.g10" &&
+    "$G10_LINKER_TOOL" "$app_obj" "$ARCHIVE_OBJ_DIR/checksum.g10obj" \
+        "$ARCHIVE_OBJ_DIR/fold.g10obj" -o "$ARCHIVE_EXE_DIR/members.g10"
+if [[ $? -ne 0 ]]; then
+    echo "Linking failed for directory: $ARCHIVE_DIR"
+    exit 1
+fi
+
+if ! cmp "$ARCHIVE_EXE_DIR/archive.g10" "$ARCHIVE_EXE_DIR/members.g10"; then
+    echo "Archive link differs from a link of the needed members, for directory: $ARCHIVE_DIR"
+    exit 1
+fi
+
+echo "Linked only the needed archive members, for directory: $ARCHIVE_DIR"
+echo ""
+
+# Define the directory containing the linker option tests, and the
+# directories to contain their object files and executables
+OPTIONS_DIR="./examples/linker-options"
+
+OPTIONS_OBJ_DIR="$OBJ_OUTPUT_DIR/options"
+mkdir -p "$OPTIONS_OBJ_DIR"
+
+OPTIONS_EXE_DIR="$EXE_OUTPUT_DIR/options"
+mkdir -p "$OPTIONS_EXE_DIR"
+
+# Link the modules in each directory of the option test directory, and compare
+# the program's bytes against the directory's `program.expected`, which holds
+# the output of `od -A x -t x1 -v`.
+# - `options`, if present, holds the options to link with.
+# - `order`, if present, is passed to the linker with `--order`.
+for entry in "$OPTIONS_DIR"/*/; do
+    entry="${entry%/}"
+    name="$(basename "$entry")"
+    echo "Linking with options in directory: $entry"
+
+    obj_files=()
+    for asm_file in "$entry"/*.asm; do
+        obj_file="$OPTIONS_OBJ_DIR/$name-$(basename "${asm_file%.*}.g10obj")"
+
+        "$G10_ASM_TOOL" -s "$asm_file" -o "$obj_file"
+        if [[ $? -ne 0 ]]; then
+            echo "Assembly failed for file: $asm_file"
+            exit 1
+        fi
+
+        obj_files+=("$obj_file")
+    done
+
+    link_args=()
+    if [[ -f "$entry/options" ]]; then
+        read -r -a link_args < "$entry/options"
+    fi
+
+    if [[ -f "$entry/order" ]]; then
+        link_args+=(--order "$entry/order")
+    fi
+
+    exe_file="$OPTIONS_EXE_DIR/$name.g10"
+    "$G10_LINKER_TOOL" "${obj_files[@]}" -o "$exe_file" "${link_args[@]}"
+    if [[ $? -ne 0 ]]; then
+        echo "Linking failed for directory: $entry"
+        exit 1
+    fi
+
+    if ! diff <(od -A x -t x1 -v "$exe_file") "$entry/program.expected"; then
+        echo "Linked program differs from '$entry/program.expected'"
+        exit 1
+    fi
+
+    echo "Linked program matches '$entry/program.expected'"
+    echo ""
+done
+
 echo "Linker tests completed."
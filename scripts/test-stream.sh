@@ -0,0 +1,46 @@
+#!/bin/bash
+
+# Test that the G10 Assembler Tool's streaming mode assembles large source
+# files in bounded memory, by comparing its peak resident set size on two
+# generated sources of very different lengths.
+
+# Define the path to the G10 Assembler Tool executable
+G10_ASM_TOOL="./build/bin/linux-debug/g10asm"
+
+# Define the directory to contain the generated sources and object files
+OUTPUT_DIR="./build/obj/test_stream"
+mkdir -p "$OUTPUT_DIR"
+
+# Define the lengths, in lines, of the small and large sources, and how much
+# more memory, in MiB, the large source may take. The lengths span several of
+# the assembler's one-megabyte chunks; the allowance covers the generated code.
+SMALL_LINES=100000
+LARGE_LINES=400000
+ALLOWANCE_MIB=32
+
+# Assembles a generated source of the given length in streaming mode, and
+# prints the peak resident set size reported by `--time-report`, in MiB.
+peak_rss_mib () {
+    local lines=$1
+    local source_file="$OUTPUT_DIR/lines-$lines.asm"
+    local object_file="$OUTPUT_DIR/lines-$lines.g10obj"
+
+    yes "    ld l0, 1" | head -n "$lines" > "$source_file"
+    "$G10_ASM_TOOL" -s "$source_file" -o "$object_file" --stream \
+        --time-report 2>&1 | awk '/Peak RSS:/ { print int($3) }'
+}
+
+small_rss="$(peak_rss_mib $SMALL_LINES)"
+large_rss="$(peak_rss_mib $LARGE_LINES)"
+if [[ -z "$small_rss" || -z "$large_rss" ]]; then
+    echo "Streaming assembly failed, or did not report its peak RSS."
+    exit 1
+fi
+
+echo "Peak RSS: $small_rss MiB for $SMALL_LINES lines, $large_rss MiB for $LARGE_LINES lines."
+if (( large_rss > small_rss + ALLOWANCE_MIB )); then
+    echo "Streaming assembly's memory grows with the length of its source."
+    exit 1
+fi
+
+echo "Streaming memory test completed."
@@ -0,0 +1,73 @@
+#!/bin/bash
+
+# Test the G10 worst-case execution time analyzer by analyzing sample programs
+# and comparing its report against the expected output.
+
+# Define the paths to the G10 Assembler, Linker and WCET Analyzer executables
+G10_ASM_TOOL="./build/bin/linux-debug/g10asm"
+G10_LINKER_TOOL="./build/bin/linux-debug/g10link"
+G10_WCET_TOOL="./build/bin/linux-debug/g10wcet"
+
+# Define the directory containing test assembly files for analysis
+TEST_DIR="./examples/g10wcet"
+
+# Define the directories to contain the object files and linked executables
+OBJ_OUTPUT_DIR="./build/obj/test_wcet"
+mkdir -p "$OBJ_OUTPUT_DIR"
+
+EXE_OUTPUT_DIR="./build/bin/test_wcet"
+mkdir -p "$EXE_OUTPUT_DIR"
+
+# Loop through each `.asm` file in the test directory
+# - `X.loops`, if present, holds the loop bound annotations for `X.asm`.
+# - `X.expected`, if present, holds the report the analyzer must print.
+# - Tests with 'error' in their name are expected to be rejected.
+for asm_file in "$TEST_DIR"/*.asm; do
+    base="${asm_file%.*}"
+    name="$(basename "$base")"
+    echo "Analyzing file: $asm_file"
+
+    obj_file="$OBJ_OUTPUT_DIR/$name.g10obj"
+    exe_file="$EXE_OUTPUT_DIR/$name.g10"
+
+    "$G10_ASM_TOOL" -s "$asm_file" -o "$obj_file"
+    if [[ $? -ne 0 ]]; then
+        echo "Assembly failed for file: $asm_file"
+        exit 1
+    fi
+
+    "$G10_LINKER_TOOL" "$obj_file" -o "$exe_file"
+    if [[ $? -ne 0 ]]; then
+        echo "Linking failed for file: $asm_file"
+        exit 1
+    fi
+
+    wcet_args=("$exe_file")
+    if [[ -f "$base.loops" ]]; then
+        wcet_args+=(-a "$base.loops")
+    fi
+
+    report="$("$G10_WCET_TOOL" "${wcet_args[@]}")"
+    status=$?
+    echo "$report"
+
+    if [[ "$name" == *"error"* ]]; then
+        if [[ $status -eq 0 ]]; then
+            echo "Analysis succeeded, but was expected to fail, for file: $asm_file"
+            exit 1
+        fi
+
+        echo "Analysis failed, as expected, for file: $asm_file"
+    elif [[ $status -ne 0 ]]; then
+        echo "Analysis failed for file: $asm_file"
+        exit 1
+    elif [[ -f "$base.expected" ]] &&
+        ! diff <(echo "$report") "$base.expected"; then
+        echo "Analysis report differs from '$base.expected' for file: $asm_file"
+        exit 1
+    fi
+
+    echo ""
+done
+
+echo "WCET analyzer tests completed."